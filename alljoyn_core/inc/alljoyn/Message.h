@@ -218,6 +218,7 @@ class _Message {
     friend class PermissionMgmtObj;
     friend class _Manifest;
     friend struct Rule;
+    friend class ParsedMessage;
 
   public:
     /**
@@ -595,7 +596,8 @@ class _Message {
     int32_t GetAuthVersion() const { return authVersion; }
 
     /**
-     * Copy constructor.
+     * Copy constructor.  The copy shares the marshalled bytes of the other
+     * message until one of them is modified.
      *
      * @param other   The other message to copy.
      */
@@ -1003,16 +1005,93 @@ class _Message {
      */
     QStatus Deliver(RemoteEndpoint& endpoint);
 
+    /**
+     * @internal
+     * The write position of one delivery of a message to a remote endpoint.
+     * Deliveries of the same message to several endpoints share the
+     * marshalled bytes of the message and each delivery only keeps its own
+     * cursor.
+     */
+    class WriteCursor {
+      public:
+        /**
+         * Create a cursor for delivering a message.
+         *
+         * @param msg   The message to deliver.
+         */
+        WriteCursor(const Message& msg);
+
+        /**
+         * Copy constructor.
+         *
+         * @param other   The cursor to copy.
+         */
+        WriteCursor(const WriteCursor& other);
+
+        /**
+         * Assignment operator.
+         *
+         * @param other   The cursor to copy.
+         */
+        WriteCursor& operator=(const WriteCursor& other);
+
+        /**
+         * Destructor.
+         */
+        ~WriteCursor();
+
+        /**
+         * Get the message being delivered.  This is a private copy of the
+         * original message if the message had to be encrypted.
+         *
+         * @return  The message being delivered.
+         */
+        Message& GetMessage() { return msg; }
+
+        /**
+         * Check if the delivery is complete.
+         *
+         * @return  true if all of the message has been written.
+         */
+        bool IsComplete() const { return state == MESSAGE_COMPLETE; }
+
+      private:
+        friend class _Message;
+
+        Message msg;                ///< The message being delivered.
+        uint64_t* buf;              ///< Reference to the marshalled bytes being written.
+        AllJoynMessageState state;  ///< The current state of the delivery.
+        const uint8_t* writePtr;    ///< Pointer to the current write position in buf.
+        size_t countWrite;          ///< Number of bytes remaining to write for completion of the delivery.
+    };
+
     /**
      * @internal
      * Deliver a marshaled message to a remote endpoint. Non-blocking
      *
      * @param endpoint   Endpoint to receive marshaled message.
+     * @param cursor     Write position of the delivery.
      * @return
      *      - #ER_OK if successful
      *      - An error status otherwise
      */
-    QStatus DeliverNonBlocking(RemoteEndpoint& endpoint);
+    static QStatus DeliverNonBlocking(RemoteEndpoint& endpoint, WriteCursor& cursor);
+
+    /**
+     * @internal
+     * Deliver several marshaled messages to a remote endpoint with a gathered
+     * write. Non-blocking.  A message is only counted as delivered once all of
+     * the messages before it have been delivered.
+     *
+     * @param endpoint            Endpoint to receive marshaled messages.
+     * @param cursors             Write positions of the messages to deliver in order.
+     * @param numCursors          Number of entries in cursors.
+     * @param[out] numDelivered   Number of messages at the start of cursors that have been delivered.
+     * @return
+     *      - #ER_OK if successful
+     *      - An error status otherwise, the error applies to cursors[numDelivered]
+     */
+    static QStatus DeliverNonBlocking(RemoteEndpoint& endpoint, WriteCursor* cursors, size_t numCursors, size_t& numDelivered);
     /**
      * @internal
      * Marshal the message again with the new sender name if one was provided.
@@ -1053,6 +1132,52 @@ class _Message {
 
   private:
 
+    /**
+     * Prepare a message for non-blocking delivery. Checks the TTL and encrypts
+     * the message if needed.
+     *
+     * @param endpoint   Endpoint to receive marshaled message.
+     * @param cursor     Write position of the delivery.
+     * @return
+     *      - #ER_OK if successful, the message is ready to be written or is
+     *        complete if it does not need to be written
+     *      - An error status otherwise
+     */
+    static QStatus PrepareDelivery(RemoteEndpoint& endpoint, WriteCursor& cursor);
+
+    /**
+     * Allocate a message buffer.  Message buffers are reference counted so
+     * copies of a message and deliveries of a message share the marshalled
+     * bytes.  The reference count is kept in the 8 bytes in front of the
+     * returned pointer.
+     *
+     * @param size   The number of bytes needed.
+     *
+     * @return  An 8 byte aligned buffer with a reference count of one.
+     */
+    static uint64_t* NewBuffer(size_t size);
+
+    /**
+     * Add a reference to a message buffer.
+     *
+     * @param buf   The buffer to reference.
+     */
+    static void AddRefBuffer(uint64_t* buf);
+
+    /**
+     * Release a reference to a message buffer.  The buffer is freed when the
+     * last reference is released.
+     *
+     * @param buf   The buffer to release, may be NULL.
+     */
+    static void ReleaseBuffer(uint64_t* buf);
+
+    /**
+     * Make sure this message is the only user of its buffer before the buffer
+     * is modified in place.  The buffer is copied if it is shared.
+     */
+    void MakeBufferWritable();
+
     /**
      * Common initialization called by constructor.  Calling constructors from other constructors is
      * not supported in some compilers.
@@ -1173,8 +1298,7 @@ class _Message {
     bool endianSwap;             ///< true if endianness will be swapped.
 
     MessageHeader msgHeader;     ///< Current message header.
-    uint8_t* _msgBuf;            ///< Pointer to the current msg buffer.
-    uint64_t* msgBuf;            ///< Pointer to the current msg buffer (8 byte aligned pointer into _msgBuf).
+    uint64_t* msgBuf;            ///< Pointer to the current msg buffer (reference counted, see NewBuffer()).
     MsgArg* msgArgs;             ///< Pointer to the unmarshaled arguments.
     uint8_t numMsgArgs;          ///< Number of message args (signature cannot be longer than 255 chars).
 
@@ -1204,10 +1328,6 @@ class _Message {
     size_t countRead;               ///< Number of bytes remaining to read for completion of the message.
     size_t maxFds;                  ///< Store the number of max FDs for the endpoint, so it doesnt need to be calculated each time.
 
-    AllJoynMessageState writeState; ///< The current state of the message during write.
-    uint8_t* writePtr;              ///< Pointer to the current write position in the buffer.
-    size_t countWrite;              ///< Number of bytes remaining to write for completion of the message.
-
     /**
      * The header fields for this message. Which header fields are present depends on the message
      * type defined in the message header.
@@ -1170,6 +1170,25 @@ class _Manifest {
      */
     QStatus Verify(const std::vector<uint8_t>& subjectThumbprint, const qcc::ECCPublicKey* issuerPublicKey) const;
 
+    /**
+     * @internal
+     *
+     * Cryptographically verify several manifests for the use of a particular subject certificate thumbprint
+     * using the provided issuer public key. The signatures are checked in one batch, which costs much less
+     * than calling Verify on each manifest.
+     *
+     * @param[in] manifests Manifests to verify
+     * @param[in] manifestCount Number of manifests
+     * @param[in] subjectThumbprint SHA-256 thumbprint of the signed certificate of the app using these manifests
+     * @param[in] issuerPublicKey Public key of the issuer of a Subject Certificate corresponding to the subjectThumbprint
+     * @param[out] results The result of verifying each manifest, as Verify would return it
+     *
+     * @return
+     * - #ER_OK if all the manifests are cryptographically verified for use by subjectThumbprint
+     * - the first error in results otherwise
+     */
+    static QStatus VerifyBatch(const Manifest* manifests, size_t manifestCount, const std::vector<uint8_t>& subjectThumbprint, const qcc::ECCPublicKey* issuerPublicKey, std::vector<QStatus>& results);
+
     /**
      * Get version number of this manifest.
      *
@@ -1387,6 +1406,7 @@ class _Manifest {
      */
     bool HasSignature() const;
 
+    QStatus GetSignedDigest(const std::vector<uint8_t>& subjectThumbprint, std::vector<uint8_t>& digest, qcc::ECCSignature& signature) const;
     QStatus GetDigest(std::vector<uint8_t>& digest) const;
     QStatus GetECCSignature(qcc::ECCSignature& signature) const;
     QStatus SetECCSignature(const qcc::ECCSignature& signature);
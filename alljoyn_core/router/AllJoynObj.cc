@@ -3836,6 +3836,9 @@ void AllJoynObj::ProcFindAdvertisement(QStatus status, Message& msg, const qcc::
                  * the calls to the transports are complete.
                  */
                 discoverMap.insert(std::make_pair(matchingStr, DiscoverMapEntry(transports, sender, matching, namePrefix == matching.end())));
+                if (namePrefix != matching.end()) {
+                    discoverNames.Add(namePrefix->second);
+                }
             }
         } else {
             replyCode = ALLJOYN_FINDADVERTISEDNAME_REPLY_TRANSPORT_NOT_AVAILABLE;
@@ -4010,6 +4013,10 @@ QStatus AllJoynObj::ProcCancelFindAdvertisement(const qcc::String& sender, const
             origMask = it->second.transportMask;
             it->second.transportMask &= ~transports;
             if (it->second.transportMask == 0) {
+                MatchMap::const_iterator namePrefix = it->second.matching.find("name");
+                if (namePrefix != it->second.matching.end()) {
+                    discoverNames.Remove(namePrefix->second);
+                }
                 discoverMap.erase(it++);
                 continue;
             }
@@ -5170,7 +5177,9 @@ void AllJoynObj::FoundNames(const qcc::String& busAddr,
                     }
                     /* Send FoundAdvertisedName to anyone who is discovering *nit */
                     if (sendSignal) {
-                        if (0 < discoverMap.size()) {
+                        set<String> matchingPrefixes;
+                        discoverNames.MatchName(*nit, matchingPrefixes);
+                        if (!matchingPrefixes.empty()) {
                             for (DiscoverMapType::const_iterator dit = discoverMap.begin(); dit != discoverMap.end(); ++dit) {
                                 MatchMap::const_iterator namePrefix = dit->second.matching.find("name");
                                 if (namePrefix == dit->second.matching.end()) {
@@ -5181,7 +5190,7 @@ void AllJoynObj::FoundNames(const qcc::String& busAddr,
                                     continue;
                                 }
 
-                                if (!WildcardMatch(*nit, namePrefix->second) && (transport & dit->second.transportMask)) {
+                                if ((transport & dit->second.transportMask) && (matchingPrefixes.find(namePrefix->second) != matchingPrefixes.end())) {
                                     foundNameSet.insert(FoundNameEntry(*nit, namePrefix->second, dit->second.sender));
                                 }
                             }
@@ -5345,13 +5354,15 @@ QStatus AllJoynObj::SendLostAdvertisedName(const String& name, TransportMask tra
     /* Send LostAdvertisedName to anyone who is discovering name */
     AcquireLocks();
     vector<pair<String, String> > sigVec;
-    if (0 < discoverMap.size()) {
+    set<String> matchingPrefixes;
+    discoverNames.MatchName(name, matchingPrefixes);
+    if (!matchingPrefixes.empty()) {
         for (DiscoverMapType::const_iterator dit = discoverMap.begin(); dit != discoverMap.end(); ++dit) {
             MatchMap::const_iterator namePrefix = dit->second.matching.find("name");
             if (namePrefix == dit->second.matching.end()) {
                 continue;
             }
-            if (!WildcardMatch(name, namePrefix->second) && (dit->second.transportMask & transport)) {
+            if ((dit->second.transportMask & transport) && (matchingPrefixes.find(namePrefix->second) != matchingPrefixes.end())) {
                 sigVec.push_back(pair<String, String>(namePrefix->second, dit->second.sender));
             }
         }
@@ -53,6 +53,7 @@
 
 #include "Bus.h"
 #include "BusUtil.h"
+#include "NameMatcher.h"
 #include "NameTable.h"
 #include "RemoteEndpoint.h"
 #include "Transport.h"
@@ -841,6 +842,9 @@ class AllJoynObj : public BusObject, public NameListener, public TransportListen
     typedef std::multimap<qcc::String, DiscoverMapEntry> DiscoverMapType;
     DiscoverMapType discoverMap;
 
+    /** The name patterns of the entries in discoverMap (protected by discoverMapLock) */
+    NameMatcher discoverNames;
+
     /** Map of discovered bus names (protected by discoverMapLock) */
     struct NameMapEntry {
         qcc::String busAddr;
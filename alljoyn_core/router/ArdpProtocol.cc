@@ -37,9 +37,13 @@
 #include <qcc/IPAddress.h>
 #include <qcc/Socket.h>
 #include <qcc/SocketTypes.h>
+#include <qcc/STLContainer.h>
 #include <qcc/time.h>
 #include <qcc/Util.h>
 
+#include <queue>
+#include <vector>
+
 #include <alljoyn/Message.h>
 
 #include "ScatterGatherList.h"
@@ -76,6 +80,15 @@ namespace ajn {
 /* Minimum Delayed ACK Timeout */
 #define ARDP_MIN_DELAYED_ACK_TIMEOUT 10
 
+/* Maximum number of datagrams pulled from the socket with one system call */
+#define ARDP_RECV_BATCH 8
+
+/* Maximum number of segments of one message handed to the socket with one system call */
+#define ARDP_SEND_BATCH 32
+
+/* Buffers making up one outbound data segment: header, EACK mask and payload */
+#define ARDP_SEND_IOVECS 3
+
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 #define ABS(a) ((a) >= 0 ? (a) : -(a))
@@ -273,12 +286,24 @@ struct ARDP_CONN_RECORD {
     ArdpTimer probeTimer;   /* Probe (link timeout) timer */
     ArdpTimer ackTimer;     /* Delayed ACK timer */
     ArdpTimer persistTimer; /* Persist (frozen window) timer */
+    uint32_t timerWhen;     /* Time of this connection's live entry in the handle's connTimers heap */
     uint32_t ackPending;    /* Number of received segments pending acknowledgement */
     bool modeSimple;        /* Simple mode connection. No EACKs. */
     void* context;          /* A client-defined context pointer */
     qcc::SendMsgFlags sndFlags; /* SendMsgFlags to underlying sockets call */
 };
 
+/* Entry in the heap of scheduled connection timers */
+typedef struct {
+    uint32_t when;          /* Time at which the connection's timers need to be checked */
+    uint32_t connId;        /* Id of the connection, to detect a freed and reused record */
+    ArdpConnRecord* conn;   /* The connection */
+} ArdpConnTimerEntry;
+
+struct ArdpConnTimerLater {
+    bool operator()(const ArdpConnTimerEntry& a, const ArdpConnTimerEntry& b) const { return a.when > b.when; }
+};
+
 struct ARDP_HANDLE {
     ArdpGlobalConfig config; /* The configurable items that affect this instance of ARDP as a whole */
     ArdpCallbacks cb;        /* The callbacks to allow the protocol to talk back to the client */
@@ -290,10 +315,14 @@ struct ARDP_HANDLE {
 #endif
     bool accepting;          /* If true the ArdpProtocol is accepting inbound connections */
     ListNode conns;          /* List of currently active connections */
+    std::unordered_set<ArdpConnRecord*> connSet;                    /* Set of currently active connections */
+    std::unordered_multimap<uint32_t, ArdpConnRecord*> connIndex;  /* Active connections by (local, foreign) port pair */
+    std::priority_queue<ArdpConnTimerEntry, std::vector<ArdpConnTimerEntry>, ArdpConnTimerLater> connTimers; /* Min-heap of scheduled connection timers */
     qcc::Timespec<qcc::MonotonicTime> tbase; /* Baseline time */
     ListNode dataTimers;     /* List of currently scheduled retransmit timers */
     uint32_t msnext;         /* To inform upper layer when to call into the protocol next time */
     bool trafficJam;         /* "Socket Write Block" indicator */
+    std::vector<uint32_t> rxBatch; /* Receive buffers for ARDP_RECV_BATCH datagrams, allocated on first read */
     void* context;           /* A client-defined context pointer */
 };
 
@@ -431,45 +460,97 @@ static bool IsConnValid(ArdpHandle* handle, ArdpConnRecord* conn)
         return false;
     }
 
-    if (IsEmpty(&handle->conns)) {
-        return false;
-    }
-
-    for (ListNode* ln = &handle->conns; (ln = ln->fwd) != &handle->conns;) {
-        if (conn == (ArdpConnRecord*)ln) {
-            return true;
-        }
-    }
-    return false;
+    return handle->connSet.find(conn) != handle->connSet.end();
 }
 
 static bool IsConnValid(ArdpHandle* handle, ArdpConnRecord* conn, uint32_t connId)
 {
-    if (conn == NULL) {
-        return false;
-    }
+    return IsConnValid(handle, conn) && (conn->id == connId);
+}
 
-    if (IsEmpty(&handle->conns)) {
-        return false;
+static inline uint32_t ConnKey(uint16_t local, uint16_t foreign)
+{
+    return (static_cast<uint32_t>(local) << 16) | foreign;
+}
+
+static void IndexConn(ArdpHandle* handle, ArdpConnRecord* conn)
+{
+    handle->connIndex.insert(std::make_pair(ConnKey(conn->local, conn->foreign), conn));
+}
+
+static void UnindexConn(ArdpHandle* handle, ArdpConnRecord* conn)
+{
+    typedef std::unordered_multimap<uint32_t, ArdpConnRecord*>::iterator IndexIterator;
+    std::pair<IndexIterator, IndexIterator> range = handle->connIndex.equal_range(ConnKey(conn->local, conn->foreign));
+    for (IndexIterator it = range.first; it != range.second; ++it) {
+        if (it->second == conn) {
+            handle->connIndex.erase(it);
+            break;
+        }
     }
+}
 
-    for (ListNode* ln = &handle->conns; (ln = ln->fwd) != &handle->conns;) {
-        if (conn == (ArdpConnRecord*)ln && (conn->id == connId)) {
-            return true;
+static void AddConnRecord(ArdpHandle* handle, ArdpConnRecord* conn)
+{
+    EnList(handle->conns.bwd, (ListNode*)conn);
+    handle->connSet.insert(conn);
+    IndexConn(handle, conn);
+}
+
+static void SetForeignPort(ArdpHandle* handle, ArdpConnRecord* conn, uint16_t foreign)
+{
+    if (conn->foreign != foreign) {
+        bool indexed = IsConnValid(handle, conn);
+        if (indexed) {
+            UnindexConn(handle, conn);
+        }
+        conn->foreign = foreign;
+        if (indexed) {
+            IndexConn(handle, conn);
         }
     }
-    return false;
 }
 
-static void moveAhead(ArdpHandle* handle, ArdpConnRecord* conn)
+/*
+ * Make sure the connection's timers get checked no later than 'when'.  Each
+ * connection has at most one live entry in the heap; entries superseded by an
+ * earlier one are discarded when they reach the top.
+ */
+static void ScheduleConn(ArdpHandle* handle, ArdpConnRecord* conn, uint32_t when)
 {
-    ListNode* head = &handle->conns;
-    ListNode* ln = (ListNode* ) conn;
+    if (when < conn->timerWhen) {
+        conn->timerWhen = when;
+        ArdpConnTimerEntry entry = { when, conn->id, conn };
+        handle->connTimers.push(entry);
+    }
+}
 
-    if (head->fwd != ln) {
-        DeList(ln);
-        EnList(head, ln);
+/*
+ * Schedule the earliest armed timer of a connection.  This mirrors the timers
+ * that CheckConnTimers looks at.
+ */
+static void ScheduleConnTimers(ArdpHandle* handle, ArdpConnRecord* conn)
+{
+    if (conn->connectTimer.retry != 0) {
+        ScheduleConn(handle, conn, conn->connectTimer.when);
+        return;
+    }
+    if (conn->state != OPEN) {
+        return;
+    }
+    uint32_t next = conn->probeTimer.when;
+    if ((conn->ackTimer.retry != 0) && (conn->ackTimer.when < next)) {
+        next = conn->ackTimer.when;
     }
+    if ((conn->persistTimer.retry != 0) && (conn->persistTimer.when < next)) {
+        next = conn->persistTimer.when;
+    }
+    ScheduleConn(handle, conn, next);
+}
+
+static inline bool IsConnTimer(ArdpConnRecord* conn, ArdpTimer* timer)
+{
+    return (timer == &conn->connectTimer) || (timer == &conn->probeTimer) || (timer == &conn->ackTimer) || (timer == &conn->persistTimer);
 }
 
 static void InitTimer(ArdpHandle* handle, ArdpConnRecord* conn, ArdpTimer* timer, ArdpTimeoutHandler handler, void*context, uint32_t timeout, uint16_t retry)
@@ -483,9 +564,11 @@ static void InitTimer(ArdpHandle* handle, ArdpConnRecord* conn, ArdpTimer* timer
     timer->delta = timeout;
     timer->when = TimeNow(handle->tbase) + timeout;
     timer->retry = retry;
+    if (IsConnTimer(conn, timer) && ((retry != 0) || (timer == &conn->probeTimer))) {
+        ScheduleConn(handle, conn, timer->when);
+    }
     /* Update "call-me-back" value */
     if ((retry != 0) && (timeout < handle->msnext)) {
-        moveAhead(handle, conn);
         handle->msnext = timeout;
     }
 }
@@ -496,13 +579,15 @@ static void UpdateTimer(ArdpHandle* handle, ArdpConnRecord* conn, ArdpTimer* tim
     timer->delta = timeout;
     timer->when = TimeNow(handle->tbase) + timeout;
     timer->retry = retry;
+    if (IsConnTimer(conn, timer) && ((retry != 0) || (timer == &conn->probeTimer))) {
+        ScheduleConn(handle, conn, timer->when);
+    }
     if ((retry != 0) && (timeout < handle->msnext)) {
-        moveAhead(handle, conn);
         handle->msnext = timeout;
     }
 }
 
-static uint32_t CheckConnTimers(ArdpHandle* handle, ArdpConnRecord* conn, uint32_t next, uint32_t now)
+static void CheckConnTimers(ArdpHandle* handle, ArdpConnRecord* conn, uint32_t now)
 {
     /*
      * Check connect/disconnect timer. This timer is alive only when the connection is being established or going away.
@@ -515,19 +600,14 @@ static uint32_t CheckConnTimers(ArdpHandle* handle, ArdpConnRecord* conn, uint32
             (conn->connectTimer.handler)(handle, conn, conn->connectTimer.context);
             if (IsConnValid(handle, conn)) {
                 conn->connectTimer.when = now + conn->connectTimer.delta;
-                if (conn->connectTimer.when < next && conn->connectTimer.retry != 0) {
-                    /* Update "call-me-next-ms" value */
-                    next = conn->connectTimer.when;
-                    moveAhead(handle, conn);
-                }
             }
         }
-        return next;
+        return;
     }
 
     /* If connection is not in OPEN state, return */
     if (conn->state != OPEN) {
-        return next;
+        return;
     }
 
     /* Check probe timer, it's always turned on */
@@ -538,12 +618,6 @@ static uint32_t CheckConnTimers(ArdpHandle* handle, ArdpConnRecord* conn, uint32
         conn->probeTimer.when = now + conn->probeTimer.delta;
     }
 
-    if (conn->probeTimer.when < next) {
-        /* Update "call-me-next-ms" value */
-        next = conn->probeTimer.when;
-        moveAhead(handle, conn);
-    }
-
     /* Check delayed ACK timer */
     if (conn->ackTimer.retry != 0 && conn->ackTimer.when <= now) {
         QCC_DbgPrintf(("CheckConnTimers (conn %p): Fire ACK timer %p at %u (now=%u)",
@@ -551,11 +625,6 @@ static uint32_t CheckConnTimers(ArdpHandle* handle, ArdpConnRecord* conn, uint32
         (conn->ackTimer.handler)(handle, conn, conn->ackTimer.context);
     }
 
-    if (conn->ackTimer.when < next && conn->ackTimer.retry != 0) {
-        /* Update "call-me-next-ms" value */
-        next = conn->ackTimer.when;
-    }
-
     /* Check persist timer */
     if (conn->persistTimer.retry != 0 && conn->persistTimer.when <= now) {
         QCC_DbgHLPrintf(("CheckConnTimers: Fire persist timer: handle=%p, conn=%p, id=%u (%d)",
@@ -564,14 +633,6 @@ static uint32_t CheckConnTimers(ArdpHandle* handle, ArdpConnRecord* conn, uint32
         (conn->persistTimer.handler)(handle, conn, conn->persistTimer.context);
         conn->persistTimer.when = now + conn->persistTimer.delta;
     }
-
-    if (conn->persistTimer.when < next && conn->persistTimer.retry != 0) {
-        /* Update "call-me-next-ms" value */
-        next = conn->persistTimer.when;
-        moveAhead(handle, conn);
-    }
-
-    return next;
 }
 
 static bool IsValidRetransmit(ArdpConnRecord* conn, ArdpSndBuf* sBuf)
@@ -603,26 +664,49 @@ static uint32_t CheckTimers(ArdpHandle* handle)
 {
     uint32_t nextTime = ARDP_NO_TIMEOUT;
     uint32_t now = TimeNow(handle->tbase);
-    ListNode* ln = &handle->conns;
 
-    if (IsEmpty(ln)) {
+    if (IsEmpty(&handle->conns)) {
         return nextTime;
     }
 
-    for (; (ln = ln->fwd) != &handle->conns;) {
-        ListNode* temp = ln->bwd;
-
-        nextTime = CheckConnTimers(handle, (ArdpConnRecord* ) ln, nextTime, now);
+    /*
+     * Pull the connections that are due off the heap first: firing a timer
+     * may schedule more work (for this or another connection), which is left
+     * for the next pass.
+     */
+    std::vector<ArdpConnTimerEntry> due;
+    while (!handle->connTimers.empty() && (handle->connTimers.top().when <= now)) {
+        ArdpConnTimerEntry entry = handle->connTimers.top();
+        handle->connTimers.pop();
+        if (IsConnValid(handle, entry.conn, entry.connId) && (entry.conn->timerWhen == entry.when)) {
+            entry.conn->timerWhen = ARDP_NO_TIMEOUT;
+            due.push_back(entry);
+        }
+    }
 
+    for (size_t i = 0; i < due.size(); ++i) {
+        ArdpConnRecord* conn = due[i].conn;
         /* Check if connection record has been removed due to expiring connect/disconnect timers */
-        if (IsEmpty(&handle->conns)) {
+        if (!IsConnValid(handle, conn, due[i].connId)) {
+            continue;
+        }
+        CheckConnTimers(handle, conn, now);
+        if (IsConnValid(handle, conn, due[i].connId)) {
+            ScheduleConnTimers(handle, conn);
+        }
+    }
+
+    /* Discard superseded entries so that the top of the heap is the next live one */
+    while (!handle->connTimers.empty()) {
+        const ArdpConnTimerEntry& entry = handle->connTimers.top();
+        if (IsConnValid(handle, entry.conn, entry.connId) && (entry.conn->timerWhen == entry.when)) {
+            nextTime = entry.when;
             break;
-        } else if (!IsConnValid(handle, (ArdpConnRecord*) ln)) {
-            ln = temp;
         }
+        handle->connTimers.pop();
     }
 
-    ln = &handle->dataTimers;
+    ListNode* ln = &handle->dataTimers;
 
     if (!handle->trafficJam && !IsEmpty(ln)) {
         for (; (ln = ln->fwd) != &handle->dataTimers;) {
@@ -652,12 +736,14 @@ static uint32_t CheckTimers(ArdpHandle* handle)
         }
     }
 
-    return (nextTime != ARDP_NO_TIMEOUT) ? nextTime - now : ARDP_NO_TIMEOUT;
+    if (nextTime == ARDP_NO_TIMEOUT) {
+        return ARDP_NO_TIMEOUT;
+    }
+    return (nextTime > now) ? nextTime - now : 0;
 }
 
 static void DelConnRecord(ArdpHandle* handle, ArdpConnRecord* conn, bool forced)
 {
-    QCC_UNUSED(handle);
     QCC_DbgTrace(("DelConnRecord(handle=%p conn=%p forced=%s state=%s)",
                   handle, conn, forced ? "true" : "false", State2Text(conn->state)));
 
@@ -684,6 +770,9 @@ static void DelConnRecord(ArdpHandle* handle, ArdpConnRecord* conn, bool forced)
     }
 
     DeList((ListNode*)conn);
+    if (handle->connSet.erase(conn) != 0) {
+        UnindexConn(handle, conn);
+    }
 
     if (conn->synData.buf != NULL) {
         free(conn->synData.buf);
@@ -866,11 +955,11 @@ static QStatus Send(ArdpHandle* handle, ArdpConnRecord* conn, uint8_t flags, uin
 }
 
 
-static void UnmarshalSynSegment(ArdpConnRecord* conn, uint8_t* buf, ArdpSeg* seg)
+static void UnmarshalSynSegment(ArdpHandle* handle, ArdpConnRecord* conn, uint8_t* buf, ArdpSeg* seg)
 {
     uint16_t options = ntohs(*reinterpret_cast<uint16_t*>(buf + OPTIONS_OFFSET));
     conn->modeSimple = (options & ARDP_FLAG_SIMPLE_MODE);
-    conn->foreign = ntohs(*reinterpret_cast<uint16_t*>(buf + SRC_OFFSET)); /* The source ARDP port */
+    SetForeignPort(handle, conn, ntohs(*reinterpret_cast<uint16_t*>(buf + SRC_OFFSET))); /* The source ARDP port */
     conn->snd.SEGMAX = ntohs(*reinterpret_cast<uint16_t*>(buf + SEGMAX_OFFSET));     /* Max number of unacknowledged packets other side can buffer */
     conn->snd.SEGBMAX = ntohs(*reinterpret_cast<uint16_t*>(buf + SEGBMAX_OFFSET));   /* Max size segment the other side can handle */
     conn->snd.DACKT = ntohl(*reinterpret_cast<uint32_t*>(buf + DACKT_OFFSET));       /* Delayed ACK timeout from the other side.  */
@@ -1027,65 +1116,96 @@ static void ExpireMessageSnd(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSndBu
     }
 }
 
-static QStatus SendMsgData(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSndBuf* sBuf, uint32_t ttl)
+/*
+ * Send count consecutive data segments starting with sBuf, handing them to
+ * the socket with as few system calls as the platform allows.  On return sent
+ * holds the number of segments that went out and the status describes the
+ * first one that did not.
+ */
+static QStatus SendMsgDataBatch(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSndBuf* sBuf, uint16_t count, uint32_t ttl, uint16_t& sent)
 {
-
-    ArdpHeader* h = (ArdpHeader*) sBuf->hdr;
-    qcc::ScatterGatherList msgSG;
-    uint32_t buf32[ARDP_FIXED_HEADER_LEN >> 2];
+    uint32_t buf32[ARDP_SEND_BATCH][ARDP_FIXED_HEADER_LEN >> 2];
+    qcc::IOVec iov[ARDP_SEND_BATCH][ARDP_SEND_IOVECS];
+    qcc::Datagram dgrams[ARDP_SEND_BATCH];
     uint32_t len;
-    size_t sent;
-    QStatus status;
-
-    QCC_DbgTrace(("SendMsgData(): handle=%p, conn=%p, hdr=%p, data=%p, datalen=%d, ttl=%u, tStart=%u",
-                  handle, conn, sBuf->hdr, sBuf->data, sBuf->datalen, sBuf->ttl, sBuf->tStart));
-
-    msgSG.AddBuffer(&buf32[0], ARDP_FIXED_HEADER_LEN);
-
-    h->ack = htonl(conn->rcv.CUR);
-    h->lcs = htonl(conn->rcv.LCS);
-    h->acknxt = htonl(conn->snd.UNA);
-    h->flags = ARDP_FLAG_ACK | ARDP_FLAG_VER;
-    h->ttl = htonl(ttl);
+    QStatus status = ER_OK;
 
-    QCC_DbgPrintf(("SendMsgData(): seq = %u, ack=%u, lcs = %u, acknxt = %u, ttl=%u", ntohl(h->seq), conn->rcv.CUR, conn->rcv.LCS, conn->snd.UNA, ttl));
+    QCC_DbgTrace(("SendMsgDataBatch(): handle=%p, conn=%p, hdr=%p, data=%p, datalen=%d, count=%u, ttl=%u, tStart=%u",
+                  handle, conn, sBuf->hdr, sBuf->data, sBuf->datalen, count, sBuf->ttl, sBuf->tStart));
+    QCC_ASSERT((count != 0) && (count <= ARDP_SEND_BATCH));
 
     if (conn->rcv.eack.sz == 0 || conn->modeSimple) {
         len = ARDP_FIXED_HEADER_LEN;
     } else {
-        QCC_DbgPrintf(("SendMsgData(): have EACKs"));
-        h->flags |= ARDP_FLAG_EACK;
+        QCC_DbgPrintf(("SendMsgDataBatch(): have EACKs"));
         len = ARDP_FIXED_HEADER_LEN + conn->rcv.eack.fixedSz;
-        msgSG.AddBuffer(conn->rcv.eack.htnMask, conn->rcv.eack.fixedSz);
     }
 
-    /* Safe to type cast since len < 512 */
-    h->hlen = (uint8_t)(len >> 1);
+    for (uint16_t i = 0; i < count; i++, sBuf = sBuf->next) {
+        ArdpHeader* h = (ArdpHeader*) sBuf->hdr;
+        size_t n = 0;
+
+        h->ack = htonl(conn->rcv.CUR);
+        h->lcs = htonl(conn->rcv.LCS);
+        h->acknxt = htonl(conn->snd.UNA);
+        h->flags = ARDP_FLAG_ACK | ARDP_FLAG_VER;
+        h->ttl = htonl(ttl);
+
+        QCC_DbgPrintf(("SendMsgDataBatch(): seq = %u, ack=%u, lcs = %u, acknxt = %u, ttl=%u", ntohl(h->seq), conn->rcv.CUR, conn->rcv.LCS, conn->snd.UNA, ttl));
+
+        iov[i][n].buf = reinterpret_cast<char*>(buf32[i]);
+        iov[i][n++].len = ARDP_FIXED_HEADER_LEN;
+        if (len != ARDP_FIXED_HEADER_LEN) {
+            h->flags |= ARDP_FLAG_EACK;
+            iov[i][n].buf = reinterpret_cast<char*>(conn->rcv.eack.htnMask);
+            iov[i][n++].len = conn->rcv.eack.fixedSz;
+        }
 
-    /* Marshal the header structure into a byte buffer */
-    MarshalHeader(buf32, h);
+        /* Safe to type cast since len < 512 */
+        h->hlen = (uint8_t)(len >> 1);
 
-    /* Add data payload buffer */
-    msgSG.AddBuffer(sBuf->data, sBuf->datalen);
+        /* Marshal the header structure into a byte buffer */
+        MarshalHeader(buf32[i], h);
+
+        /* Add data payload buffer */
+        iov[i][n].buf = reinterpret_cast<char*>(sBuf->data);
+        iov[i][n++].len = sBuf->datalen;
 
 #if ARDP_TESTHOOKS
-    /*
-     * Call the outbound testhook in case the test team needs to munge the
-     * outbound data.
-     */
-    if (handle->th.SendToSG) {
-        handle->th.SendToSG(handle, conn, SEND_MSG_DATA, msgSG);
-    }
+        /*
+         * Call the outbound testhook in case the test team needs to munge the
+         * outbound data.
+         */
+        if (handle->th.SendToSG) {
+            qcc::ScatterGatherList msgSG;
+            for (size_t k = 0; k < n; k++) {
+                msgSG.AddBuffer(iov[i][k].buf, iov[i][k].len);
+            }
+            handle->th.SendToSG(handle, conn, SEND_MSG_DATA, msgSG);
+            n = 0;
+            for (qcc::ScatterGatherList::const_iterator iter = msgSG.Begin(); (iter != msgSG.End()) && (n < ARDP_SEND_IOVECS); ++iter) {
+                iov[i][n++] = *iter;
+            }
+        }
 #endif
+        dgrams[i].iov = iov[i];
+        dgrams[i].iovLen = n;
+    }
 
-    status = qcc::SendToSG(conn->sock, conn->ipAddr, conn->ipPort, msgSG, sent, conn->sndFlags);
+    sent = 0;
+    while ((status == ER_OK) && (sent < count)) {
+        size_t batchSent = 0;
+        status = qcc::SendToBatch(conn->sock, conn->ipAddr, conn->ipPort, &dgrams[sent], count - sent, batchSent, conn->sndFlags);
+        sent += (uint16_t)batchSent;
+    }
 
-    if (status == ER_OK) {
+    if (sent != 0) {
         /* Piggyback ACKs with data. Cancel ACK timer. */
         conn->ackTimer.retry = 0;
         conn->ackPending = 0;
         handle->trafficJam = false;
-    } else if (status == ER_WOULDBLOCK) {
+    }
+    if (status == ER_WOULDBLOCK) {
         handle->trafficJam = true;
     }
     conn->sndFlags = qcc::QCC_MSG_NONE;
@@ -1093,6 +1213,12 @@ static QStatus SendMsgData(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSndBuf*
     return status;
 }
 
+static QStatus SendMsgData(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSndBuf* sBuf, uint32_t ttl)
+{
+    uint16_t sent;
+    return SendMsgDataBatch(handle, conn, sBuf, 1, ttl, sent);
+}
+
 static QStatus Disconnect(ArdpHandle* handle, ArdpConnRecord* conn, QStatus reason)
 {
     QStatus status = ER_OK;
@@ -1377,8 +1503,7 @@ ArdpHandle* ARDP_AllocHandle(ArdpGlobalConfig* config)
 
     srand(qcc::Rand32());
 
-    ArdpHandle* handle = new ArdpHandle;
-    memset(handle, 0, sizeof(ArdpHandle));
+    ArdpHandle* handle = new ArdpHandle();
     SetEmpty(&handle->conns);
     SetEmpty(&handle->dataTimers);
     GetTimeNow(&handle->tbase);
@@ -1657,6 +1782,7 @@ static ArdpConnRecord* NewConnRecord(void)
     } while (conn->id == ARDP_CONN_ID_INVALID);
     QCC_DbgTrace(("NewConnRecord(): conn %p, id %u", conn, conn->id));
     SetEmpty(&conn->list);
+    conn->timerWhen = ARDP_NO_TIMEOUT;
     return conn;
 }
 
@@ -1747,13 +1873,10 @@ static ArdpConnRecord* FindConn(ArdpHandle* handle, uint16_t local, uint16_t for
 {
     QCC_DbgTrace(("FindConn(handle=%p, local=%d, foreign=%d)", handle, local, foreign));
 
-    for (ListNode* ln = &handle->conns; (ln = ln->fwd) != &handle->conns;) {
-        ArdpConnRecord* conn = (ArdpConnRecord*)ln;
-        QCC_DbgPrintf(("FindConn(): conn %p local = %d, foreign = %d", conn, conn->local, conn->foreign));
-        if (conn->local == local && conn->foreign == foreign) {
-            QCC_DbgPrintf(("FindConn(): Found conn %p", conn));
-            return conn;
-        }
+    std::unordered_multimap<uint32_t, ArdpConnRecord*>::const_iterator it = handle->connIndex.find(ConnKey(local, foreign));
+    if (it != handle->connIndex.end()) {
+        QCC_DbgPrintf(("FindConn(): Found conn %p", it->second));
+        return it->second;
     }
     return NULL;
 }
@@ -1826,27 +1949,38 @@ static QStatus SendData(ArdpHandle* handle, ArdpConnRecord* conn, uint8_t* buf,
         }
     }
 
-    for (uint16_t i = 0; i < fcnt; i++) {
-        ArdpHeader* h = (ArdpHeader*) sBuf->hdr;
-        uint16_t segLen = (i == (fcnt - 1)) ? lastLen : conn->snd.maxDlen;
-
-        status = ER_OK;
-
-        QCC_DbgPrintf(("SendData: Segment %d, snd.NXT=%u, snd.UNA=%u", i, conn->snd.NXT, conn->snd.UNA));
-        QCC_ASSERT((conn->snd.NXT - conn->snd.UNA) < conn->snd.SEGMAX);
+    for (uint16_t i = 0; i < fcnt;) {
+        /*
+         * Hand the segments to the socket in batches.  Simple mode decides
+         * segment by segment whether it may send, so there a batch is one
+         * segment.
+         */
+        uint16_t batch = conn->modeSimple ? 1 : MIN(fcnt - i, ARDP_SEND_BATCH);
+        ArdpSndBuf* first = sBuf;
+
+        for (uint16_t j = 0; j < batch; j++) {
+            ArdpHeader* h = (ArdpHeader*) sBuf->hdr;
+            uint16_t segLen = ((i + j) == (fcnt - 1)) ? lastLen : conn->snd.maxDlen;
+
+            QCC_DbgPrintf(("SendData: Segment %d, snd.NXT=%u, snd.UNA=%u", i + j, conn->snd.NXT + j, conn->snd.UNA));
+            QCC_ASSERT((conn->snd.NXT + j - conn->snd.UNA) < conn->snd.SEGMAX);
+
+            h->som = som;
+            h->fcnt = htons(fcnt);
+            h->src = htons(conn->local);
+            h->dst = htons(conn->foreign);;
+            h->dlen = htons(segLen);
+            h->seq = htonl(conn->snd.NXT + j);
+            sBuf->ttl = ttl;
+            sBuf->tStart = now;
+            sBuf->data = segData;
+            sBuf->datalen = segLen;
+            if (h->dst == 0) {
+                QCC_DbgPrintf(("SendData(): destination = 0"));
+            }
 
-        h->som = som;
-        h->fcnt = htons(fcnt);
-        h->src = htons(conn->local);
-        h->dst = htons(conn->foreign);;
-        h->dlen = htons(segLen);
-        h->seq = htonl(conn->snd.NXT);
-        sBuf->ttl = ttl;
-        sBuf->tStart = now;
-        sBuf->data = segData;
-        sBuf->datalen = segLen;
-        if (h->dst == 0) {
-            QCC_DbgPrintf(("SendData(): destination = 0"));
+            segData += segLen;
+            sBuf = sBuf->next;
         }
 
         if ((conn->modeSimple) && ((conn->snd.thinWindow == 0) ||
@@ -1860,9 +1994,10 @@ static QStatus SendData(ArdpHandle* handle, ArdpConnRecord* conn, uint8_t* buf,
                            conn->snd.thinWindow, conn->snd.thinNXT, conn->snd.UNA, conn->snd.thinSEGMAX, sendReady ? "TRUE" : "FALSE"));
         }
 
+        uint16_t sent = 0;
+        QStatus sendStatus = ER_OK;
         if (!handle->trafficJam && sendReady) {
-
-            status = SendMsgData(handle, conn, sBuf, ttlSend);
+            sendStatus = SendMsgDataBatch(handle, conn, first, batch, ttlSend, sent);
             if (conn->rttInit) {
                 timeout = GetRTO(handle, conn);
             } else {
@@ -1870,48 +2005,57 @@ static QStatus SendData(ArdpHandle* handle, ArdpConnRecord* conn, uint8_t* buf,
             }
         }
 
-        /*
-         * If we are unable to write to socket right away, buffer the outbound segments
-         * in retransmit queue.
-         */
-        if (handle->trafficJam || !sendReady) {
-            timeout = 0;
+        sBuf = first;
+        for (uint16_t j = 0; j < batch; j++, i++) {
+            /*
+             * Segments that did not make it out because the socket would
+             * block (or because simple mode holds them back) are buffered in
+             * the retransmit queue with an immediate timeout.  Any other
+             * failure is reported against the first segment that failed.
+             */
+            uint32_t segTimeout = (j < sent) ? timeout : 0;
             status = ER_OK;
-        }
+            if ((j == sent) && (sendStatus != ER_OK) && (sendStatus != ER_WOULDBLOCK)) {
+                status = sendStatus;
+            }
 
-        /*
-         * We update our accounting only if the message has been sent successfully
-         * or has been put on the retransmit queue.
-         */
-        if (status == ER_OK) {
-            sBuf->inUse = true;
-            UpdateTimer(handle, conn, &sBuf->timer, timeout, 1);
+            /*
+             * We update our accounting only if the message has been sent successfully
+             * or has been put on the retransmit queue.
+             */
+            if (status == ER_OK) {
+                sBuf->inUse = true;
+                UpdateTimer(handle, conn, &sBuf->timer, segTimeout, 1);
 
-            if (sendReady) {
-                /* Since we scheduled a valid retransmit timer, cancel active persist timer */
-                QCC_DbgHLPrintf(("Cancel persist timer: handle=%p, conn=%p, id=%u (%d)",
-                                 handle, conn, conn->id, conn->id));
+                if (sendReady) {
+                    /* Since we scheduled a valid retransmit timer, cancel active persist timer */
+                    QCC_DbgHLPrintf(("Cancel persist timer: handle=%p, conn=%p, id=%u (%d)",
+                                     handle, conn, conn->id, conn->id));
 
-                conn->persistTimer.retry = 0;
+                    conn->persistTimer.retry = 0;
 
-                /* Advance NXT counter for in simple mode */
-                if (conn->modeSimple) {
-                    conn->snd.thinNXT++;
+                    /* Advance NXT counter for in simple mode */
+                    if (conn->modeSimple) {
+                        conn->snd.thinNXT++;
+                    }
                 }
+
+                EnList(handle->dataTimers.bwd, (ListNode*) &sBuf->timer);
+                conn->snd.pending++;
+                QCC_ASSERT(((conn->snd.pending) <= conn->snd.SEGMAX) && "Number of pending segments in send queue exceeds MAX!");
+                conn->snd.NXT++;
+            } else {
+                /* Something irrevocably bad happened on the socket. Disconnect. */
+                Disconnect(handle, conn, status);
+                break;
             }
 
-            EnList(handle->dataTimers.bwd, (ListNode*) &sBuf->timer);
-            conn->snd.pending++;
-            QCC_ASSERT(((conn->snd.pending) <= conn->snd.SEGMAX) && "Number of pending segments in send queue exceeds MAX!");
-            conn->snd.NXT++;
-        } else {
-            /* Something irrevocably bad happened on the socket. Disconnect. */
-            Disconnect(handle, conn, status);
-            break;
+            sBuf = sBuf->next;
         }
 
-        segData += segLen;
-        sBuf = sBuf->next;
+        if (status != ER_OK) {
+            break;
+        }
     }
 
     return status;
@@ -2728,7 +2872,7 @@ static void ArdpMachine(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSeg* seg,
                 ++handle->stats.synRecvs;
 #endif
 
-                UnmarshalSynSegment(conn, buf, seg);
+                UnmarshalSynSegment(handle, conn, buf, seg);
 
                 QCC_DbgPrintf(("ArdpMachine(): LISTEN: SYN received: the other side can receive max %d bytes", conn->snd.SEGBMAX));
                 if (handle->cb.AcceptCb != NULL) {
@@ -2780,7 +2924,7 @@ static void ArdpMachine(ArdpHandle* handle, ArdpConnRecord* conn, ArdpSeg* seg,
 #if ARDP_STATS
                 ++handle->stats.synRecvs;
 #endif
-                UnmarshalSynSegment(conn, buf, seg);
+                UnmarshalSynSegment(handle, conn, buf, seg);
 
                 status = InitSnd(handle, conn);
 
@@ -3172,7 +3316,7 @@ QStatus ARDP_Connect(ArdpHandle* handle, qcc::SocketFd sock, qcc::IPAddress ipAd
     if (status == ER_OK) {
         conn->context = context;
         conn->passive = false;
-        EnList(handle->conns.bwd, (ListNode*)conn);
+        AddConnRecord(handle, conn);
         status = SendSyn(handle, conn, buf, len);
     }
 
@@ -3425,14 +3569,89 @@ static bool IsDuplicateConnRequest(ArdpHandle* handle, uint16_t foreign, qcc::IP
     return false;
 }
 
+static QStatus ReceiveDatagram(ArdpHandle* handle, qcc::SocketFd sock, bool sockAccepts, uint8_t* buf, size_t nbytes,
+                               qcc::IPAddress& address, uint16_t port)
+{
+    QStatus status = ER_OK;
+
+#if ARDP_TESTHOOKS
+    /*
+     * Call the inbound testhook in case the test team needs to munge the
+     * inbound data.
+     */
+    if (handle->th.RecvFrom) {
+        handle->th.RecvFrom(handle, NULL, ARDP_RUN, buf, nbytes);
+    }
+#endif
+
+    uint16_t local, foreign;
+    ProtocolDemux(buf, nbytes, &local, &foreign);
+    if (local == 0) {
+        if (sockAccepts && handle->accepting && handle->cb.AcceptCb) {
+            if (!IsDuplicateConnRequest(handle, foreign, address)) {
+                ArdpConnRecord* conn = NewConnRecord();
+                status = InitConnRecord(handle, conn, sock, address, port, foreign);
+                if (status == ER_OK) {
+                    AddConnRecord(handle, conn);
+                    status = Accept(handle, conn, buf, nbytes);
+                }
+                if (status != ER_OK) {
+                    SetState(conn, CLOSED);
+                    DelConnRecord(handle, conn, false);
+                }
+            } /*
+               * Else the remote most likely timed out waiting for our SYN_ACK.
+               * We should rely on local connection retry mechanism to kick in
+               * and eventually establish the connection.
+               */
+
+        } else {
+            if (sockAccepts == false) {
+                QCC_LogError(status, ("Attempt to connect to non-accepting sock %d", sock));
+            }
+            status = ER_ARDP_INVALID_STATE;
+        }
+        if (status != ER_OK) {
+            QCC_LogError(status, ("Failed to accept incoming connection request from %s (ARDP port %u)", address.ToString().c_str(), foreign));
+            SendRst(handle, sock, address, port, local, foreign);
+        }
+    } else {
+        /* Is there an open connection? */
+        ArdpConnRecord* conn = FindConn(handle, local, foreign);
+        if (!conn) {
+            /* Is there a half open connection? */
+            conn = FindConn(handle, local, 0);
+        }
+
+        if (conn) {
+            if ((conn->state != CLOSED) && (conn->state != CLOSE_WAIT)) {
+                QCC_DbgHLPrintf(("ARDP_Run conn state %s", State2Text(conn->state)));
+                conn->lastSeen = TimeNow(handle->tbase);
+                conn->probeTimer.retry = handle->config.keepaliveRetries;
+                status = Receive(handle, conn, buf, nbytes);
+                if (status == ER_ARDP_INVALID_RESPONSE) {
+                    Disconnect(handle, conn, status);
+                }
+            } else {
+                uint8_t flags = *reinterpret_cast<uint8_t*>(buf + FLAGS_OFFSET);
+                /* Only send repeat RST if this is a NUL segment.
+                 * This is done to alleviate a situation when original RST has not reached
+                 * the remote. This can potentially cause the remote to keep the link
+                 * alive (sending pings and retransmit data) until it hits probe timeout
+                 */
+                if (flags & ARDP_FLAG_NUL) {
+                    SendRst(handle, sock, address, port, local, foreign);
+                }
+            }
+        }
+    }
+
+    return status;
+}
+
 QStatus ARDP_Run(ArdpHandle* handle, qcc::SocketFd sock, bool sockRead, bool sockWrite, bool sockAccepts, uint32_t* ms)
 {
     const size_t bufferSize = 65536;      /* UDP packet can be up to 64K long */
-    uint32_t buf32[bufferSize >> 2];
-    uint8_t* buf = reinterpret_cast<uint8_t*>(buf32);
-    qcc::IPAddress address;               /* The IP address of the foreign side */
-    uint16_t port = 0;                    /* Will be the UDP port of the foreign side */
-    size_t nbytes;                        /* The number of bytes actually received */
     QStatus status = ER_OK;
 
     QCC_DbgTrace(("ARDP_Run(handle=%p, sock=%d, socketRead=%d, socketWrite=%d, ms=%p, sockAccepts: %s)",
@@ -3442,82 +3661,36 @@ QStatus ARDP_Run(ArdpHandle* handle, qcc::SocketFd sock, bool sockRead, bool soc
     }
 
     if (sockRead) {
-        while ((status = qcc::RecvFrom(sock, address, port, buf, bufferSize, nbytes)) == ER_OK) {
-#if ARDP_TESTHOOKS
-            /*
-             * Call the inbound testhook in case the test team needs to munge the
-             * inbound data.
-             */
-            if (handle->th.RecvFrom) {
-                handle->th.RecvFrom(handle, NULL, ARDP_RUN, buf, nbytes);
-            }
-#endif
-
-            if (nbytes > 0 && nbytes < 65536) {
-                uint16_t local, foreign;
-                ProtocolDemux(buf, nbytes, &local, &foreign);
-                if (local == 0) {
-                    if (sockAccepts && handle->accepting && handle->cb.AcceptCb) {
-                        if (!IsDuplicateConnRequest(handle, foreign, address)) {
-                            ArdpConnRecord* conn = NewConnRecord();
-                            status = InitConnRecord(handle, conn, sock, address, port, foreign);
-                            if (status == ER_OK) {
-                                EnList(handle->conns.bwd, (ListNode*)conn);
-                                status = Accept(handle, conn, buf, nbytes);
-                            }
-                            if (status != ER_OK) {
-                                SetState(conn, CLOSED);
-                                DelConnRecord(handle, conn, false);
-                            }
-                        } /*
-                           * Else the remote most likely timed out waiting for our SYN_ACK.
-                           * We should rely on local connection retry mechanism to kick in
-                           * and eventually establish the connection.
-                           */
+        if (handle->rxBatch.empty()) {
+            handle->rxBatch.resize(ARDP_RECV_BATCH * (bufferSize >> 2));
+        }
+        qcc::IOVec iov[ARDP_RECV_BATCH];
+        qcc::Datagram dgrams[ARDP_RECV_BATCH];
+        for (size_t i = 0; i < ARDP_RECV_BATCH; ++i) {
+            iov[i].buf = reinterpret_cast<char*>(&handle->rxBatch[i * (bufferSize >> 2)]);
+            iov[i].len = bufferSize;
+            dgrams[i].iov = &iov[i];
+            dgrams[i].iovLen = 1;
+        }
 
-                    } else {
-                        if (sockAccepts == false) {
-                            QCC_LogError(status, ("Attempt to connect to non-accepting sock %d", sock));
-                        }
-                        status = ER_ARDP_INVALID_STATE;
-                    }
-                    if (status != ER_OK) {
-                        QCC_LogError(status, ("Failed to accept incoming connection request from %s (ARDP port %u)", address.ToString().c_str(), foreign));
-                        SendRst(handle, sock, address, port, local, foreign);
-                    }
+        /*
+         * Drain the socket a batch at a time.  A short batch means the socket
+         * had nothing more queued, so there is no point asking again.
+         */
+        size_t count = ARDP_RECV_BATCH;
+        bool readFailed = false;
+        while (!readFailed && (count == ARDP_RECV_BATCH) &&
+               (status = qcc::RecvFromBatch(sock, dgrams, ARDP_RECV_BATCH, count)) == ER_OK) {
+            for (size_t i = 0; i < count; ++i) {
+                size_t nbytes = dgrams[i].len;   /* The number of bytes actually received */
+                if (nbytes > 0 && nbytes < bufferSize) {
+                    status = ReceiveDatagram(handle, sock, sockAccepts, reinterpret_cast<uint8_t*>(iov[i].buf), nbytes,
+                                             dgrams[i].addr, dgrams[i].port);
                 } else {
-                    /* Is there an open connection? */
-                    ArdpConnRecord* conn = FindConn(handle, local, foreign);
-                    if (!conn) {
-                        /* Is there a half open connection? */
-                        conn = FindConn(handle, local, 0);
-                    }
-
-                    if (conn) {
-                        if ((conn->state != CLOSED) && (conn->state != CLOSE_WAIT)) {
-                            QCC_DbgHLPrintf(("ARDP_Run conn state %s", State2Text(conn->state)));
-                            conn->lastSeen = TimeNow(handle->tbase);
-                            conn->probeTimer.retry = handle->config.keepaliveRetries;
-                            status = Receive(handle, conn, buf, nbytes);
-                            if (status == ER_ARDP_INVALID_RESPONSE) {
-                                Disconnect(handle, conn, status);
-                            }
-                        } else {
-                            uint8_t flags = *reinterpret_cast<uint8_t*>(buf + FLAGS_OFFSET);
-                            /* Only send repeat RST if this is a NUL segment.
-                             * This is done to alleviate a situation when original RST has not reached
-                             * the remote. This can potentially cause the remote to keep the link
-                             * alive (sending pings and retransmit data) until it hits probe timeout
-                             */
-                            if (flags & ARDP_FLAG_NUL) {
-                                SendRst(handle, sock, address, port, local, foreign);
-                            }
-                        }
-                    }
+                    QCC_DbgHLPrintf(("ARDP_Run(): Socket read failed (nbytes = %d)", nbytes));
+                    readFailed = true;
+                    break;
                 }
-            } else {
-                QCC_DbgHLPrintf(("ARDP_Run(): Socket read failed (nbytes = %d)", nbytes));
-                break;
             }
         }
     }
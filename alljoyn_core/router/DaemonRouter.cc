@@ -65,6 +65,7 @@ namespace ajn {
 
 DaemonRouter::DaemonRouter()
     : ruleTable(), nameTable(), busController(NULL), alljoynObj(NULL), sessionlessObj(NULL),
+    useRuleIndex(ConfigDB::GetConfigDB()->GetLimit("rule_index", 1) != 0),
     m_Lock(LOCK_LEVEL_DAEMONROUTER_MLOCK)
 {
 #ifdef ENABLE_POLICYDB
@@ -338,6 +339,8 @@ QStatus DaemonRouter::PushMessage(Message& msg, BusEndpoint& src)
 
     vector<BusEndpoint> allEps;
     set<BusEndpoint> destEps;
+    set<BusEndpoint> ruleMatchEps;
+    ParsedMessage parsedMsg(msg);
     set<String> skippedEndpoints;
 
     bool blocked = false;
@@ -365,6 +368,15 @@ QStatus DaemonRouter::PushMessage(Message& msg, BusEndpoint& src)
          * system.
          */
         nameTable.GetAllBusEndpoints(allEps);
+
+        /*
+         * Find the endpoints with a match rule for broadcast messages up front
+         * so that the rule table is consulted once per message rather than
+         * once per endpoint.
+         */
+        if (isBroadcast && useRuleIndex) {
+            ruleTable.GetMatchingEndpoints(msg, ruleMatchEps);
+        }
     }
 
     if (!isUnicast || allEps.empty()) {
@@ -486,11 +498,12 @@ QStatus DaemonRouter::PushMessage(Message& msg, BusEndpoint& src)
          *               Can we deprecate the GlobalBroadcast flag?
          */
         add = add && (!isBroadcast || ((msgIsGlobalBroadcast && destIsB2b && (src != dest)) ||
-                                       ruleTable.OkToSend(msg, dest)));
+                                       (useRuleIndex ? (ruleMatchEps.find(dest) != ruleMatchEps.end()) :
+                                        ruleTable.OkToSend(parsedMsg, dest))));
         if (isBroadcast) {
             QCC_DbgPrintf(("    broadcast src = %s   dest = %s   global bcast = %d   dest epType = %d   ruleTable.OkToSend() => %d   add = %d",
                            src->GetUniqueName().c_str(), dest->GetUniqueName().c_str(),
-                           msgIsGlobalBroadcast, dest->GetEndpointType(), ruleTable.OkToSend(msg, dest), add));
+                           msgIsGlobalBroadcast, dest->GetEndpointType(), ruleTable.OkToSend(parsedMsg, dest), add));
         }
 
         add = add && (!isSessioncast || IsSessionDeliverable(sessionId, src, dest));
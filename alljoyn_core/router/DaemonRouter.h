@@ -380,6 +380,16 @@ class DaemonRouter : public Router {
      */
     RuleTable& GetRuleTable() { return ruleTable; }
 
+    /**
+     * Select how broadcast messages are matched against the rule table.
+     * The rule index is used by default.  The linear per-endpoint scan is
+     * kept for comparison and can also be selected with the "rule_index"
+     * config limit set to 0.
+     *
+     * @param enable   true to use the rule index, false for the linear scan.
+     */
+    void EnableRuleIndex(bool enable) { useRuleIndex = enable; }
+
 
     void RegisterSelfJoin(qcc::String epName, SessionId id) {
         m_Lock.Lock(MUTEX_CONTEXT);
@@ -402,6 +412,7 @@ class DaemonRouter : public Router {
     BusController* busController;         /**< The bus controller used with this router */
     AllJoynObj* alljoynObj;               /**< AllJoyn bus object used with this router */
     SessionlessObj* sessionlessObj;       /**< Sessionless bus object used with this router */
+    bool useRuleIndex;                    /**< Match broadcasts with the rule index rather than per endpoint */
 
     std::set<RemoteEndpoint> m_b2bEndpoints; /**< Collection of Bus-to-bus endpoints */
 
@@ -86,6 +86,10 @@ QStatus DaemonTransport::Start()
     m_maxHbeatProbeTimeout = config->GetLimit("dt_max_probe_timeout", MAX_HEARTBEAT_PROBE_TIMEOUT_DEFAULT);
     m_defaultHbeatProbeTimeout = config->GetLimit("dt_default_probe_timeout", DEFAULT_HEARTBEAT_PROBE_TIMEOUT_DEFAULT);
 
+    m_maxTxQueue = config->GetLimit("dt_max_tx_queue", MAX_TX_QUEUE_DEFAULT);
+    m_maxTxQueueBytes = config->GetLimit("dt_max_tx_queue_bytes", MAX_TX_QUEUE_BYTES_DEFAULT);
+    m_maxTxBatch = config->GetLimit("dt_max_tx_batch", MAX_TX_BATCH_DEFAULT);
+
     QCC_DbgPrintf(("DaemonTransport: Using m_minHbeatIdleTimeout=%u, m_maxHbeatIdleTimeout=%u, m_numHbeatProbes=%u, m_defaultHbeatProbeTimeout=%u m_maxHbeatProbeTimeout=%u", m_minHbeatIdleTimeout, m_maxHbeatIdleTimeout, m_numHbeatProbes, m_defaultHbeatProbeTimeout, m_maxHbeatProbeTimeout));
 
     return ER_OK;
@@ -213,6 +213,18 @@ class DaemonTransport : public Transport, public _RemoteEndpoint::EndpointListen
      */
     static const uint32_t HEARTBEAT_NUM_PROBES = 1;
 
+    /**
+     * @brief The default transmit queue limits for DaemonTransport endpoints.
+     *
+     * These correspond to the configuration items "dt_max_tx_queue",
+     * "dt_max_tx_queue_bytes" and "dt_max_tx_batch".
+     * To override these values, change the limits "dt_max_tx_queue",
+     * "dt_max_tx_queue_bytes" and "dt_max_tx_batch"
+     */
+    static const uint32_t MAX_TX_QUEUE_DEFAULT = 16;
+    static const uint32_t MAX_TX_QUEUE_BYTES_DEFAULT = 256 * 1024;
+    static const uint32_t MAX_TX_BATCH_DEFAULT = 16;
+
     /**
      * Empty private overloaded virtual function for Thread::Start
      * this avoids the overloaded-virtual warning. For the Thread::Start
@@ -248,6 +260,15 @@ class DaemonTransport : public Transport, public _RemoteEndpoint::EndpointListen
     uint32_t m_numHbeatProbes;             /**< Number of probes Routing node should wait for Heartbeat response to be
                                               recieved from the Leaf node before declaring it dead - Transport specific */
 
+    uint32_t m_maxTxQueue;                 /**< Number of data messages that can be queued for an endpoint before the
+                                              sender blocks - configurable in router config */
+
+    uint32_t m_maxTxQueueBytes;            /**< Number of bytes of data messages that can be queued for an endpoint
+                                              before the sender blocks - configurable in router config */
+
+    uint32_t m_maxTxBatch;                 /**< Maximum number of queued messages written to an endpoint with a
+                                              single write - configurable in router config */
+
 };
 
 } // namespace ajn
@@ -0,0 +1,285 @@
+/**
+ * @file
+ * NameMatcher is a prefix trie of bus names or name patterns that answers
+ * WildcardMatch() queries against the whole set in a single walk.
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#include <qcc/platform.h>
+
+#include <vector>
+
+#include "NameMatcher.h"
+
+using namespace std;
+using namespace qcc;
+
+namespace ajn {
+
+NameMatcher::Node::~Node()
+{
+    for (map<char, Node*>::iterator it = children.begin(); it != children.end(); ++it) {
+        delete it->second;
+    }
+}
+
+NameMatcher::NameMatcher()
+{
+}
+
+NameMatcher::~NameMatcher()
+{
+}
+
+void NameMatcher::Add(const String& entry)
+{
+    if (entry.empty()) {
+        return;
+    }
+    Node* node = &root;
+    for (String::const_iterator c = entry.begin(); c != entry.end(); ++c) {
+        Node*& child = node->children[*c];
+        if (!child) {
+            child = new Node();
+        }
+        node = child;
+    }
+    if (node->refs++ == 0) {
+        node->entry = entry;
+    }
+}
+
+void NameMatcher::Remove(const String& entry)
+{
+    if (entry.empty()) {
+        return;
+    }
+    vector<Node*> path;
+    path.reserve(entry.size() + 1);
+    Node* node = &root;
+    path.push_back(node);
+    for (String::const_iterator c = entry.begin(); c != entry.end(); ++c) {
+        map<char, Node*>::iterator it = node->children.find(*c);
+        if (it == node->children.end()) {
+            return;
+        }
+        node = it->second;
+        path.push_back(node);
+    }
+    if ((node->refs == 0) || (--node->refs != 0)) {
+        return;
+    }
+    node->entry.clear();
+
+    /* Prune the branch that no longer leads to an entry */
+    for (size_t i = entry.size(); i > 0; --i) {
+        Node* n = path[i];
+        if ((n->refs != 0) || !n->children.empty()) {
+            break;
+        }
+        path[i - 1]->children.erase(entry[i - 1]);
+        delete n;
+    }
+}
+
+void NameMatcher::Clear()
+{
+    for (map<char, Node*>::iterator it = root.children.begin(); it != root.children.end(); ++it) {
+        delete it->second;
+    }
+    root.children.clear();
+    root.refs = 0;
+}
+
+void NameMatcher::MatchPattern(const String& pattern, set<String>& matches) const
+{
+    if (!pattern.empty()) {
+        PatternWalk(root, pattern.c_str(), 0, pattern.size(), &matches);
+    }
+}
+
+bool NameMatcher::AnyMatchPattern(const String& pattern) const
+{
+    if (pattern.empty()) {
+        return false;
+    }
+    return PatternWalk(root, pattern.c_str(), 0, pattern.size(), NULL);
+}
+
+void NameMatcher::MatchName(const String& name, set<String>& matches) const
+{
+    if (!name.empty()) {
+        NameWalk(root, name.c_str(), 0, name.size(), matches);
+    }
+}
+
+/*
+ * The walks below follow WildcardMatch() step for step.  In PatternWalk() the
+ * entries are the strings and the depth of node is the string index; in
+ * NameWalk() the entries are the patterns and the depth of node is the
+ * pattern index.  When matches is NULL the walks stop at the first match.
+ */
+bool NameMatcher::PatternWalk(const Node& node, const char* pattern, size_t pi, size_t patsize, set<String>* matches)
+{
+    /*
+     * An entry ending here has run out of characters.  It matches if the
+     * pattern has run out too or if the next pattern character is a '*'.
+     */
+    if (node.refs && ((pi == patsize) || (pattern[pi] == '*'))) {
+        if (!matches) {
+            return true;
+        }
+        matches->insert(node.entry);
+    }
+    if (pi == patsize) {
+        return false;
+    }
+
+    switch (pattern[pi]) {
+    case '*':
+        /* A trailing wildcard matches whatever remains of the entry */
+        if (pi + 1 == patsize) {
+            return CollectBelow(node, matches);
+        }
+        /* WildcardMatch() does not handle a wildcard following a wildcard */
+        if ((pattern[pi + 1] == '*') || (pattern[pi + 1] == '?')) {
+            return false;
+        }
+        return PatternScan(node, pattern[pi + 1], pattern, pi + 2, patsize, matches);
+
+    case '?':
+        for (map<char, Node*>::const_iterator it = node.children.begin(); it != node.children.end(); ++it) {
+            if (PatternWalk(*it->second, pattern, pi + 1, patsize, matches) && !matches) {
+                return true;
+            }
+        }
+        return false;
+
+    default:
+        {
+            map<char, Node*>::const_iterator it = node.children.find(pattern[pi]);
+            if (it == node.children.end()) {
+                return false;
+            }
+            return PatternWalk(*it->second, pattern, pi + 1, patsize, matches);
+        }
+    }
+}
+
+bool NameMatcher::PatternScan(const Node& node, char next, const char* pattern, size_t pi, size_t patsize, set<String>* matches)
+{
+    /*
+     * Each entry below node skips ahead to its first occurrence of next and
+     * carries on matching from there.  Entries that end first do not match.
+     */
+    for (map<char, Node*>::const_iterator it = node.children.begin(); it != node.children.end(); ++it) {
+        bool found;
+        if (it->first == next) {
+            found = PatternWalk(*it->second, pattern, pi, patsize, matches);
+        } else {
+            found = PatternScan(*it->second, next, pattern, pi, patsize, matches);
+        }
+        if (found && !matches) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NameMatcher::CollectBelow(const Node& node, set<String>* matches)
+{
+    for (map<char, Node*>::const_iterator it = node.children.begin(); it != node.children.end(); ++it) {
+        if (it->second->refs) {
+            if (!matches) {
+                return true;
+            }
+            matches->insert(it->second->entry);
+        }
+        if (CollectBelow(*it->second, matches) && !matches) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void NameMatcher::NameWalk(const Node& node, const char* name, size_t si, size_t strsize, set<String>& matches)
+{
+    if (si == strsize) {
+        /*
+         * The name has run out.  Patterns ending here match, as does every
+         * pattern whose next character is a '*'.
+         */
+        if (node.refs) {
+            matches.insert(node.entry);
+        }
+        map<char, Node*>::const_iterator star = node.children.find('*');
+        if (star != node.children.end()) {
+            Collect(*star->second, matches);
+        }
+        return;
+    }
+
+    for (map<char, Node*>::const_iterator it = node.children.begin(); it != node.children.end(); ++it) {
+        const Node& child = *it->second;
+        if (it->first == '*') {
+            /* A trailing wildcard matches whatever remains of the name */
+            if (child.refs) {
+                matches.insert(child.entry);
+            }
+            for (map<char, Node*>::const_iterator next = child.children.begin(); next != child.children.end(); ++next) {
+                /* WildcardMatch() does not handle a wildcard following a wildcard */
+                if ((next->first == '*') || (next->first == '?')) {
+                    continue;
+                }
+                for (size_t k = si; k < strsize; ++k) {
+                    if (name[k] == next->first) {
+                        NameWalk(*next->second, name, k + 1, strsize, matches);
+                        break;
+                    }
+                }
+            }
+        } else if ((it->first == '?') || (it->first == name[si])) {
+            NameWalk(child, name, si + 1, strsize, matches);
+        }
+    }
+}
+
+void NameMatcher::Collect(const Node& node, set<String>& matches)
+{
+    if (node.refs) {
+        matches.insert(node.entry);
+    }
+    for (map<char, Node*>::const_iterator it = node.children.begin(); it != node.children.end(); ++it) {
+        Collect(*it->second, matches);
+    }
+}
+
+}
@@ -0,0 +1,149 @@
+/**
+ * @file
+ * NameMatcher is a prefix trie of bus names or name patterns that answers
+ * WildcardMatch() queries against the whole set in a single walk.
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef _ALLJOYN_NAMEMATCHER_H
+#define _ALLJOYN_NAMEMATCHER_H
+
+#include <qcc/platform.h>
+#include <qcc/String.h>
+
+#include <map>
+#include <set>
+
+namespace ajn {
+
+/**
+ * A compiled set of bus names or name patterns.
+ *
+ * Entries are stored in a prefix trie in which '*' and '?' are ordinary edges,
+ * so a query walks only the branches that can match instead of calling
+ * WildcardMatch() once per entry.  Query results are exactly those of
+ * WildcardMatch(), including its non-backtracking handling of '*'.
+ *
+ * Entries are reference counted so that the same name or pattern may be added
+ * more than once.  NameMatcher is not thread-safe; callers are expected to
+ * protect it with the same lock that protects the set it mirrors.
+ */
+class NameMatcher {
+  public:
+
+    /**
+     * Constructor.
+     */
+    NameMatcher();
+
+    /**
+     * Destructor.
+     */
+    ~NameMatcher();
+
+    /**
+     * Add a reference to a name or pattern.  Empty strings are ignored since
+     * they can never match.
+     *
+     * @param entry  The name or pattern to add.
+     */
+    void Add(const qcc::String& entry);
+
+    /**
+     * Drop a reference to a name or pattern previously added with Add().
+     *
+     * @param entry  The name or pattern to remove.
+     */
+    void Remove(const qcc::String& entry);
+
+    /**
+     * Remove all entries.
+     */
+    void Clear();
+
+    /**
+     * @return true if there are no entries.
+     */
+    bool Empty() const { return root.children.empty() && (root.refs == 0); }
+
+    /**
+     * Find the entries (treated as names) that are matched by a pattern, that
+     * is every entry for which WildcardMatch(entry, pattern) is false.
+     *
+     * @param pattern  The pattern to match the entries against.
+     * @param matches  Matching entries are added to this set.
+     */
+    void MatchPattern(const qcc::String& pattern, std::set<qcc::String>& matches) const;
+
+    /**
+     * Test whether any entry (treated as a name) is matched by a pattern.
+     *
+     * @param pattern  The pattern to match the entries against.
+     *
+     * @return true if at least one entry matches.
+     */
+    bool AnyMatchPattern(const qcc::String& pattern) const;
+
+    /**
+     * Find the entries (treated as patterns) that match a name, that is every
+     * entry for which WildcardMatch(name, entry) is false.
+     *
+     * @param name     The name to match against the entries.
+     * @param matches  Matching entries are added to this set.
+     */
+    void MatchName(const qcc::String& name, std::set<qcc::String>& matches) const;
+
+  private:
+
+    /* Private copy constructor and assignment operator to prevent copying */
+    NameMatcher(const NameMatcher& other);
+    NameMatcher& operator=(const NameMatcher& other);
+
+    struct Node {
+        std::map<char, Node*> children;
+        qcc::String entry;     /**< The entry ending at this node, if refs != 0 */
+        uint32_t refs;         /**< Number of times entry has been added */
+
+        Node() : refs(0) { }
+        ~Node();
+    };
+
+    static bool PatternWalk(const Node& node, const char* pattern, size_t pi, size_t patsize, std::set<qcc::String>* matches);
+    static bool PatternScan(const Node& node, char next, const char* pattern, size_t pi, size_t patsize, std::set<qcc::String>* matches);
+    static bool CollectBelow(const Node& node, std::set<qcc::String>* matches);
+    static void NameWalk(const Node& node, const char* name, size_t si, size_t strsize, std::set<qcc::String>& matches);
+    static void Collect(const Node& node, std::set<qcc::String>& matches);
+
+    Node root;
+};
+
+}
+
+#endif
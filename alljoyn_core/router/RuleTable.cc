@@ -41,6 +41,7 @@
 
 #include <qcc/Debug.h>
 #include <qcc/String.h>
+#include <qcc/Util.h>
 
 #define QCC_MODULE "ALLJOYN"
 
@@ -49,11 +50,66 @@ using namespace qcc;
 
 namespace ajn {
 
+/*
+ * Return the rule index field (in RuleTable::IndexField order) that a rule is
+ * filed under and the key it is filed with.  Interface comes first since
+ * nearly every signal match rule specifies one.  Returns the number of
+ * indexed fields if the rule belongs in the wildcard index.
+ */
+static size_t GetIndexField(const Rule& rule, const qcc::String*& key)
+{
+    const qcc::String* fields[] = { &rule.iface, &rule.member, &rule.path, &rule.sender };
+    for (size_t i = 0; i < ArraySize(fields); ++i) {
+        if (!fields[i]->empty()) {
+            key = fields[i];
+            return i;
+        }
+    }
+    key = NULL;
+    return ArraySize(fields);
+}
+
+void RuleTable::IndexRule(const RuleIterator& it)
+{
+    const qcc::String* key;
+    size_t field = GetIndexField(it->second, key);
+    if (field < INDEX_NUM_FIELDS) {
+        ruleIndex[field].insert(RuleIndex::value_type(key->c_str(), it));
+    } else {
+        wildcardIndex.insert(WildcardIndex::value_type(it->second.type, it));
+    }
+}
+
+void RuleTable::UnindexRule(const RuleIterator& it)
+{
+    const qcc::String* key;
+    size_t field = GetIndexField(it->second, key);
+    if (field < INDEX_NUM_FIELDS) {
+        std::pair<RuleIndex::iterator, RuleIndex::iterator> range = ruleIndex[field].equal_range(key->c_str());
+        for (RuleIndex::iterator iit = range.first; iit != range.second; ++iit) {
+            if (iit->second == it) {
+                ruleIndex[field].erase(iit);
+                return;
+            }
+        }
+    } else {
+        std::pair<WildcardIndex::iterator, WildcardIndex::iterator> range = wildcardIndex.equal_range(it->second.type);
+        for (WildcardIndex::iterator wit = range.first; wit != range.second; ++wit) {
+            if (wit->second == it) {
+                wildcardIndex.erase(wit);
+                return;
+            }
+        }
+    }
+    QCC_LogError(ER_FAIL, ("Rule for endpoint %s missing from rule index", it->first->GetUniqueName().c_str()));
+}
+
 QStatus RuleTable::AddRule(BusEndpoint& endpoint, const Rule& rule)
 {
     QCC_DbgPrintf(("AddRule for endpoint %s\n  %s", endpoint->GetUniqueName().c_str(), rule.ToString().c_str()));
     lock.Lock(MUTEX_CONTEXT);
-    rules.insert(std::pair<BusEndpoint, Rule>(endpoint, rule));
+    RuleIterator it = rules.insert(std::pair<BusEndpoint, Rule>(endpoint, rule));
+    IndexRule(it);
     lock.Unlock(MUTEX_CONTEXT);
     return ER_OK;
 }
@@ -65,9 +121,8 @@ QStatus RuleTable::RemoveRule(BusEndpoint& endpoint, Rule& rule)
     std::pair<RuleIterator, RuleIterator> range = rules.equal_range(endpoint);
     while (range.first != range.second) {
         if (range.first->second == rule) {
-            const RuleIterator begin = range.first;
-            const RuleIterator end = ++range.first;
-            rules.erase(begin, end);
+            UnindexRule(range.first);
+            rules.erase(range.first);
             status = ER_OK;
             break;
         }
@@ -81,20 +136,34 @@ QStatus RuleTable::RemoveAllRules(BusEndpoint& endpoint)
 {
     lock.Lock(MUTEX_CONTEXT);
     std::pair<RuleIterator, RuleIterator> range = rules.equal_range(endpoint);
-    if (range.first != rules.end()) {
-        rules.erase(range.first, range.second);
+    for (RuleIterator it = range.first; it != range.second; ++it) {
+        UnindexRule(it);
     }
+    rules.erase(range.first, range.second);
     lock.Unlock(MUTEX_CONTEXT);
     return ER_OK;
 }
 
 bool RuleTable::OkToSend(const Message& msg, BusEndpoint& endpoint) const
 {
-    bool match = false;
+    ParsedMessage parsed(msg);
+    return OkToSend(parsed, endpoint);
+}
+
+bool RuleTable::OkToSend(ParsedMessage& parsed, BusEndpoint& endpoint) const
+{
     lock.Lock(MUTEX_CONTEXT);
+    bool match = OkToSendLocked(parsed, endpoint);
+    lock.Unlock(MUTEX_CONTEXT);
+    return match;
+}
+
+bool RuleTable::OkToSendLocked(ParsedMessage& parsed, const BusEndpoint& endpoint) const
+{
+    bool match = false;
     pair<RuleConstIterator, RuleConstIterator> range = rules.equal_range(endpoint);
     for (RuleConstIterator it = range.first; !match && (it != range.second); ++it) {
-        match = it->second.IsMatch(msg);
+        match = it->second.IsMatch(parsed);
 
         /*
          * This little hack is to make DaemonRouter::PushMessage() work with the
@@ -115,9 +184,71 @@ bool RuleTable::OkToSend(const Message& msg, BusEndpoint& endpoint) const
             break;
         }
     }
-    lock.Unlock(MUTEX_CONTEXT);
     return match;
 }
 
+void RuleTable::MatchIndexedRules(ParsedMessage& parsed, IndexField field, const char* key, std::set<BusEndpoint>& endpoints) const
+{
+    std::pair<RuleIndex::const_iterator, RuleIndex::const_iterator> range = ruleIndex[field].equal_range(key);
+    for (RuleIndex::const_iterator it = range.first; it != range.second; ++it) {
+        const RuleIterator& rit = it->second;
+        if ((endpoints.find(rit->first) == endpoints.end()) && rit->second.IsMatch(parsed)) {
+            endpoints.insert(rit->first);
+        }
+    }
+}
+
+void RuleTable::GetMatchingEndpoints(const Message& msg, std::set<BusEndpoint>& endpoints) const
+{
+    endpoints.clear();
+    ParsedMessage parsed(msg);
+    lock.Lock(MUTEX_CONTEXT);
+
+    /*
+     * A rule can only match if its indexed field equals the corresponding
+     * field of the message so those are the only buckets that need to be
+     * checked.  Empty message fields never match an indexed rule.
+     */
+    const char* keys[INDEX_NUM_FIELDS];
+    keys[INDEX_IFACE] = msg->GetInterface();
+    keys[INDEX_MEMBER] = msg->GetMemberName();
+    keys[INDEX_PATH] = msg->GetObjectPath();
+    keys[INDEX_SENDER] = msg->GetSender();
+    for (size_t field = 0; field < INDEX_NUM_FIELDS; ++field) {
+        if (keys[field][0] && !ruleIndex[field].empty()) {
+            MatchIndexedRules(parsed, static_cast<IndexField>(field), keys[field], endpoints);
+        }
+    }
+
+    const AllJoynMessageType types[] = { MESSAGE_INVALID, msg->GetType() };
+    for (size_t i = 0; i < ArraySize(types); ++i) {
+        std::pair<WildcardIndex::const_iterator, WildcardIndex::const_iterator> range = wildcardIndex.equal_range(types[i]);
+        for (WildcardIndex::const_iterator it = range.first; it != range.second; ++it) {
+            const RuleIterator& rit = it->second;
+            if ((endpoints.find(rit->first) == endpoints.end()) && rit->second.IsMatch(parsed)) {
+                endpoints.insert(rit->first);
+            }
+        }
+    }
+
+    /*
+     * Rules with sessionless='t' only ever match sessionless messages.  For
+     * those OkToSend() depends on which of the endpoint's rules matches first
+     * (see the comment in OkToSendLocked()) so fall back to the per-endpoint
+     * check for the endpoints that have a match.
+     */
+    if (msg->IsSessionless()) {
+        std::set<BusEndpoint>::iterator it = endpoints.begin();
+        while (it != endpoints.end()) {
+            if (OkToSendLocked(parsed, *it)) {
+                ++it;
+            } else {
+                endpoints.erase(it++);
+            }
+        }
+    }
+    lock.Unlock(MUTEX_CONTEXT);
+}
+
 
 }
@@ -41,9 +41,15 @@
 #include <qcc/Mutex.h>
 #include <qcc/LockLevel.h>
 
+#include <map>
+#include <set>
+#include <string>
+
 #include "BusEndpoint.h"
 #include "Rule.h"
 
+#include <qcc/STLContainer.h>
+
 
 namespace ajn {
 
@@ -151,9 +157,80 @@ class RuleTable {
      */
     bool OkToSend(const Message& msg, BusEndpoint& endpoint) const;
 
+    /**
+     * Check if message matches a rule for the given endpoint.
+     *
+     * Use this variant when checking the same message against several
+     * endpoints so that the message args are only unmarshalled once.
+     *
+     * @param   parsed      Parsed view of the message that may be delivered.
+     * @param   endpoint    Endpoint message may be delivered to.
+     *
+     * @return  true if endpoint has a match rule that matches the message, false otherwise.
+     */
+    bool OkToSend(ParsedMessage& parsed, BusEndpoint& endpoint) const;
+
+    /**
+     * Get all endpoints that have a match rule that matches the message.
+     *
+     * Only the rules filed in the rule index under the message's interface,
+     * member, object path or sender (plus the wildcard rules for the message
+     * type) are checked so the cost does not grow with the number of
+     * endpoints.  The result is identical to calling OkToSend() for each
+     * endpoint in the rule table.
+     *
+     * @param      msg        Message that may be delivered.
+     * @param[out] endpoints  Set of endpoints that OkToSend() would accept.
+     */
+    void GetMatchingEndpoints(const Message& msg, std::set<BusEndpoint>& endpoints) const;
+
   private:
+
+    /**
+     * Rule index fields.  A rule is filed under the first of its interface,
+     * member, path or sender fields that is not empty.  Rules that do not
+     * specify any of these fields are filed in the wildcard index.
+     */
+    enum IndexField {
+        INDEX_IFACE = 0,     /**< Rule is indexed by interface */
+        INDEX_MEMBER,        /**< Rule is indexed by member name */
+        INDEX_PATH,          /**< Rule is indexed by object path */
+        INDEX_SENDER,        /**< Rule is indexed by sender */
+        INDEX_NUM_FIELDS     /**< Rule is in the wildcard index */
+    };
+
+    typedef std::unordered_multimap<std::string, RuleIterator> RuleIndex;
+    typedef std::multimap<AllJoynMessageType, RuleIterator> WildcardIndex;
+
+    /**
+     * Add a rule to the rule index.  Caller must hold the lock.
+     *
+     * @param it   Rule table entry to index.
+     */
+    void IndexRule(const RuleIterator& it);
+
+    /**
+     * Remove a rule from the rule index.  Caller must hold the lock.
+     *
+     * @param it   Rule table entry to remove from the index.
+     */
+    void UnindexRule(const RuleIterator& it);
+
+    /**
+     * Check the rules filed under one rule index key against a message.
+     * Caller must hold the lock.
+     */
+    void MatchIndexedRules(ParsedMessage& parsed, IndexField field, const char* key, std::set<BusEndpoint>& endpoints) const;
+
+    /**
+     * Linear scan of the rules for one endpoint.  Caller must hold the lock.
+     */
+    bool OkToSendLocked(ParsedMessage& parsed, const BusEndpoint& endpoint) const;
+
     mutable qcc::Mutex lock;                   /**< Lock protecting rule table */
     std::multimap<BusEndpoint, Rule> rules;    /**< Rule table */
+    RuleIndex ruleIndex[INDEX_NUM_FIELDS];     /**< Rule table entries indexed by interface, member, path and sender */
+    WildcardIndex wildcardIndex;               /**< Rule table entries that specify none of the indexed fields */
 };
 
 }
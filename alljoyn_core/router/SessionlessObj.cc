@@ -434,20 +434,6 @@ bool SessionlessObj::IsSessionlessEmitter(String name)
     return ret;
 }
 
-SessionlessObj::_SessionlessMessage::_SessionlessMessage(Message message)
-    : changeId(0), msg(message), cachedWhoImplements(nullptr)
-{
-    /* Only create the cache if this is an Announce message */
-    if ((0 == strcmp(msg->GetInterface(), "org.alljoyn.About")) && (0 == strcmp(msg->GetMemberName(), "Announce"))) {
-        cachedWhoImplements = new std::set<qcc::String>();
-    }
-}
-
-SessionlessObj::_SessionlessMessage::~_SessionlessMessage()
-{
-    delete cachedWhoImplements;
-}
-
 void SessionlessObj::PushMessageWork::Run()
 {
     slObj.router.LockNameTable();
@@ -463,12 +449,7 @@ void SessionlessObj::PushMessageWork::Run()
     String key = MakeSessionlessMessageKey(m_msg->GetSender(), m_msg->GetInterface(), m_msg->GetMemberName(), m_msg->GetObjectPath());
     slObj.advanceChangeId = true;
     slm->changeId = slObj.curChangeId;
-    LocalCache::iterator it = slObj.localCache.find(key);
-    if (it == slObj.localCache.end()) {
-        slObj.localCache.insert(pair<String, SessionlessMessage>(key, slm));
-    } else {
-        it->second = slm;
-    }
+    slObj.CacheMessage(key, slm);
 
     slObj.lock.Unlock();
     slObj.router.UnlockNameTable();
@@ -505,13 +486,11 @@ void SessionlessObj::RouteSessionlessMessage(SessionId sid, Message& msg, const
     }
     RemoteCacheWork& cache = cit->second;
 
-    if (find(cache.routedMessages.begin(), cache.routedMessages.end(), RoutedMessage(msg)) != cache.routedMessages.end()) {
+    if (!cache.routedMessages.Insert(msg->GetSender(), msg->GetCallSerial())) {
         /* We are retrying and have already routed this message, ignore it */
         lock.Unlock();
         router.UnlockNameTable();
         return;
-    } else {
-        cache.routedMessages.push_back(RoutedMessage(msg));
     }
 
     SessionlessMessage slm(msg);
@@ -593,7 +572,7 @@ void SessionlessObj::SendMatchingThroughEndpoint(SessionId sid,
     RuleIterator end = rules.upper_bound(dstEpName);
     for (; rit != end; ++rit) {
         if (IN_WINDOW(uint32_t, fromRulesId, rulesRangeLen, rit->second.id)) {
-            if (rit->second.IsMatch(msg, slm->cachedWhoImplements)) {
+            if (rit->second.IsMatch(slm->parsed)) {
                 isExplicitMatch = true;
                 if (isAnnounce && !rit->second.implements.empty()) {
                     /**
@@ -616,7 +595,7 @@ void SessionlessObj::SendMatchingThroughEndpoint(SessionId sid,
                 for (ajn::RuleIterator drit = router.GetRuleTable().FindRulesForEndpoint(dstEp);
                      !isExplicitMatch && (drit != router.GetRuleTable().End()) && (drit->first == dstEp);
                      ++drit) {
-                    isExplicitMatch = drit->second.IsMatch(msg, slm->cachedWhoImplements);
+                    isExplicitMatch = drit->second.IsMatch(slm->parsed);
                 }
                 router.GetRuleTable().Unlock();
             }
@@ -661,7 +640,7 @@ void SessionlessObj::CancelMessageWork::Run()
             if (!it->second->msg->IsExpired()) {
                 status = ER_OK;
             }
-            slObj.localCache.erase(it);
+            slObj.EraseCachedMessage(it);
             break;
         }
         ++it;
@@ -716,7 +695,7 @@ void SessionlessObj::NameOwnerChangedWork::Run()
     String key = MakeSessionlessMessageKey(oldOwner.c_str(), "", "", "");
     LocalCache::iterator mit = slObj.localCache.lower_bound(key);
     while ((mit != slObj.localCache.end()) && (::strcmp(oldOwner.c_str(), mit->second->msg->GetSender()) == 0)) {
-        slObj.localCache.erase(mit++);
+        slObj.EraseCachedMessage(mit++);
     }
 
     /* Stop discovery if nobody is looking for sessionless signals */
@@ -838,7 +817,7 @@ void SessionlessObj::DoSessionLost(SessionId sid, SessionLostReason reason)
         if (reason == ALLJOYN_SESSIONLOST_REMOTE_END_LEFT_SESSION) {
             /* We got all the signals */
             cache.retries = 0;
-            cache.routedMessages.clear();
+            cache.routedMessages.Clear();
             if (IS_GREATER(uint32_t, cache.toRulesId - 1, cache.appliedRulesId)) {
                 cache.appliedRulesId = cache.toRulesId - 1;
             }
@@ -923,15 +902,103 @@ void SessionlessObj::RequestRangeMatchSignalHandler(const InterfaceDescription::
     }
 }
 
+bool SessionlessObj::RoutedMessages::Insert(const String& sender, uint32_t serial)
+{
+    pair<unordered_map<string, uint32_t>::iterator, bool> sit =
+        senderIds.insert(pair<string, uint32_t>(sender, static_cast<uint32_t>(senderIds.size())));
+    uint64_t id = (static_cast<uint64_t>(sit.first->second) << 32) | serial;
+    if (!routed.insert(id).second) {
+        return false;
+    }
+    order.push_back(id);
+    if (order.size() > maxSize) {
+        routed.erase(order.front());
+        order.pop_front();
+    }
+    return true;
+}
+
+void SessionlessObj::RoutedMessages::Clear()
+{
+    senderIds.clear();
+    routed.clear();
+    order.clear();
+}
+
+void SessionlessObj::GetChangeIdRange(const ChangeIdIndex& index, uint32_t fromChangeId, uint32_t toChangeId,
+                                      vector<String>& keys)
+{
+    ChangeIdIndex::const_iterator it = index.lower_bound(pair<uint32_t, String>(fromChangeId, String()));
+    if (toChangeId < fromChangeId) {
+        /* Range wraps around */
+        for (; it != index.end(); ++it) {
+            keys.push_back(it->second);
+        }
+        it = index.begin();
+    }
+    for (; (it != index.end()) && (it->first < toChangeId); ++it) {
+        keys.push_back(it->second);
+    }
+}
+
+void SessionlessObj::CacheMessage(const String& key, SessionlessMessage& slm)
+{
+    LocalCache::iterator it = localCache.find(key);
+    if (it != localCache.end()) {
+        EraseCachedMessage(it);
+    }
+    localCache.insert(pair<String, SessionlessMessage>(key, slm));
+    changeIdIndex.insert(pair<uint32_t, String>(slm->changeId, key));
+
+    uint32_t tillExpire;
+    slm->msg->IsExpired(&tillExpire);
+    if (tillExpire != numeric_limits<uint32_t>::max()) {
+        slm->expireTime = GetTimestamp64() + tillExpire;
+        expireIndex.insert(pair<uint64_t, String>(slm->expireTime, key));
+    }
+}
+
+void SessionlessObj::EraseCachedMessage(LocalCache::iterator it)
+{
+    changeIdIndex.erase(pair<uint32_t, String>(it->second->changeId, it->first));
+    expireIndex.erase(pair<uint64_t, String>(it->second->expireTime, it->first));
+    localCache.erase(it);
+}
+
+bool SessionlessObj::EraseExpiredMessages()
+{
+    bool erased = false;
+    uint64_t now = GetTimestamp64();
+    while (!expireIndex.empty() && (expireIndex.begin()->first <= now)) {
+        LocalCache::iterator it = localCache.find(expireIndex.begin()->second);
+        QCC_ASSERT(it != localCache.end());
+        if (it == localCache.end()) {
+            expireIndex.erase(expireIndex.begin());
+            continue;
+        }
+        EraseCachedMessage(it);
+        erased = true;
+    }
+    return erased;
+}
+
 void SessionlessObj::HandleRangeRequest(const char* sender, SessionId sid,
                                         uint32_t fromChangeId, uint32_t toChangeId,
                                         uint32_t fromLocalRulesId, uint32_t toLocalRulesId,
                                         std::vector<qcc::String> remoteRules)
 {
     QStatus status = ER_OK;
-    bool messageErased = false;
     QCC_DbgTrace(("SessionlessObj::HandleControlSignal(%d, %d)", fromChangeId, toChangeId));
 
+    /* Parse the remote rules once rather than once per message */
+    bool matchAll = remoteRules.empty();
+    vector<Rule> compiledRules;
+    for (vector<String>::iterator rit = remoteRules.begin(); !matchAll && (rit != remoteRules.end()); ++rit) {
+        Rule rule(rit->c_str());
+        matchAll = (rule == legacyRule);
+        compiledRules.push_back(rule);
+    }
+
     /* Advance the curChangeId */
     router.LockNameTable();
     lock.Lock();
@@ -940,43 +1007,49 @@ void SessionlessObj::HandleRangeRequest(const char* sender, SessionId sid,
         advanceChangeId = false;
     }
 
-    /* Send all messages in local cache in range [fromChangeId, toChangeId) */
-    LocalCache::iterator it = localCache.begin();
-    uint32_t rangeLen = toChangeId - fromChangeId;
-    while (it != localCache.end()) {
+    /* Remove expired messages without sending */
+    bool messageErased = EraseExpiredMessages();
+
+    /* Collect the messages in local cache in range [fromChangeId, toChangeId) */
+    vector<String> keys;
+    GetChangeIdRange(changeIdIndex, fromChangeId, toChangeId, keys);
+    vector<SessionlessMessage> inRange;
+    inRange.reserve(keys.size());
+    for (vector<String>::iterator kit = keys.begin(); kit != keys.end(); ++kit) {
+        inRange.push_back(localCache.find(*kit)->second);
+    }
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        /* The locks are released while sending so skip messages that have since been removed or replaced */
+        LocalCache::iterator it = localCache.find(keys[i]);
+        if ((it == localCache.end()) || !it->second.iden(inRange[i])) {
+            continue;
+        }
         SessionlessMessage slm = it->second;
-        if (IN_WINDOW(uint32_t, fromChangeId, rangeLen, slm->changeId)) {
-            String key = it->first;
-            if (slm->msg->IsExpired()) {
-                /* Remove expired message without sending */
-                localCache.erase(it++);
-                messageErased = true;
-            } else if (sid != 0) {
-                /* Send message to remote destination */
-                bool isMatch = remoteRules.empty();
-                for (vector<String>::iterator rit = remoteRules.begin(); !isMatch && (rit != remoteRules.end()); ++rit) {
-                    Rule rule(rit->c_str());
-                    isMatch = rule.IsMatch(slm->msg) || (rule == legacyRule);
-                }
-                if (isMatch) {
-                    BusEndpoint ep = router.FindEndpoint(sender);
-                    if (ep->IsValid()) {
-                        lock.Unlock();
-                        router.UnlockNameTable();
-                        QCC_DbgPrintf(("Send cid=%u,serialNum=%u to sid=%u", slm->changeId, slm->msg->GetCallSerial(), sid));
-                        SendThroughEndpoint(slm->msg, ep, sid);
-                        router.LockNameTable();
-                        lock.Lock();
-                    }
+        if (slm->msg->IsExpired()) {
+            /* Remove expired message without sending */
+            EraseCachedMessage(it);
+            messageErased = true;
+        } else if (sid != 0) {
+            /* Send message to remote destination */
+            bool isMatch = matchAll;
+            for (vector<Rule>::iterator rit = compiledRules.begin(); !isMatch && (rit != compiledRules.end()); ++rit) {
+                isMatch = rit->IsMatch(slm->parsed);
+            }
+            if (isMatch) {
+                BusEndpoint ep = router.FindEndpoint(sender);
+                if (ep->IsValid()) {
+                    lock.Unlock();
+                    router.UnlockNameTable();
+                    QCC_DbgPrintf(("Send cid=%u,serialNum=%u to sid=%u", slm->changeId, slm->msg->GetCallSerial(), sid));
+                    SendThroughEndpoint(slm->msg, ep, sid);
+                    router.LockNameTable();
+                    lock.Lock();
                 }
-                it = localCache.upper_bound(key);
-            } else {
-                /* Send message to local destination */
-                SendMatchingThroughEndpoint(sid, slm, fromLocalRulesId, toLocalRulesId);
-                it = localCache.upper_bound(key);
             }
         } else {
-            ++it;
+            /* Send message to local destination */
+            SendMatchingThroughEndpoint(sid, slm, fromLocalRulesId, toLocalRulesId);
         }
     }
     lock.Unlock();
@@ -1008,7 +1081,6 @@ void SessionlessObj::AlarmTriggered(const Alarm& alarm, QStatus reason)
 
     if (reason == ER_OK) {
         Timespec<MonotonicTime> tilExpire;
-        uint32_t expire;
 
         /* Send name service responses if needed */
         Work* work = static_cast<Work*>(alarm->GetContext());
@@ -1019,14 +1091,7 @@ void SessionlessObj::AlarmTriggered(const Alarm& alarm, QStatus reason)
 
         /* Purge the local cache of expired messages */
         lock.Lock();
-        LocalCache::iterator it = localCache.begin();
-        while (it != localCache.end()) {
-            if (it->second->msg->IsExpired(&expire)) {
-                localCache.erase(it++);
-            } else {
-                ++it;
-            }
-        }
+        EraseExpiredMessages();
         lock.Unlock();
 
         /* Change advertisment if needed */
@@ -1656,7 +1721,7 @@ bool SessionlessObj::SendResponseIfMatch(TransportMask transport, const qcc::IPE
     lock.Lock();
     for (LocalCache::iterator mit = localCache.begin(); mit != localCache.end(); ++mit) {
         Message& msg = mit->second->msg;
-        if (rule.IsMatch(msg, mit->second->cachedWhoImplements)) {
+        if (rule.IsMatch(mit->second->parsed)) {
             name = AdvertisedName(msg->GetInterface(), lastAdvertisements[msg->GetInterface()]);
             sendResponse = true;
             break;
@@ -1915,12 +1980,12 @@ bool SessionlessObj::IsOnlyImplicitMatch(const qcc::String& epName, SessionlessM
      * purely implicit, and the implicit match rule should be removed for this epName.
      */
     for (ImplicitRuleIterator irit = implicitRules.begin(); irit != implicitRules.end(); ++irit) {
-        if (irit->IsMatch(msg, slm->cachedWhoImplements)) {
+        if (irit->IsMatch(slm->parsed)) {
             bool hasExplicitMatch = false;
             std::pair<RuleIterator, RuleIterator> range = rules.equal_range(epName);
             bool hasExplicitRules = (range.first != range.second);
             for (; range.first != range.second; range.first++) {
-                if (range.first->second.IsMatch(msg, slm->cachedWhoImplements)) {
+                if (range.first->second.IsMatch(slm->parsed)) {
                     hasExplicitMatch = true;
                     break;
                 }
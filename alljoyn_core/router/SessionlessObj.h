@@ -36,9 +36,13 @@
 
 #include <qcc/platform.h>
 
+#include <deque>
 #include <map>
 #include <set>
 #include <queue>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <qcc/String.h>
 #include <qcc/Timer.h>
@@ -294,6 +298,41 @@ class SessionlessObj : public BusObject, public NameListener, public SessionList
         uint32_t appliedRulesId;
     };
 
+    /**
+     * The messages routed from a remote cache during a fetch, used to ignore
+     * the duplicates received when the fetch is retried.
+     *
+     * Messages are identified by (sender, serial). Sender names are interned
+     * so a lookup is a single hash of a 64-bit key. At most maxSize messages
+     * are remembered, the oldest being forgotten first.
+     */
+    class RoutedMessages {
+      public:
+        RoutedMessages(size_t maxSize = 16384) : maxSize(maxSize) { }
+
+        /**
+         * Record a message as routed.
+         *
+         * @param[in] sender unique name of the message sender
+         * @param[in] serial serial number of the message
+         *
+         * @return true if the message was recorded, false if it was already routed
+         */
+        bool Insert(const qcc::String& sender, uint32_t serial);
+
+        /** Forget all routed messages */
+        void Clear();
+
+        /** Number of routed messages remembered */
+        size_t Size() const { return routed.size(); }
+
+      private:
+        size_t maxSize;
+        std::unordered_map<std::string, uint32_t> senderIds; /**< Interned sender names */
+        std::unordered_set<uint64_t> routed;                 /**< (sender ID, serial) of the routed messages */
+        std::deque<uint64_t> order;                          /**< routed, oldest first */
+    };
+
     /**
      * A match rule that includes a change ID for recording when it was entered
      * into the rule table.
@@ -318,6 +357,20 @@ class SessionlessObj : public BusObject, public NameListener, public SessionList
      */
     static WorkType PendingWork(RemoteCache& cache, TimestampedRules& rules, uint32_t nextRulesId);
 
+    /** Keys of cached messages ordered by changeId */
+    typedef std::set<std::pair<uint32_t, qcc::String> > ChangeIdIndex;
+
+    /**
+     * Get the keys of the messages in a changeId range.
+     *
+     * @param[in] index the changeId index to search
+     * @param[in] fromChangeId beginning of changeId range (inclusive)
+     * @param[in] toChangeId end of changeId range (exclusive), the range may wrap around
+     * @param[out] keys the keys of the messages in range, in changeId order
+     */
+    static void GetChangeIdRange(const ChangeIdIndex& index, uint32_t fromChangeId, uint32_t toChangeId,
+                                 std::vector<qcc::String>& keys);
+
   private:
     friend struct RemoteCacheWorkSnapshot;
 
@@ -396,11 +449,11 @@ class SessionlessObj : public BusObject, public NameListener, public SessionList
 
     /** A structure for keeping track of stored sessionless signals */
     struct _SessionlessMessage {
-        _SessionlessMessage(Message message);
-        ~_SessionlessMessage();
+        _SessionlessMessage(Message message) : changeId(0), msg(message), parsed(message), expireTime(0) { }
         uint32_t changeId;
         Message msg;
-        std::set<qcc::String>* cachedWhoImplements; /**< For About signals, this field caches 'implements' interfaces (to avoid future cost of re-parsing) */
+        ParsedMessage parsed;   /**< Args of msg used for rule matching, unmarshalled once on first use */
+        uint64_t expireTime;    /**< Timestamp (ms) when msg expires, 0 if it has no TTL */
     };
 
     typedef qcc::ManagedObj<_SessionlessMessage> SessionlessMessage;
@@ -409,12 +462,37 @@ class SessionlessObj : public BusObject, public NameListener, public SessionList
     /** Storage for sessionless messages waiting to be delivered */
     LocalCache localCache;
 
-    struct RoutedMessage {
-        RoutedMessage(const Message& msg) : sender(msg->GetSender()), serial(msg->GetCallSerial()) { }
-        qcc::String sender;
-        uint32_t serial;
-        bool operator==(const RoutedMessage& other) const { return (sender == other.sender) && (serial == other.serial); }
-    };
+    /** localCache keys ordered by changeId, used to find the messages in a requested range */
+    ChangeIdIndex changeIdIndex;
+
+    typedef std::set<std::pair<uint64_t, qcc::String> > ExpireIndex;
+    /** localCache keys of messages with a TTL ordered by expiration time */
+    ExpireIndex expireIndex;
+
+    /**
+     * Add a message to localCache (replacing any message with the same key) and index it.
+     * Must be called with lock held.
+     *
+     * @param key   Key made by MakeSessionlessMessageKey
+     * @param slm   Message to cache, its changeId must already be set
+     */
+    void CacheMessage(const qcc::String& key, SessionlessMessage& slm);
+
+    /**
+     * Remove a message from localCache and its indexes.
+     * Must be called with lock held.
+     *
+     * @param it    Entry to remove
+     */
+    void EraseCachedMessage(LocalCache::iterator it);
+
+    /**
+     * Remove expired messages from localCache.
+     * Must be called with lock held.
+     *
+     * @return true if any message was removed
+     */
+    bool EraseExpiredMessages();
 
     class RemoteCacheWork : public RemoteCache {
       public:
@@ -434,7 +512,7 @@ class SessionlessObj : public BusObject, public NameListener, public SessionList
         qcc::Timespec<qcc::MonotonicTime> firstJoinTime;
         qcc::Timespec<qcc::MonotonicTime> nextJoinTime;
         SessionId sid;
-        std::list<RoutedMessage> routedMessages;
+        RoutedMessages routedMessages;
     };
 
     typedef std::map<qcc::String, RemoteCacheWork> RemoteCaches;
@@ -944,6 +944,7 @@ void TCPTransport::Authenticated(TCPEndpoint& conn)
 
     conn->SetEpStarting();
 
+    conn->SetTxQueueLimits(m_maxTxQueue, m_maxTxQueueBytes, m_maxTxBatch);
     QStatus status = conn->Start(m_defaultHbeatIdleTimeout, m_defaultHbeatProbeTimeout, m_numHbeatProbes, m_maxHbeatProbeTimeout);
     if (status != ER_OK) {
         QCC_LogError(status, ("TCPTransport::Authenticated(): Failed to start TCP endpoint"));
@@ -1745,6 +1746,10 @@ void* TCPTransport::Run(void* arg)
     m_maxHbeatProbeTimeout = config->GetLimit("tcp_max_probe_timeout", MAX_HEARTBEAT_PROBE_TIMEOUT_DEFAULT);
     m_defaultHbeatProbeTimeout = config->GetLimit("tcp_default_probe_timeout", DEFAULT_HEARTBEAT_PROBE_TIMEOUT_DEFAULT);
 
+    m_maxTxQueue = config->GetLimit("tcp_max_tx_queue", MAX_TX_QUEUE_DEFAULT);
+    m_maxTxQueueBytes = config->GetLimit("tcp_max_tx_queue_bytes", MAX_TX_QUEUE_BYTES_DEFAULT);
+    m_maxTxBatch = config->GetLimit("tcp_max_tx_batch", MAX_TX_BATCH_DEFAULT);
+
     QCC_DbgPrintf(("TCPTransport: Using m_minHbeatIdleTimeout=%u, m_maxHbeatIdleTimeout=%u, m_numHbeatProbes=%u, m_defaultHbeatProbeTimeout=%u m_maxHbeatProbeTimeout=%u", m_minHbeatIdleTimeout, m_maxHbeatIdleTimeout, m_numHbeatProbes, m_defaultHbeatProbeTimeout, m_maxHbeatProbeTimeout));
 
     QStatus status = ER_OK;
@@ -3243,6 +3248,7 @@ QStatus TCPTransport::Connect(const char* connectSpec, const SessionOpts& opts,
         if (status == ER_OK) {
             tcpEp->SetListener(this);
             tcpEp->SetEpStarting();
+            tcpEp->SetTxQueueLimits(m_maxTxQueue, m_maxTxQueueBytes, m_maxTxBatch);
             status = tcpEp->Start(m_defaultHbeatIdleTimeout, m_defaultHbeatProbeTimeout, m_numHbeatProbes, m_maxHbeatProbeTimeout);
             if (status == ER_OK) {
                 tcpEp->SetEpStarted();
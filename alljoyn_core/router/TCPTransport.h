@@ -654,6 +654,18 @@ class TCPTransport : public Transport, public _RemoteEndpoint::EndpointListener,
      */
     static const uint32_t HEARTBEAT_NUM_PROBES = 1;
 
+    /**
+     * @brief The default transmit queue limits for TCPTransport endpoints.
+     *
+     * These correspond to the configuration items "tcp_max_tx_queue",
+     * "tcp_max_tx_queue_bytes" and "tcp_max_tx_batch".
+     * To override these values, change the limits "tcp_max_tx_queue",
+     * "tcp_max_tx_queue_bytes" and "tcp_max_tx_batch"
+     */
+    static const uint32_t MAX_TX_QUEUE_DEFAULT = 16;
+    static const uint32_t MAX_TX_QUEUE_BYTES_DEFAULT = 256 * 1024;
+    static const uint32_t MAX_TX_BATCH_DEFAULT = 16;
+
     /*
      * The Android Compatibility Test Suite (CTS) is used by Google to enforce a
      * common idea of what it means to be Android.  One of their tests is to
@@ -831,6 +843,15 @@ class TCPTransport : public Transport, public _RemoteEndpoint::EndpointListener,
     uint32_t m_numHbeatProbes;             /**< Number of probes Routing node should wait for Heartbeat response to be
                                               recieved from the Leaf node before declaring it dead - Transport specific */
 
+    uint32_t m_maxTxQueue;                 /**< Number of data messages that can be queued for an endpoint before the
+                                              sender blocks - configurable in router config */
+
+    uint32_t m_maxTxQueueBytes;            /**< Number of bytes of data messages that can be queued for an endpoint
+                                              before the sender blocks - configurable in router config */
+
+    uint32_t m_maxTxBatch;                 /**< Maximum number of queued messages written to an endpoint with a
+                                              single write - configurable in router config */
+
     DynamicScoreUpdater m_dynamicScoreUpdater;
 };
 
@@ -2573,9 +2573,10 @@ QStatus IpNameServiceImpl::AdvertiseName(TransportMask transportMask, vector<qcc
     //
     if (quietly) {
         for (uint32_t i = 0; i < wkn.size(); ++i) {
-            set<qcc::String>::iterator j = find(m_advertised_quietly[transportIndex].begin(), m_advertised_quietly[transportIndex].end(), wkn[i]);
+            set<qcc::String>::iterator j = m_advertised_quietly[transportIndex].find(wkn[i]);
             if (j == m_advertised_quietly[transportIndex].end()) {
                 m_advertised_quietly[transportIndex].insert(wkn[i]);
+                m_advertisedQuietlyMatcher[transportIndex].Add(wkn[i]);
             } else {
                 //
                 // Nothing has changed, so don't bother.
@@ -2595,9 +2596,10 @@ QStatus IpNameServiceImpl::AdvertiseName(TransportMask transportMask, vector<qcc
         return ER_OK;
     } else {
         for (uint32_t i = 0; i < wkn.size(); ++i) {
-            set<qcc::String>::iterator j = find(m_advertised[transportIndex].begin(), m_advertised[transportIndex].end(), wkn[i]);
+            set<qcc::String>::iterator j = m_advertised[transportIndex].find(wkn[i]);
             if (j == m_advertised[transportIndex].end()) {
                 m_advertised[transportIndex].insert(wkn[i]);
+                m_advertisedMatcher[transportIndex].Add(wkn[i]);
             } else {
                 //
                 // Nothing has changed, so don't bother.
@@ -2907,8 +2909,9 @@ QStatus IpNameServiceImpl::CancelAdvertiseName(TransportMask transportMask, vect
     // names that have changes in status reflected out on the network.
     if (quietly) {
         for (uint32_t i = 0; i < wkn.size(); ++i) {
-            set<qcc::String>::iterator k = find(m_advertised_quietly[transportIndex].begin(), m_advertised_quietly[transportIndex].end(), wkn[i]);
+            set<qcc::String>::iterator k = m_advertised_quietly[transportIndex].find(wkn[i]);
             if (k != m_advertised_quietly[transportIndex].end()) {
+                m_advertisedQuietlyMatcher[transportIndex].Remove(*k);
                 m_advertised_quietly[transportIndex].erase(k);
             }
         }
@@ -2921,8 +2924,9 @@ QStatus IpNameServiceImpl::CancelAdvertiseName(TransportMask transportMask, vect
     } else {
         bool changed = false;
         for (uint32_t i = 0; i < wkn.size(); ++i) {
-            set<qcc::String>::iterator j = find(m_advertised[transportIndex].begin(), m_advertised[transportIndex].end(), wkn[i]);
+            set<qcc::String>::iterator j = m_advertised[transportIndex].find(wkn[i]);
             if (j != m_advertised[transportIndex].end()) {
+                m_advertisedMatcher[transportIndex].Remove(*j);
                 m_advertised[transportIndex].erase(j);
                 changed = true;
             }
@@ -6375,21 +6379,21 @@ void IpNameServiceImpl::Retransmit(uint32_t transportIndex, bool exiting, bool q
         // A user can consume all available resources here by flooding us with
         // advertisements but she will only be shooting herself in the foot.
         //
+        // When replying quietly we only send the names that match the query.
+        //
+        set<qcc::String> matching;
+        if (quietly) {
+            for (vector<String>::iterator itWkn = wkns.begin(); itWkn != wkns.end(); itWkn++) {
+                m_advertisedMatcher[transportIndex].MatchPattern(*itWkn, matching);
+                m_advertisedQuietlyMatcher[transportIndex].MatchPattern(*itWkn, matching);
+            }
+        }
+
         for (set<qcc::String>::iterator i = m_advertised[transportIndex].begin(); i != m_advertised[transportIndex].end(); ++i) {
 
             //Do not send non-matching names if replying quietly
-            if (quietly) {
-                bool ignoreName = true;
-                for (vector<String>::iterator itWkn = wkns.begin(); itWkn != wkns.end(); itWkn++) {
-                    //Do not send non-matching names if replying quietly
-                    if (!(WildcardMatch((*i), (*itWkn)))) {
-                        ignoreName = false;
-                        break;
-                    }
-                }
-                if (ignoreName) {
-                    continue;
-                }
+            if (quietly && (matching.find(*i) == matching.end())) {
+                continue;
             }
             QCC_DbgPrintf(("IpNameServiceImpl::Retransmit(): Accumulating \"%s\"", (*i).c_str()));
 
@@ -6470,18 +6474,9 @@ void IpNameServiceImpl::Retransmit(uint32_t transportIndex, bool exiting, bool q
 
         if (quietly) {
             for (set<qcc::String>::iterator i = m_advertised_quietly[transportIndex].begin(); i != m_advertised_quietly[transportIndex].end(); ++i) {
-                if (quietly) {
-                    bool ignoreName = true;
-                    for (vector<String>::iterator itWkn = wkns.begin(); itWkn != wkns.end(); itWkn++) {
-                        //Do not send non-matching names if replying quietly
-                        if (!(WildcardMatch((*i), (*itWkn)))) {
-                            ignoreName = false;
-                            break;
-                        }
-                    }
-                    if (ignoreName) {
-                        continue;
-                    }
+                //Do not send non-matching names if replying quietly
+                if (matching.find(*i) == matching.end()) {
+                    continue;
                 }
                 QCC_DbgPrintf(("IpNameServiceImpl::Retransmit(): Accumulating (quiet) \"%s\"", (*i).c_str()));
 
@@ -6635,6 +6630,20 @@ void IpNameServiceImpl::Retransmit(uint32_t transportIndex, bool exiting, bool q
         mdnsPacket->GetAdditionalRecord("sender-info.*", MDNSResourceRecord::TXT, MDNSTextRData::TXTVERS, &refRecord1);
         refRData = static_cast<MDNSSenderRData*>(refRecord1->GetRData());
 
+        //
+        // If the requestor has set send_matching_only, i.e. wkns.size() > 0,
+        // we only send the names that match the query.
+        //
+        set<qcc::String> matching;
+        for (vector<String>::iterator itWkn = wkns.begin(); itWkn != wkns.end(); itWkn++) {
+            m_advertisedMatcher[TRANSPORT_INDEX_TCP].MatchPattern(*itWkn, matching);
+            m_advertisedMatcher[TRANSPORT_INDEX_UDP].MatchPattern(*itWkn, matching);
+            if (quietly) {
+                m_advertisedQuietlyMatcher[TRANSPORT_INDEX_TCP].MatchPattern(*itWkn, matching);
+                m_advertisedQuietlyMatcher[TRANSPORT_INDEX_UDP].MatchPattern(*itWkn, matching);
+            }
+        }
+
         TransportMask transportMaskArr[3] = { TRANSPORT_TCP, TRANSPORT_UDP, TRANSPORT_TCP | TRANSPORT_UDP };
 
         for (int i = 0; i < 3; i++) {
@@ -6648,18 +6657,8 @@ void IpNameServiceImpl::Retransmit(uint32_t transportIndex, bool exiting, bool q
             for (set<qcc::String>::iterator it = advertising.begin(); it != advertising.end(); ++it) {
 
                 //Do not send non-matching names if requestor has set send_matching_only i.e. wkns.size() > 0
-                if (wkns.size() > 0) {
-                    bool ignoreName = true;
-                    for (vector<String>::iterator itWkn = wkns.begin(); itWkn != wkns.end(); itWkn++) {
-                        //Do not send non-matching names if requestor has set send_matching_only i.e. wkns.size() > 0
-                        if (!(WildcardMatch((*it), (*itWkn)))) {
-                            ignoreName = false;
-                            break;
-                        }
-                    }
-                    if (ignoreName) {
-                        continue;
-                    }
+                if ((wkns.size() > 0) && (matching.find(*it) == matching.end())) {
+                    continue;
                 }
 
                 QCC_DbgPrintf(("IpNameServiceImpl::Retransmit(): Accumulating \"%s\"", (*it).c_str()));
@@ -6744,18 +6743,8 @@ void IpNameServiceImpl::Retransmit(uint32_t transportIndex, bool exiting, bool q
 
                 for (set<qcc::String>::iterator it = advertising_quietly.begin(); it != advertising_quietly.end(); ++it) {
                     //Do not send non-matching names if requestor has set send_matching_only i.e. wkns.size() > 0
-                    if (wkns.size() > 0) {
-                        bool ignoreName = true;
-                        for (vector<String>::iterator itWkn = wkns.begin(); itWkn != wkns.end(); itWkn++) {
-                            //Do not send non-matching names if requestor has set send_matching_only i.e. wkns.size() > 0
-                            if (!(WildcardMatch((*it), (*itWkn)))) {
-                                ignoreName = false;
-                                break;
-                            }
-                        }
-                        if (ignoreName) {
-                            continue;
-                        }
+                    if ((wkns.size() > 0) && (matching.find(*it) == matching.end())) {
+                        continue;
                     }
                     QCC_DbgPrintf(("IpNameServiceImpl::Retransmit(): Accumulating (quiet) \"%s\"", (*it).c_str()));
 
@@ -6950,40 +6939,22 @@ void IpNameServiceImpl::HandleProtocolQuestion(WhoHas whoHas, const qcc::IPEndpo
             // from V1 to support legacy thin core leaf nodes looking for router
             // nodes.
             //
-            for (set<qcc::String>::iterator j = m_advertised[index].begin(); m_enableV1 && (j != m_advertised[index].end()); ++j) {
-
-                //
-                // The requested name comes in from the WhoHas message and we
-                // allow wildcards there.
-                //
-                if (WildcardMatch((*j), wkn)) {
-                    QCC_DbgPrintf(("IpNameServiceImpl::HandleProtocolQuestion(): request for %s does not match my %s",
-                                   wkn.c_str(), (*j).c_str()));
-                    continue;
-                } else {
-                    respond = true;
-                    break;
-                }
+            // The requested name comes in from the WhoHas message and we
+            // allow wildcards there.
+            //
+            if (m_enableV1 && m_advertisedMatcher[index].AnyMatchPattern(wkn)) {
+                respond = true;
             }
 
             //
             // Check to see if this name on the list of names we quietly advertise.
             //
-            for (set<qcc::String>::iterator j = m_advertised_quietly[index].begin(); j != m_advertised_quietly[index].end(); ++j) {
-
-                //
-                // The requested name comes in from the WhoHas message and we
-                // allow wildcards there.
-                //
-                if (WildcardMatch((*j), wkn)) {
-                    QCC_DbgPrintf(("IpNameServiceImpl::HandleProtocolQuestion(): request for %s does not match my %s",
-                                   wkn.c_str(), (*j).c_str()));
-                    continue;
-                } else {
-                    respond = true;
-                    respondQuietly = true;
-                    break;
-                }
+            if (m_advertisedQuietlyMatcher[index].AnyMatchPattern(wkn)) {
+                respond = true;
+                respondQuietly = true;
+            } else {
+                QCC_DbgPrintf(("IpNameServiceImpl::HandleProtocolQuestion(): request for %s does not match any quiet advertisement",
+                               wkn.c_str()));
             }
         }
 
@@ -8088,40 +8059,22 @@ bool IpNameServiceImpl::HandleSearchQuery(TransportMask completeTransportMask, M
             //
             // Check to see if this name on the list of names we actively advertise.
             //
-            for (set<String>::iterator j = m_advertised[index].begin(); j != m_advertised[index].end(); ++j) {
-
-                //
-                // The requested name comes in from the WhoHas message and we
-                // allow wildcards there.
-                //
-                if (WildcardMatch((*j), wkn)) {
-                    QCC_DbgPrintf(("IpNameServiceImpl::HandleSearchQuery(): request for %s does not match my %s",
-                                   wkn.c_str(), (*j).c_str()));
-                    continue;
-                } else {
-                    respond = true;
-                    break;
-                }
+            // The requested name comes in from the WhoHas message and we
+            // allow wildcards there.
+            //
+            if (m_advertisedMatcher[index].AnyMatchPattern(wkn)) {
+                respond = true;
             }
 
             //
             // Check to see if this name on the list of names we quietly advertise.
             //
-            for (set<String>::iterator j = m_advertised_quietly[index].begin(); j != m_advertised_quietly[index].end(); ++j) {
-
-                //
-                // The requested name comes in from the WhoHas message and we
-                // allow wildcards there.
-                //
-                if (WildcardMatch((*j), wkn)) {
-                    QCC_DbgPrintf(("IpNameServiceImpl::HandleSearchQuery(): request for %s does not match my %s",
-                                   wkn.c_str(), (*j).c_str()));
-                    continue;
-                } else {
-                    respond = true;
-                    respondQuietly = true;
-                    break;
-                }
+            if (m_advertisedQuietlyMatcher[index].AnyMatchPattern(wkn)) {
+                respond = true;
+                respondQuietly = true;
+            } else {
+                QCC_DbgPrintf(("IpNameServiceImpl::HandleSearchQuery(): request for %s does not match any quiet advertisement",
+                               wkn.c_str()));
             }
         }
         //
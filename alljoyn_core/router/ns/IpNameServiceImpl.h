@@ -61,6 +61,7 @@
 #include "IpNsProtocol.h"
 #include "IpNameService.h"
 #include "ConfigDB.h"
+#include "NameMatcher.h"
 
 namespace ajn {
 
@@ -1262,6 +1263,12 @@ class IpNameServiceImpl : public qcc::Thread {
      */
     std::set<qcc::String> m_advertised[N_TRANSPORTS];
 
+    /**
+     * @internal @brief The names in m_advertised, compiled for answering
+     * wildcard queries.
+     */
+    NameMatcher m_advertisedMatcher[N_TRANSPORTS];
+
     /**
      * @internal @brief A vector of set of all of the v2 match strings that the various
      * transports have active queries for.
@@ -1280,6 +1287,12 @@ class IpNameServiceImpl : public qcc::Thread {
      */
     std::set<qcc::String> m_advertised_quietly[N_TRANSPORTS];
 
+    /**
+     * @internal @brief The names in m_advertised_quietly, compiled for
+     * answering wildcard queries.
+     */
+    NameMatcher m_advertisedQuietlyMatcher[N_TRANSPORTS];
+
     /**
      * @internal
      * @brief The daemon GUID string of the daemon assoicated with this instance
@@ -272,6 +272,7 @@ void* DaemonTransport::Run(void* arg)
             status = conn->Establish("EXTERNAL", authName, redirection);
             if (status == ER_OK) {
                 conn->SetListener(this);
+                conn->SetTxQueueLimits(m_maxTxQueue, m_maxTxQueueBytes, m_maxTxBatch);
                 status = conn->Start(m_defaultHbeatIdleTimeout, m_defaultHbeatProbeTimeout, m_numHbeatProbes, m_maxHbeatProbeTimeout);
             }
             if (status != ER_OK) {
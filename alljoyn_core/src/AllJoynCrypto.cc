@@ -36,11 +36,16 @@
 
 #include <string.h>
 
+#include <functional>
+
 #include <qcc/Debug.h>
 #include <qcc/Crypto.h>
 #include <qcc/KeyBlob.h>
 #include <qcc/Util.h>
 #include <qcc/StringUtil.h>
+#include <qcc/Mutex.h>
+#include <qcc/Thread.h>
+#include <qcc/LockLevel.h>
 
 #include <alljoyn/Status.h>
 
@@ -68,6 +73,72 @@ const int32_t Crypto::MIN_AUTH_VERSION_MACLEN16 = 3;
 const int32_t Crypto::MIN_AUTH_VERSION_FULLNONCELEN = 3;
 const int32_t Crypto::MIN_AUTH_VERSION_USE_CRYPTO_VALUE = 3;
 
+/*
+ * Extra nonce values are drawn in blocks from the random number generator rather than 8 bytes per
+ * message. The buffers are striped by thread id so that concurrent senders rarely contend for the
+ * same lock.
+ */
+class ExtraNonceBuffers {
+  public:
+
+    static const size_t NUM_STRIPES = 8;
+    static const size_t BUFFER_LEN = 512;
+
+    QStatus Get(uint8_t* data, size_t len)
+    {
+        QCC_ASSERT(len <= BUFFER_LEN);
+        uint64_t h = std::hash<ThreadId>()(Thread::GetCurrentThreadId());
+        Stripe& stripe = stripes[(h * 0x9E3779B97F4A7C15ULL) >> 61];
+        QStatus status = ER_OK;
+        stripe.lock.Lock(MUTEX_CONTEXT);
+        if ((stripe.pos + len) > BUFFER_LEN) {
+            status = Crypto_GetRandomBytes(stripe.buf, BUFFER_LEN);
+            stripe.pos = (status == ER_OK) ? 0 : BUFFER_LEN;
+        }
+        if (status == ER_OK) {
+            memcpy(data, stripe.buf + stripe.pos, len);
+            /* Random bytes are never handed out twice */
+            ClearMemory(stripe.buf + stripe.pos, len);
+            stripe.pos += len;
+        }
+        stripe.lock.Unlock(MUTEX_CONTEXT);
+        return status;
+    }
+
+  private:
+
+    struct Stripe {
+        Stripe() : lock(LOCK_LEVEL_ALLJOYNCRYPTO_EXTRANONCELOCK), pos(BUFFER_LEN) { }
+        ~Stripe() { ClearMemory(buf, sizeof(buf)); }
+        Mutex lock;
+        uint8_t buf[BUFFER_LEN];
+        size_t pos;
+    };
+
+    Stripe stripes[NUM_STRIPES];
+};
+
+static ExtraNonceBuffers* extraNonceBuffers = NULL;
+
+void Crypto::Init()
+{
+    extraNonceBuffers = new ExtraNonceBuffers();
+}
+
+void Crypto::Shutdown()
+{
+    delete extraNonceBuffers;
+    extraNonceBuffers = NULL;
+}
+
+QStatus Crypto::GetExtraNonce(uint8_t* data, size_t len)
+{
+    if (extraNonceBuffers == NULL) {
+        return Crypto_GetRandomBytes(data, len);
+    }
+    return extraNonceBuffers->Get(data, len);
+}
+
 size_t Crypto::GetMACLength(const _Message& message) {
     int32_t authV = message.GetAuthVersion();
     size_t macLen = MACLength;
@@ -118,7 +189,7 @@ size_t Crypto::GetExtraNonceLength(const _Message& message) {
  * Note that the first 5 bytes of the second Nonce version is the same as the first Nonce version.
  */
 
-QStatus Crypto::Encrypt(const _Message& message, const KeyBlob& keyBlob, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen)
+QStatus Crypto::Encrypt(const _Message& message, const KeyBlob& keyBlob, Crypto_AES* aes, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen)
 {
     QStatus status;
 
@@ -145,7 +216,10 @@ QStatus Crypto::Encrypt(const _Message& message, const KeyBlob& keyBlob, uint8_t
                     break;
                 }
 
-                Crypto_GetRandomBytes(&nd[PreviousNonceLength], extraNonceLen);
+                status = GetExtraNonce(&nd[PreviousNonceLength], extraNonceLen);
+                if (status != ER_OK) {
+                    break;
+                }
 
                 memcpy(body + bodyLen + macLen, &nd[PreviousNonceLength], extraNonceLen);
 
@@ -167,8 +241,12 @@ QStatus Crypto::Encrypt(const _Message& message, const KeyBlob& keyBlob, uint8_t
             QCC_DbgHLPrintf(("     Header: %s", BytesToHexString(msgBuf, sizeof(_Message::MessageHeader)).c_str()));
             QCC_DbgHLPrintf(("Encrypt key: %s", BytesToHexString(keyBlob.GetData(), keyBlob.GetSize()).c_str()));
             QCC_DbgHLPrintf(("      nonce: %s", BytesToHexString(nonce.GetData(), nonce.GetSize()).c_str()));
-            Crypto_AES aes(keyBlob, Crypto_AES::CCM);
-            status = aes.Encrypt_CCM(body, body, bodyLen, nonce, msgBuf, hdrLen, macLen);
+            if (aes) {
+                status = aes->Encrypt_CCM(body, body, bodyLen, nonce, msgBuf, hdrLen, macLen);
+            } else {
+                Crypto_AES ccm(keyBlob, Crypto_AES::CCM);
+                status = ccm.Encrypt_CCM(body, body, bodyLen, nonce, msgBuf, hdrLen, macLen);
+            }
 
             bodyLen += extraNonceLen;
 
@@ -187,7 +265,7 @@ QStatus Crypto::Encrypt(const _Message& message, const KeyBlob& keyBlob, uint8_t
     return status;
 }
 
-QStatus Crypto::Decrypt(const _Message& message, const KeyBlob& keyBlob, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen)
+QStatus Crypto::Decrypt(const _Message& message, const KeyBlob& keyBlob, Crypto_AES* aes, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen)
 {
     QStatus status;
     switch (keyBlob.GetType()) {
@@ -227,8 +305,12 @@ QStatus Crypto::Decrypt(const _Message& message, const KeyBlob& keyBlob, uint8_t
             QCC_DbgHLPrintf(("        MAC: %s", BytesToHexString(body + bodyLen - macLen, macLen).c_str()));
             QCC_DbgHLPrintf(("extra nonce: %s", BytesToHexString(body + bodyLen, extraNonceLen).c_str()));
 
-            Crypto_AES aes(keyBlob, Crypto_AES::CCM);
-            status = aes.Decrypt_CCM(body, body, bodyLen, nonce, msgBuf, hdrLen, macLen);
+            if (aes) {
+                status = aes->Decrypt_CCM(body, body, bodyLen, nonce, msgBuf, hdrLen, macLen);
+            } else {
+                Crypto_AES ccm(keyBlob, Crypto_AES::CCM);
+                status = ccm.Decrypt_CCM(body, body, bodyLen, nonce, msgBuf, hdrLen, macLen);
+            }
             QCC_DbgHLPrintf(("bodyLen out %d", bodyLen));
         }
         break;
@@ -40,6 +40,7 @@
 
 #include <qcc/platform.h>
 #include <qcc/KeyBlob.h>
+#include <qcc/Crypto.h>
 
 #include <alljoyn/Message.h>
 
@@ -61,6 +62,8 @@ class Crypto {
      *
      * @param message         The message being encrypted
      * @param keyBlob         The key blob containing the key for the encryption operation.
+     * @param aes             AES-CCM context already expanded from keyBlob, or NULL to expand one
+     *                        for this call.
      * @param msgBuf          The message data to be encrypted. The data buffer must be large enough to handle
      *                        the expansion specified in the ExpansionBytes member variable.
      * @param hdrLen          The length of the header part of the message that will not be encrypted.
@@ -71,7 +74,7 @@ class Crypto {
      *         - ER_BUS_KEYBLOB_OP_INVALID if the key blob cannot be used for encryption.
      *         - Other errors if the arguments are invalid.
      */
-    static QStatus Encrypt(const _Message& message, const qcc::KeyBlob& keyBlob, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen);
+    static QStatus Encrypt(const _Message& message, const qcc::KeyBlob& keyBlob, qcc::Crypto_AES* aes, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen);
 
     /**
      * Decrypt and authenticate marshaled message inplace using the key blob provided and the
@@ -79,6 +82,8 @@ class Crypto {
      *
      * @param message         The message being decrypted
      * @param keyBlob         The key blob containing the key for the decryption operation.
+     * @param aes             AES-CCM context already expanded from keyBlob, or NULL to expand one
+     *                        for this call.
      * @param msgBuf          The message data to be decrypted.
      * @param hdrLen          The length of the non-encrypted header part of the message.
      * @param bodyLen[in/out] On input the size of the crypttext body, on output the size of the
@@ -88,7 +93,7 @@ class Crypto {
      *         - ER_BUS_KEYBLOB_OP_INVALID if the key blob cannot be used for decryption.
      *         - Other errors if the arguments are invalid.
      */
-    static QStatus Decrypt(const _Message& message, const qcc::KeyBlob& keyBlob, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen);
+    static QStatus Decrypt(const _Message& message, const qcc::KeyBlob& keyBlob, qcc::Crypto_AES* aes, uint8_t* msgBuf, size_t hdrLen, size_t& bodyLen);
 
     /**
      * Compute a SHA1 hash over the header fields and return the result in a key blob.
@@ -134,8 +139,28 @@ class Crypto {
      */
     static size_t GetExtraNonceLength(const _Message& message);
 
+    /**
+     * Allocate the buffers the extra nonce values are drawn from. Called from AllJoynInit().
+     */
+    static void Init();
+
+    /**
+     * Release the buffers allocated by Init(). Called from AllJoynShutdown().
+     */
+    static void Shutdown();
+
   private:
 
+    /**
+     * Fill a buffer with random bytes for use as an extra nonce.
+     *
+     * @param data   The buffer to fill.
+     * @param len    The number of bytes to return.
+     *
+     * @return ER_OK if the bytes were generated, otherwise an error from the random number generator.
+     */
+    static QStatus GetExtraNonce(uint8_t* data, size_t len);
+
     /**
      * The length of the message authentication field that will be appended to the encrypted data.
      */
@@ -38,6 +38,7 @@
 #include <qcc/Crypto.h>
 #include <qcc/CryptoECCOldEncoding.h>
 #include <qcc/StringUtil.h>
+#include <qcc/CertificateCache.h>
 #include <qcc/CertificateECC.h>
 #include <qcc/CertificateHelper.h>
 #include <qcc/Debug.h>
@@ -1385,11 +1386,17 @@ bool KeyExchangerECDHE_ECDSA::IsCertChainStructureValid(const CertificateX509* c
             QCC_DbgPrintf(("Certificate basic extension CA is false"));
             return false;
         }
-        if (!certs[cnt + 1].IsIssuerOf(certs[cnt])) {
+        if (!certs[cnt + 1].IsDNEqual(certs[cnt].GetIssuerCN(), certs[cnt].GetIssuerCNLength(),
+                                      certs[cnt].GetIssuerOU(), certs[cnt].GetIssuerOULength())) {
             QCC_DbgPrintf(("Certificate chain issuer DN verification failed"));
             return false;
         }
     }
+    /* Check every link's signature at once. */
+    if (ER_OK != CertificateHelper::VerifyCertChainSignatures(certs, numCerts)) {
+        QCC_DbgPrintf(("Certificate chain signature verification failed"));
+        return false;
+    }
     return true;
 }
 
@@ -1415,7 +1422,7 @@ static void ExtractIssuerPublicKeys(const CertificateX509* certs, size_t numCert
         for (std::vector<std::shared_ptr<PermissionMgmtObj::TrustAnchor> >::const_iterator it = trustAnchorList->begin(); it != trustAnchorList->end(); it++) {
             if ((aki.size() == (*it)->keyInfo.GetKeyIdLen()) &&
                 (memcmp(aki.data(), (*it)->keyInfo.GetKeyId(), aki.size()) == 0) &&
-                (ER_OK == certs[0].Verify((*it)->keyInfo.GetPublicKey()))) {
+                (ER_OK == CertificateCache::Verify(certs[0], (*it)->keyInfo.GetPublicKey()))) {
                 issuerKeys.push_back(*(*it)->keyInfo.GetPublicKey());
             }
         }
@@ -1546,7 +1553,7 @@ QStatus KeyExchangerECDHE_ECDSA::ValidateRemoteVerifierVariant(const char* peerN
             return status;
         }
         if (certChainEncoding == CertificateX509::ENCODING_X509_DER) {
-            status = certs[cnt].DecodeCertificateDER(String((const char*) encoded, encodedLen));
+            status = CertificateCache::DecodeCertificateDER(String((const char*) encoded, encodedLen), certs[cnt]);
         } else if (certChainEncoding == CertificateX509::ENCODING_X509_DER_PEM) {
             status = certs[cnt].DecodeCertificatePEM(String((const char*) encoded, encodedLen));
         } else {
@@ -35,14 +35,18 @@
  ******************************************************************************/
 #include <qcc/platform.h>
 
+#include <deque>
 #include <list>
+#include <vector>
 
+#include <qcc/Condition.h>
 #include <qcc/Debug.h>
 #include <qcc/GUID.h>
 #include <qcc/String.h>
 #include <qcc/StringUtil.h>
 #include <qcc/Thread.h>
 #include <qcc/atomic.h>
+#include <qcc/time.h>
 
 #include <alljoyn/DBusStd.h>
 #include <alljoyn/AllJoynStd.h>
@@ -69,30 +73,36 @@ static const uint32_t LOCAL_ENDPOINT_CONCURRENCY = 4;
 
 #if !defined(LOCAL_ENDPOINT_MAXALARMS)
 /**
- * This ifdef is here to override the dispatcher's 'maxAlarms' value. This mechanism is designed
- * to prevent a possible deadlock in apps. See ASACORE-2810 for details.
+ * This ifdef is here to override the maximum number of queued messages from other endpoints
+ * the dispatcher holds before blocking the caller. This mechanism is designed to prevent a
+ * possible deadlock in apps. See ASACORE-2810 for details.
  *
  * Note that this is a temporary solution as 'maxAlarms' is expected to be removed by ASACORE-2650.
  */
 static const uint32_t LOCAL_ENDPOINT_MAXALARMS = 10;
 #endif
 
-class _LocalEndpoint::Dispatcher : public qcc::Timer, public qcc::AlarmListener {
+/*
+ * The dispatcher runs method and signal handlers on a fixed pool of worker threads fed from a
+ * single FIFO queue. Workers take the reentrancy lock before popping a message so handlers run
+ * one at a time, in arrival order, unless a handler calls EnableReentrancy().
+ */
+class _LocalEndpoint::Dispatcher {
   public:
-    Dispatcher(_LocalEndpoint* endpoint, uint32_t concurrency = LOCAL_ENDPOINT_CONCURRENCY) :
-        Timer("lepDisp" + U32ToString(qcc::IncrementAndFetch(&dispatcherCnt)), true, concurrency, true, LOCAL_ENDPOINT_MAXALARMS),
-        AlarmListener(), endpoint(endpoint), pendingWork(),
-        needDeferredCallbacks(false), needObserverWork(false),
-        needCachedPropertyReplyWork(false),
-        workLock(LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_DISPATCHER_WORKLOCK)
-    {
-        uint32_t zero = 0;
-        qcc::AlarmListener* listener = static_cast<qcc::AlarmListener*>(this);
-        pendingWork = Alarm(zero, listener);
-    }
+    Dispatcher(_LocalEndpoint* endpoint, uint32_t concurrency = LOCAL_ENDPOINT_CONCURRENCY);
+
+    ~Dispatcher();
+
+    QStatus Start();
+    QStatus Stop();
+    QStatus Join();
 
     QStatus DispatchMessage(Message& msg);
 
+    void EnableReentrancy();
+    bool IsHoldingReentrantLock() const;
+    bool IsDispatcherThread() const;
+
     void TriggerDeferredCallbacks();
     void TriggerObserverWork();
     void TriggerCachedPropertyReplyWork();
@@ -101,21 +111,82 @@ class _LocalEndpoint::Dispatcher : public qcc::Timer, public qcc::AlarmListener
     void PerformObserverWork();
     void PerformCachedPropertyReplyWork();
 
-    void AlarmTriggered(const qcc::Alarm& alarm, QStatus reason);
-
   private:
+    class Worker : public qcc::Thread {
+      public:
+        Worker(const qcc::String& name, Dispatcher* dispatcher) :
+            Thread(name), dispatcher(dispatcher), hasReentrancyLock(false) { }
+
+        Dispatcher* dispatcher;
+        bool hasReentrancyLock;
+
+      protected:
+        qcc::ThreadReturn STDCALL Run(void* arg);
+    };
+
+    struct QueuedMessage {
+        QueuedMessage(const Message& msg, bool limitable) : msg(msg), limitable(limitable) { }
+
+        Message msg;
+        bool limitable;
+    };
+
+    /* Must be called with queueLock held */
+    Worker* GetCurrentWorker() const;
+    /* Must be called with queueLock held */
+    QStatus StartWorker();
+    /* Must be called with queueLock held */
+    bool HasPendingWork() const { return needDeferredCallbacks || needObserverWork || needCachedPropertyReplyWork; }
+
+    void WorkerRun(Worker* worker);
+    void PerformPendingWork();
+
     _LocalEndpoint* endpoint;
     static volatile int32_t dispatcherCnt;
 
-    Alarm pendingWork;
+    qcc::String name;
+    std::vector<Worker*> workers;
+    size_t numIdleWorkers;
+    bool isRunning;
+
+    std::deque<QueuedMessage> queue;
+    size_t numLimitable;
+
     bool needDeferredCallbacks;
     bool needObserverWork;
     bool needCachedPropertyReplyWork;
-    qcc::Mutex workLock;
+
+    mutable qcc::Mutex queueLock;
+    qcc::Condition workAvailable;
+    qcc::Condition spaceAvailable;
+    qcc::Mutex reentrancyLock;
 };
 
 volatile int32_t _LocalEndpoint::Dispatcher::dispatcherCnt = 0;
 
+_LocalEndpoint::Dispatcher::Dispatcher(_LocalEndpoint* endpoint, uint32_t concurrency) :
+    endpoint(endpoint),
+    name("lepDisp" + U32ToString(qcc::IncrementAndFetch(&dispatcherCnt))),
+    workers((concurrency > 0) ? concurrency : 1, static_cast<Worker*>(NULL)),
+    numIdleWorkers(0),
+    isRunning(false),
+    numLimitable(0),
+    needDeferredCallbacks(false), needObserverWork(false),
+    needCachedPropertyReplyWork(false),
+    queueLock(LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_DISPATCHER_QUEUELOCK),
+    reentrancyLock(LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_DISPATCHER_REENTRANCYLOCK)
+{
+}
+
+_LocalEndpoint::Dispatcher::~Dispatcher()
+{
+    Stop();
+    Join();
+    for (size_t i = 0; i < workers.size(); ++i) {
+        delete workers[i];
+    }
+}
+
 LocalTransport::~LocalTransport()
 {
     Stop();
@@ -151,39 +222,35 @@ bool LocalTransport::IsRunning()
 #pragma pack(push, ReplyContext, 4)
 class _LocalEndpoint::ReplyContext {
   public:
-    ReplyContext(LocalEndpoint ep,
-                 MessageReceiver* receiver,
+    ReplyContext(MessageReceiver* receiver,
                  MessageReceiver::ReplyHandler handler,
                  const InterfaceDescription::Member* method,
                  Message& methodCall,
                  void* context,
                  uint32_t timeout) :
-        ep(ep),
         receiver(receiver),
         handler(handler),
         method(method),
         callFlags(methodCall->GetFlags()),
         serial(methodCall->msgHeader.serialNum),
-        context(context)
+        context(context),
+        deadline((timeout == Event::WAIT_FOREVER) ? END_OF_TIME : GetTimestamp64() + timeout),
+        timeoutSlot(ReplyTimeouts::NOT_SCHEDULED),
+        timeoutPos(0),
+        timeoutArmed(true)
     {
-        uint32_t zero = 0;
-        void* tempContext = (void*)this;
-        AlarmListener* listener = ep.unwrap();
-        alarm = Alarm(timeout, listener, tempContext, zero);
-    }
-
-    ~ReplyContext() {
-        ep->replyTimer.RemoveAlarm(alarm, false /* don't block if alarm in progress */);
     }
 
-    LocalEndpoint ep;                            /* The endpoint this reply context is associated with */
     MessageReceiver* receiver;                   /* The object to receive the reply */
     MessageReceiver::ReplyHandler handler;       /* The receiving object's handler function */
     const InterfaceDescription::Member* method;  /* The method that was called */
     uint8_t callFlags;                           /* Flags from the method call */
     uint32_t serial;                             /* Serial number for the method reply */
     void* context;                               /* The calling object's context */
-    qcc::Alarm alarm;                            /* Alarm object for handling method call timeouts */
+    uint64_t deadline;                           /* Absolute time (ms) the method call times out */
+    uint32_t timeoutSlot;                        /* Bucket in replyTimeouts, managed by ReplyTimeoutWheel */
+    uint32_t timeoutPos;                         /* Position in the bucket, managed by ReplyTimeoutWheel */
+    bool timeoutArmed;                           /* true until the timeout fires or is paused */
 
   private:
     ReplyContext(const ReplyContext& other);
@@ -220,15 +287,33 @@ class _LocalEndpoint::CachedGetPropertyReplyContext {
 
 };
 
+class _LocalEndpoint::ReplyReaper : public qcc::Thread {
+  public:
+    ReplyReaper(_LocalEndpoint* endpoint) : Thread("replyReaper"), endpoint(endpoint) { }
+
+  protected:
+    qcc::ThreadReturn STDCALL Run(void* arg)
+    {
+        QCC_UNUSED(arg);
+        endpoint->RunReplyReaper();
+        return (ThreadReturn)0;
+    }
+
+  private:
+    _LocalEndpoint* endpoint;
+};
+
 _LocalEndpoint::_LocalEndpoint(BusAttachment& bus, uint32_t concurrency) :
     _BusEndpoint(ENDPOINT_TYPE_LOCAL),
     dispatcher(new Dispatcher(this, concurrency)),
+    replyTimeouts(GetTimestamp64()),
     running(false),
     isRegistered(false),
     bus(&bus),
     objectsLock(LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_OBJECTSLOCK),
     replyMapLock(LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_REPLYMAPLOCK),
-    replyTimer("replyTimer", true),
+    replyReaper(new ReplyReaper(this)),
+    nextReplySweep(0),
     dbusObj(NULL),
     alljoynObj(NULL),
     alljoynDebugObj(NULL),
@@ -250,12 +335,26 @@ _LocalEndpoint::~_LocalEndpoint()
          * Delete any stale reply contexts
          */
         replyMapLock.Lock(MUTEX_CONTEXT);
-        for (map<uint32_t, ReplyContext*>::iterator iter = replyMap.begin(); iter != replyMap.end(); ++iter) {
-            QCC_DbgHLPrintf(("LocalEndpoint~LocalEndpoint deleting reply handler for serial %u", iter->second->serial));
-            delete iter->second;
+        vector<ReplyContext*> contexts;
+        replyMap.GetAll(contexts);
+        for (vector<ReplyContext*>::iterator iter = contexts.begin(); iter != contexts.end(); ++iter) {
+            QCC_DbgHLPrintf(("LocalEndpoint~LocalEndpoint deleting reply handler for serial %u", (*iter)->serial));
+            delete RemoveReplyHandler((*iter)->serial);
         }
-        replyMap.clear();
         replyMapLock.Unlock(MUTEX_CONTEXT);
+
+        /*
+         * Shutdown the reply reaper
+         */
+        if (replyReaper) {
+            replyReaper->Stop();
+            replyMapLock.Lock(MUTEX_CONTEXT);
+            replyTimeoutsChanged.Signal();
+            replyMapLock.Unlock(MUTEX_CONTEXT);
+            replyReaper->Join();
+            delete replyReaper;
+            replyReaper = NULL;
+        }
         /*
          * Unregister all application registered bus objects
          */
@@ -306,9 +405,9 @@ QStatus _LocalEndpoint::Start()
     }
     status = dispatcher->Start();
 
-    /* Start the replyTimer */
+    /* Start the replyReaper */
     if (status == ER_OK) {
-        status = replyTimer.Start();
+        status = replyReaper->Start();
     }
 
     /* Set the local endpoint's unique name */
@@ -373,8 +472,13 @@ QStatus _LocalEndpoint::Stop(void)
         dispatcher->Stop();
     }
 
-    /* Stop the replyTimer */
-    replyTimer.Stop();
+    /* Stop the replyReaper */
+    if (replyReaper) {
+        replyReaper->Stop();
+        replyMapLock.Lock(MUTEX_CONTEXT);
+        replyTimeoutsChanged.Signal();
+        replyMapLock.Unlock(MUTEX_CONTEXT);
+    }
     return ER_OK;
 }
 
@@ -398,8 +502,10 @@ QStatus _LocalEndpoint::Join(void)
         dispatcher->Join();
     }
 
-    /* Join the replyTimer */
-    replyTimer.Join();
+    /* Join the replyReaper */
+    if (replyReaper) {
+        replyReaper->Join();
+    }
 
     return ER_OK;
 }
@@ -456,22 +562,167 @@ QStatus _LocalEndpoint::PeerInterface(Message& message)
 }
 
 
+QStatus _LocalEndpoint::Dispatcher::Start()
+{
+    QStatus status = ER_OK;
+    queueLock.Lock(MUTEX_CONTEXT);
+    if (!isRunning) {
+        /* Reclaim the workers of a previous Start/Stop/Join cycle */
+        for (size_t i = 0; i < workers.size(); ++i) {
+            if (workers[i] != NULL) {
+                queueLock.Unlock(MUTEX_CONTEXT);
+                workers[i]->Join();
+                queueLock.Lock(MUTEX_CONTEXT);
+                delete workers[i];
+                workers[i] = NULL;
+            }
+        }
+        isRunning = true;
+        status = StartWorker();
+        isRunning = (status == ER_OK);
+    }
+    queueLock.Unlock(MUTEX_CONTEXT);
+    return status;
+}
+
+QStatus _LocalEndpoint::Dispatcher::Stop()
+{
+    std::deque<QueuedMessage> dropped;
+
+    queueLock.Lock(MUTEX_CONTEXT);
+    isRunning = false;
+    for (size_t i = 0; i < workers.size(); ++i) {
+        if (workers[i] != NULL) {
+            workers[i]->Stop();
+        }
+    }
+    /* Messages that have not been dispatched yet are discarded */
+    dropped.swap(queue);
+    numLimitable = 0;
+    needDeferredCallbacks = false;
+    needObserverWork = false;
+    needCachedPropertyReplyWork = false;
+    workAvailable.Broadcast();
+    spaceAvailable.Broadcast();
+    queueLock.Unlock(MUTEX_CONTEXT);
+    return ER_OK;
+}
+
+QStatus _LocalEndpoint::Dispatcher::Join()
+{
+    QStatus status = ER_OK;
+    queueLock.Lock(MUTEX_CONTEXT);
+    for (size_t i = 0; i < workers.size(); ++i) {
+        if (workers[i] != NULL) {
+            queueLock.Unlock(MUTEX_CONTEXT);
+            QStatus tStatus = workers[i]->Join();
+            queueLock.Lock(MUTEX_CONTEXT);
+            status = (status == ER_OK) ? tStatus : status;
+        }
+    }
+    queueLock.Unlock(MUTEX_CONTEXT);
+    return status;
+}
+
+QStatus _LocalEndpoint::Dispatcher::StartWorker()
+{
+    for (size_t i = 0; i < workers.size(); ++i) {
+        if (workers[i] == NULL) {
+            workers[i] = new Worker(name + "_" + U32ToString(i), this);
+            QStatus status = workers[i]->Start();
+            if (status != ER_OK) {
+                QCC_LogError(status, ("Failed to start dispatcher thread %s", workers[i]->GetName()));
+                delete workers[i];
+                workers[i] = NULL;
+            }
+            return status;
+        }
+    }
+    return ER_OK;
+}
+
+_LocalEndpoint::Dispatcher::Worker* _LocalEndpoint::Dispatcher::GetCurrentWorker() const
+{
+    Thread* thread = Thread::GetThread();
+    for (size_t i = 0; i < workers.size(); ++i) {
+        if ((workers[i] != NULL) && (static_cast<Thread*>(workers[i]) == thread)) {
+            return workers[i];
+        }
+    }
+    return NULL;
+}
+
+bool _LocalEndpoint::Dispatcher::IsDispatcherThread() const
+{
+    queueLock.Lock(MUTEX_CONTEXT);
+    bool result = (GetCurrentWorker() != NULL);
+    queueLock.Unlock(MUTEX_CONTEXT);
+    return result;
+}
+
+bool _LocalEndpoint::Dispatcher::IsHoldingReentrantLock() const
+{
+    queueLock.Lock(MUTEX_CONTEXT);
+    Worker* worker = GetCurrentWorker();
+    queueLock.Unlock(MUTEX_CONTEXT);
+    return worker && worker->hasReentrancyLock;
+}
+
+void _LocalEndpoint::Dispatcher::EnableReentrancy()
+{
+    queueLock.Lock(MUTEX_CONTEXT);
+    Worker* worker = GetCurrentWorker();
+    if (!worker) {
+        queueLock.Unlock(MUTEX_CONTEXT);
+        QCC_LogError(ER_TIMER_NOT_ALLOWED, ("Invalid call to Dispatcher::EnableReentrancy from thread %s", Thread::GetThreadName()));
+        return;
+    }
+    if (!worker->hasReentrancyLock) {
+        queueLock.Unlock(MUTEX_CONTEXT);
+        return;
+    }
+    /*
+     * The calling handler may now block waiting on another message (e.g. the
+     * reply to a synchronous method call), so make sure some other worker is
+     * free to dispatch it.
+     */
+    if (isRunning && (numIdleWorkers == 0)) {
+        StartWorker();
+    }
+    queueLock.Unlock(MUTEX_CONTEXT);
+
+    worker->hasReentrancyLock = false;
+    reentrancyLock.Unlock(MUTEX_CONTEXT);
+}
+
 QStatus _LocalEndpoint::Dispatcher::DispatchMessage(Message& msg)
 {
-    uint32_t zero = 0;
-    void* context = new Message(msg);
-    qcc::AlarmListener* localEndpointListener = this;
     bool limitable = (endpoint->GetUniqueName() != msg->GetSender());
-    Alarm alarm(zero, localEndpointListener, context, zero, limitable);
 
-    QStatus status = AddAlarm(alarm);
-    if (status != ER_OK) {
-        Message* temp = static_cast<Message*>(context);
-        if (temp) {
-            delete temp;
+    queueLock.Lock(MUTEX_CONTEXT);
+    /*
+     * Apply back-pressure to other endpoints flooding us with messages. A
+     * dispatcher thread is never blocked here since it may be the one that
+     * needs to drain the queue.
+     */
+    if (LOCAL_ENDPOINT_MAXALARMS && limitable && (numLimitable >= LOCAL_ENDPOINT_MAXALARMS) && isRunning) {
+        if (GetCurrentWorker() == NULL) {
+            while ((numLimitable >= LOCAL_ENDPOINT_MAXALARMS) && isRunning) {
+                spaceAvailable.Wait(queueLock);
+            }
         }
     }
-    return status;
+    if (!isRunning) {
+        queueLock.Unlock(MUTEX_CONTEXT);
+        return ER_BUS_STOPPING;
+    }
+    queue.push_back(QueuedMessage(msg, limitable));
+    if (limitable) {
+        ++numLimitable;
+    }
+    workAvailable.Signal();
+    queueLock.Unlock(MUTEX_CONTEXT);
+    return ER_OK;
 }
 
 void _LocalEndpoint::EnableReentrancy()
@@ -491,68 +742,47 @@ bool _LocalEndpoint::IsReentrantCall()
 
 void _LocalEndpoint::Dispatcher::TriggerDeferredCallbacks()
 {
-    workLock.Lock(MUTEX_CONTEXT);
-    if (needDeferredCallbacks) {
-        workLock.Unlock(MUTEX_CONTEXT);
-        return;
-    }
-    needDeferredCallbacks = true;
-    workLock.Unlock(MUTEX_CONTEXT);
-
     /*
-     * Don't block while adding the alarm.
-     * First, we may be calling this method from within the context of a
-     * triggered Alarm. In this case a blocking AddAlarm is an instant
-     * deadlock.
-     * Second, AddAlarm would only block if the our alarm queue is already
-     * full. The work will be picked up by the first existing alarm that
-     * triggers anyway.
+     * Never blocks, so this may be called from within a handler running on a
+     * dispatcher thread. The work is picked up by the next worker that becomes
+     * available.
      */
-    AddAlarmNonBlocking(pendingWork);
+    queueLock.Lock(MUTEX_CONTEXT);
+    if (!needDeferredCallbacks) {
+        needDeferredCallbacks = true;
+        workAvailable.Signal();
+    }
+    queueLock.Unlock(MUTEX_CONTEXT);
 }
 
 void _LocalEndpoint::Dispatcher::TriggerObserverWork()
 {
-    workLock.Lock(MUTEX_CONTEXT);
-    if (needObserverWork) {
-        workLock.Unlock(MUTEX_CONTEXT);
-        return;
-    }
-    needObserverWork = true;
-    workLock.Unlock(MUTEX_CONTEXT);
-
     /*
-     * Don't block while adding the alarm.
-     * First, we may be calling this method from within the context of a
-     * triggered Alarm. In this case a blocking AddAlarm is an instant
-     * deadlock.
-     * Second, AddAlarm would only block if the our alarm queue is already
-     * full. The work will be picked up by the first existing alarm that
-     * triggers anyway.
+     * Never blocks, so this may be called from within a handler running on a
+     * dispatcher thread. The work is picked up by the next worker that becomes
+     * available.
      */
-    AddAlarmNonBlocking(pendingWork);
+    queueLock.Lock(MUTEX_CONTEXT);
+    if (!needObserverWork) {
+        needObserverWork = true;
+        workAvailable.Signal();
+    }
+    queueLock.Unlock(MUTEX_CONTEXT);
 }
 
 void _LocalEndpoint::Dispatcher::TriggerCachedPropertyReplyWork()
 {
-    workLock.Lock(MUTEX_CONTEXT);
-    if (needCachedPropertyReplyWork) {
-        workLock.Unlock(MUTEX_CONTEXT);
-        return;
-    }
-    needCachedPropertyReplyWork = true;
-    workLock.Unlock(MUTEX_CONTEXT);
-
     /*
-     * Don't block while adding the alarm.
-     * First, we may be calling this method from within the context of a
-     * triggered Alarm. In this case a blocking AddAlarm is an instant
-     * deadlock.
-     * Second, AddAlarm would only block if the our alarm queue is already
-     * full. The work will be picked up by the first existing alarm that
-     * triggers anyway.
+     * Never blocks, so this may be called from within a handler running on a
+     * dispatcher thread. The work is picked up by the next worker that becomes
+     * available.
      */
-    AddAlarmNonBlocking(pendingWork);
+    queueLock.Lock(MUTEX_CONTEXT);
+    if (!needCachedPropertyReplyWork) {
+        needCachedPropertyReplyWork = true;
+        workAvailable.Signal();
+    }
+    queueLock.Unlock(MUTEX_CONTEXT);
 }
 
 void _LocalEndpoint::Dispatcher::PerformDeferredCallbacks()
@@ -609,53 +839,93 @@ void _LocalEndpoint::Dispatcher::PerformCachedPropertyReplyWork()
     endpoint->replyMapLock.Unlock(MUTEX_CONTEXT);
 }
 
-void _LocalEndpoint::Dispatcher::AlarmTriggered(const Alarm& alarm, QStatus reason)
+ThreadReturn STDCALL _LocalEndpoint::Dispatcher::Worker::Run(void* arg)
 {
-    /* first deal with incoming messages */
-    Message* msg = static_cast<Message*>(alarm->GetContext());
-    if (msg) {
-        if (reason == ER_OK) {
-            QStatus status = endpoint->DoPushMessage(*msg);
+    QCC_UNUSED(arg);
+    dispatcher->WorkerRun(this);
+    return (ThreadReturn)0;
+}
+
+void _LocalEndpoint::Dispatcher::WorkerRun(Worker* worker)
+{
+    queueLock.Lock(MUTEX_CONTEXT);
+    while (isRunning) {
+        if (queue.empty() && !HasPendingWork()) {
+            ++numIdleWorkers;
+            workAvailable.Wait(queueLock);
+            --numIdleWorkers;
+            continue;
+        }
+        queueLock.Unlock(MUTEX_CONTEXT);
+
+        /*
+         * Take the reentrancy lock before picking a message off the queue so
+         * that handlers are invoked one at a time and in arrival order.
+         */
+        reentrancyLock.Lock(MUTEX_CONTEXT);
+        worker->hasReentrancyLock = true;
+
+        queueLock.Lock(MUTEX_CONTEXT);
+        if (isRunning && !queue.empty()) {
+            Message msg = queue.front().msg;
+            if (queue.front().limitable) {
+                --numLimitable;
+                spaceAvailable.Signal();
+            }
+            queue.pop_front();
+            queueLock.Unlock(MUTEX_CONTEXT);
+
+            /* first deal with incoming messages */
+            QStatus status = endpoint->DoPushMessage(msg);
             // ER_BUS_STOPPING is a common shutdown error
             if (status != ER_OK && status != ER_BUS_STOPPING) {
                 QCC_LogError(status, ("LocalEndpoint::DoPushMessage failed"));
             }
+        } else {
+            queueLock.Unlock(MUTEX_CONTEXT);
         }
-        delete msg;
-    }
 
-    /* next, deal with any pending work */
-    if (reason != ER_OK) {
-        return;
+        /* next, deal with any pending work */
+        PerformPendingWork();
+
+        if (worker->hasReentrancyLock) {
+            worker->hasReentrancyLock = false;
+            reentrancyLock.Unlock(MUTEX_CONTEXT);
+        }
+        queueLock.Lock(MUTEX_CONTEXT);
     }
+    queueLock.Unlock(MUTEX_CONTEXT);
+}
 
-    workLock.Lock(MUTEX_CONTEXT);
+void _LocalEndpoint::Dispatcher::PerformPendingWork()
+{
+    queueLock.Lock(MUTEX_CONTEXT);
 
-    if (needObserverWork) {
+    if (needObserverWork && isRunning) {
         needObserverWork = false;
-        workLock.Unlock(MUTEX_CONTEXT);
+        queueLock.Unlock(MUTEX_CONTEXT);
         PerformObserverWork();
-        workLock.Lock(MUTEX_CONTEXT);
+        queueLock.Lock(MUTEX_CONTEXT);
     }
 
-    if (needCachedPropertyReplyWork) {
+    if (needCachedPropertyReplyWork && isRunning) {
         needCachedPropertyReplyWork = false;
-        workLock.Unlock(MUTEX_CONTEXT);
+        queueLock.Unlock(MUTEX_CONTEXT);
         PerformCachedPropertyReplyWork();
-        workLock.Lock(MUTEX_CONTEXT);
+        queueLock.Lock(MUTEX_CONTEXT);
     }
 
     /*
      * DeferredCallbacks work has to go last, because it enables concurrent callbacks
      * by default, and we don't want this to influence any of the preceding work items.
      */
-    if (needDeferredCallbacks) {
+    if (needDeferredCallbacks && isRunning) {
         needDeferredCallbacks = false;
-        workLock.Unlock(MUTEX_CONTEXT);
+        queueLock.Unlock(MUTEX_CONTEXT);
         PerformDeferredCallbacks();
-        workLock.Lock(MUTEX_CONTEXT);
+        queueLock.Lock(MUTEX_CONTEXT);
     }
-    workLock.Unlock(MUTEX_CONTEXT);
+    queueLock.Unlock(MUTEX_CONTEXT);
 }
 
 QStatus _LocalEndpoint::PushMessage(Message& message)
@@ -665,7 +935,7 @@ QStatus _LocalEndpoint::PushMessage(Message& message)
     if (running) {
         BusEndpoint ep = bus->GetInternal().GetRouter().FindEndpoint(message->GetSender());
         /* Determine if the source of this message is local to the process */
-        if ((ep->GetEndpointType() == ENDPOINT_TYPE_LOCAL) && (dispatcher->IsTimerCallbackThread())) {
+        if ((ep->GetEndpointType() == ENDPOINT_TYPE_LOCAL) && (dispatcher->IsDispatcherThread())) {
             ret = DoPushMessage(message);
         } else {
             ret = dispatcher->DispatchMessage(message);
@@ -940,10 +1210,10 @@ void _LocalEndpoint::UpdateSerialNumber(Message& msg)
          */
         if (msg->GetType() == MESSAGE_METHOD_CALL) {
             replyMapLock.Lock(MUTEX_CONTEXT);
-            ReplyContext* rc = RemoveReplyHandler(serial);
+            ReplyContext* rc = replyMap.Remove(serial);
             if (rc) {
                 rc->serial = msg->msgHeader.serialNum;
-                replyMap[rc->serial] = rc;
+                QCC_VERIFY(replyMap.Insert(rc->serial, rc));
             }
             replyMapLock.Unlock(MUTEX_CONTEXT);
         }
@@ -963,26 +1233,34 @@ QStatus _LocalEndpoint::RegisterReplyHandler(MessageReceiver* receiver,
         status = ER_BUS_STOPPING;
         QCC_LogError(status, ("Local transport not running"));
     } else {
-        ReplyContext* rc =  new ReplyContext(LocalEndpoint::wrap(this), receiver, replyHandler, &method, methodCallMsg, context, timeout);
+        ReplyContext* rc =  new ReplyContext(receiver, replyHandler, &method, methodCallMsg, context, timeout);
         QCC_DbgPrintf(("LocalEndpoint::RegisterReplyHandler"));
         /*
-         * Add reply context.
+         * Add reply context and set timeout.
          */
         replyMapLock.Lock(MUTEX_CONTEXT);
-        QCC_ASSERT(replyMap.find(methodCallMsg->msgHeader.serialNum) == replyMap.end());
-        replyMap[methodCallMsg->msgHeader.serialNum] = rc;
+        QCC_VERIFY(replyMap.Insert(methodCallMsg->msgHeader.serialNum, rc));
+        ScheduleReplyTimeout(rc);
         replyMapLock.Unlock(MUTEX_CONTEXT);
-        /*
-         * Set timeout
-         */
-        status = replyTimer.AddAlarm(rc->alarm);
-        if (status != ER_OK) {
-            UnregisterReplyHandler(methodCallMsg);
-        }
     }
     return status;
 }
 
+/*
+ * NOTE: Must be called holding replyMapLock
+ */
+void _LocalEndpoint::ScheduleReplyTimeout(ReplyContext* rc)
+{
+    if (rc->deadline == END_OF_TIME) {
+        return;
+    }
+    replyTimeouts.Add(rc);
+    /* Wake up the reaper if it is going to sleep past this deadline */
+    if ((nextReplySweep == 0) || (rc->deadline < nextReplySweep)) {
+        replyTimeoutsChanged.Signal();
+    }
+}
+
 bool _LocalEndpoint::UnregisterReplyHandler(Message& methodCall)
 {
     replyMapLock.Lock(MUTEX_CONTEXT);
@@ -1002,11 +1280,9 @@ bool _LocalEndpoint::UnregisterReplyHandler(Message& methodCall)
 _LocalEndpoint::ReplyContext* _LocalEndpoint::RemoveReplyHandler(uint32_t serial)
 {
     QCC_DbgPrintf(("LocalEndpoint::RemoveReplyHandler for serial=%u", serial));
-    ReplyContext* rc = NULL;
-    map<uint32_t, ReplyContext*>::iterator iter = replyMap.find(serial);
-    if (iter != replyMap.end()) {
-        rc = iter->second;
-        replyMap.erase(iter);
+    ReplyContext* rc = replyMap.Remove(serial);
+    if (rc) {
+        replyTimeouts.Remove(rc);
         QCC_ASSERT(rc->serial == serial);
     }
     return rc;
@@ -1017,10 +1293,11 @@ bool _LocalEndpoint::PauseReplyHandlerTimeout(Message& methodCallMsg)
     bool paused = false;
     if (methodCallMsg->GetType() == MESSAGE_METHOD_CALL) {
         replyMapLock.Lock(MUTEX_CONTEXT);
-        map<uint32_t, ReplyContext*>::iterator iter = replyMap.find(methodCallMsg->GetCallSerial());
-        if (iter != replyMap.end()) {
-            ReplyContext*rc = iter->second;
-            paused = replyTimer.RemoveAlarm(rc->alarm);
+        ReplyContext* rc = replyMap.Find(methodCallMsg->GetCallSerial());
+        if (rc && rc->timeoutArmed) {
+            rc->timeoutArmed = false;
+            replyTimeouts.Remove(rc);
+            paused = true;
         }
         replyMapLock.Unlock(MUTEX_CONTEXT);
     }
@@ -1032,15 +1309,14 @@ bool _LocalEndpoint::ResumeReplyHandlerTimeout(Message& methodCallMsg)
     bool resumed = false;
     if (methodCallMsg->GetType() == MESSAGE_METHOD_CALL) {
         replyMapLock.Lock(MUTEX_CONTEXT);
-        map<uint32_t, ReplyContext*>::iterator iter = replyMap.find(methodCallMsg->GetCallSerial());
-        if (iter != replyMap.end()) {
-            ReplyContext*rc = iter->second;
-            QStatus status = replyTimer.AddAlarm(rc->alarm);
-            if (status == ER_OK) {
-                resumed = true;
-            } else {
-                QCC_LogError(status, ("Failed to resume reply handler timeout for %s", methodCallMsg->Description().c_str()));
+        ReplyContext* rc = replyMap.Find(methodCallMsg->GetCallSerial());
+        if (rc) {
+            /* The timeout keeps its original deadline */
+            if (!rc->timeoutArmed) {
+                rc->timeoutArmed = true;
+                ScheduleReplyTimeout(rc);
             }
+            resumed = true;
         }
         replyMapLock.Unlock(MUTEX_CONTEXT);
     }
@@ -1135,14 +1411,11 @@ QStatus _LocalEndpoint::UnregisterAllHandlers(MessageReceiver* receiver)
      * Remove any reply handlers for this receiver
      */
     replyMapLock.Lock(MUTEX_CONTEXT);
-    for (map<uint32_t, ReplyContext*>::iterator iter = replyMap.begin(); iter != replyMap.end();) {
-        ReplyContext* rc = iter->second;
-        if (rc->receiver == receiver) {
-            replyMap.erase(iter);
-            delete rc;
-            iter = replyMap.begin();
-        } else {
-            ++iter;
+    vector<ReplyContext*> contexts;
+    replyMap.GetAll(contexts);
+    for (vector<ReplyContext*>::iterator iter = contexts.begin(); iter != contexts.end(); ++iter) {
+        if ((*iter)->receiver == receiver) {
+            delete RemoveReplyHandler((*iter)->serial);
         }
     }
 
@@ -1162,35 +1435,71 @@ QStatus _LocalEndpoint::UnregisterAllHandlers(MessageReceiver* receiver)
     return ER_OK;
 }
 
-/*
- * Alarm handler for method calls that have not received a response within the timeout period.
- */
-void _LocalEndpoint::AlarmTriggered(const Alarm& alarm, QStatus reason)
+void _LocalEndpoint::RunReplyReaper()
 {
-    ReplyContext* rc = reinterpret_cast<ReplyContext*>(alarm->GetContext());
+    vector<ReplyContext*> expired;
+    vector<uint32_t> serials;
+
     replyMapLock.Lock(MUTEX_CONTEXT);
-    /* Search for the ReplyContext entry in the replyMap */
-    bool found = false;
-    for (map<uint32_t, ReplyContext*>::iterator iter = replyMap.begin(); iter != replyMap.end(); iter++) {
-        if (rc == iter->second) {
-            found = true;
-            break;
+    while (!replyReaper->IsStopping()) {
+        expired.clear();
+        replyTimeouts.Expire(GetTimestamp64(), expired);
+        if (!expired.empty()) {
+            serials.clear();
+            for (vector<ReplyContext*>::iterator it = expired.begin(); it != expired.end(); ++it) {
+                (*it)->timeoutArmed = false;
+                /*
+                 * Clear the encrypted flag so the error response doesn't get rejected.
+                 */
+                (*it)->callFlags &= ~ALLJOYN_FLAG_ENCRYPTED;
+                serials.push_back((*it)->serial);
+            }
+            nextReplySweep = 1;
+            replyMapLock.Unlock(MUTEX_CONTEXT);
+            for (vector<uint32_t>::iterator it = serials.begin(); it != serials.end(); ++it) {
+                ReplyTimedOut(*it, ER_OK);
+            }
+            replyMapLock.Lock(MUTEX_CONTEXT);
+            continue;
+        }
+        nextReplySweep = replyTimeouts.NextSweep();
+        if (nextReplySweep == 0) {
+            replyTimeoutsChanged.Wait(replyMapLock);
+        } else {
+            uint64_t now = GetTimestamp64();
+            if (nextReplySweep > now) {
+                replyTimeoutsChanged.TimedWait(replyMapLock, static_cast<uint32_t>(nextReplySweep - now));
+            }
         }
     }
 
-    if (found == false) {
-        /* If an entry for the ReplyContext is not found, it might have been deleted due to a MethodReply. */
-        replyMapLock.Unlock(MUTEX_CONTEXT);
-        return;
-    }
-    uint32_t serial = rc->serial;
-    Message msg(*bus);
-
     /*
-     * Clear the encrypted flag so the error response doesn't get rejected.
+     * Method calls still waiting for a reply when the endpoint stops get an exiting error.
      */
-    rc->callFlags &= ~ALLJOYN_FLAG_ENCRYPTED;
+    expired.clear();
+    replyMap.GetAll(expired);
+    serials.clear();
+    for (vector<ReplyContext*>::iterator it = expired.begin(); it != expired.end(); ++it) {
+        if ((*it)->timeoutArmed) {
+            (*it)->timeoutArmed = false;
+            replyTimeouts.Remove(*it);
+            (*it)->callFlags &= ~ALLJOYN_FLAG_ENCRYPTED;
+            serials.push_back((*it)->serial);
+        }
+    }
+    nextReplySweep = 0;
     replyMapLock.Unlock(MUTEX_CONTEXT);
+    for (vector<uint32_t>::iterator it = serials.begin(); it != serials.end(); ++it) {
+        ReplyTimedOut(*it, ER_TIMER_EXITING);
+    }
+}
+
+/*
+ * Handler for method calls that have not received a response within the timeout period.
+ */
+void _LocalEndpoint::ReplyTimedOut(uint32_t serial, QStatus reason)
+{
+    Message msg(*bus);
 
     QStatus status = ER_OK;
     bool attemptDispatch = running;
@@ -1354,8 +1663,9 @@ QStatus _LocalEndpoint::HandleSignal(Message& message)
      */
     list<SignalTable::Entry> callList;
     const InterfaceDescription::Member* signal = range.first->second.member;
+    ParsedMessage parsed(message);
     do {
-        if (range.first->second.rule.IsMatch(message)) {
+        if (range.first->second.rule.IsMatch(parsed)) {
             callList.push_back(range.first->second);
         }
     } while (++range.first != range.second);
@@ -58,6 +58,7 @@
 
 #include "BusEndpoint.h"
 #include "MethodTable.h"
+#include "ReplyTable.h"
 #include "SignalTable.h"
 #include "Transport.h"
 
@@ -78,7 +79,7 @@ typedef qcc::ManagedObj<_LocalEndpoint> LocalEndpoint;
 /**
  * %LocalEndpoint represents an endpoint connection to DBus/AllJoyn server
  */
-class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public MessageReceiver {
+class _LocalEndpoint : public _BusEndpoint, public MessageReceiver {
 
     friend class LocalTransport;
     friend class BusObject;
@@ -88,7 +89,7 @@ class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public Me
     /**
      * Default constructor initializes an invalid endpoint. This allows for the declaration of uninitialized LocalEndpoint variables.
      */
-    _LocalEndpoint() : dispatcher(NULL), bus(NULL), replyTimer("replyTimer", true) { }
+    _LocalEndpoint() : dispatcher(NULL), bus(NULL), replyReaper(NULL), nextReplySweep(0) { }
 
     /**
      * Constructor
@@ -447,6 +448,16 @@ class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public Me
      */
     class ReplyContext;
 
+    /**
+     * Type definition for the method call reply timeouts
+     */
+    typedef ReplyTimeoutWheel<ReplyContext> ReplyTimeouts;
+
+    /**
+     * Thread that times out method calls
+     */
+    class ReplyReaper;
+
     /**
      * Type definition for a cached GetPropertyAsync reply context
      */
@@ -470,6 +481,13 @@ class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public Me
      */
     ReplyContext* RemoveReplyHandler(uint32_t serial);
 
+    /**
+     * Schedule the timeout of a reply context.
+     *
+     * @param rc  The reply context.
+     */
+    void ScheduleReplyTimeout(ReplyContext* rc);
+
     /**
      * Hash functor
      */
@@ -486,9 +504,14 @@ class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public Me
     std::unordered_map<const char*, BusObject*, Hash, PathEq> localObjects;
 
     /**
-     * List of contexts for method call replies.
+     * Contexts for method call replies indexed by serial number.
+     */
+    ReplyTable<ReplyContext> replyMap;
+
+    /**
+     * Pending method call timeouts. Protected with the replyMapLock.
      */
-    std::map<uint32_t, ReplyContext*> replyMap;
+    ReplyTimeouts replyTimeouts;
 
     /**
      * List of contexts for cached GetProperty replies.
@@ -508,7 +531,9 @@ class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public Me
     qcc::Mutex replyMapLock;           /**< Mutex protecting reply contexts */
     qcc::GUID128 guid;                 /**< GUID to uniquely identify a local endpoint */
     qcc::String uniqueName;            /**< Unique name for endpoint */
-    qcc::Timer replyTimer;             /**< Timer used to timeout method calls */
+    ReplyReaper* replyReaper;          /**< Thread used to timeout method calls */
+    qcc::Condition replyTimeoutsChanged; /**< Signaled when the reply reaper needs to wake up early */
+    uint64_t nextReplySweep;           /**< Time the reply reaper will next wake up or 0 if not scheduled */
 
     std::vector<BusObject*> defaultObjects;  /**< Auto-generated, heap allocated parent objects */
 
@@ -561,8 +586,16 @@ class _LocalEndpoint : public _BusEndpoint, public qcc::AlarmListener, public Me
 
     /**
      *   Process a timeout on a METHOD_REPLY message
+     *
+     * @param serial  The serial number of the method call that timed out.
+     * @param reason  ER_OK if the method call timed out or ER_TIMER_EXITING if the endpoint is stopping.
+     */
+    void ReplyTimedOut(uint32_t serial, QStatus reason);
+
+    /**
+     * Main loop of the reply reaper thread.
      */
-    void AlarmTriggered(const qcc::Alarm& alarm, QStatus reason);
+    void RunReplyReaper();
 
     /**
      * Inner utility method used bo RegisterBusObject.
@@ -38,6 +38,7 @@
 #include <ctype.h>
 #include <limits>
 
+#include <qcc/atomic.h>
 #include <qcc/String.h>
 #include <qcc/Mutex.h>
 #include <qcc/String.h>
@@ -338,7 +339,6 @@ void _Message::Init(BusAttachment& busAttachment)
 {
     this->bus = &busAttachment;
     endianSwap = false;
-    _msgBuf = NULL;
     msgBuf = NULL;
     msgArgs = NULL;
     numMsgArgs = 0;
@@ -352,8 +352,6 @@ void _Message::Init(BusAttachment& busAttachment)
     authVersion = -1;
     readState = MESSAGE_NEW;
     countRead = 0;
-    writeState = MESSAGE_NEW;
-    countWrite = 0;
     msgHeader.msgType = MESSAGE_INVALID;
     msgHeader.endian = myEndian;
     encryptionNotification = NULL;
@@ -362,7 +360,7 @@ void _Message::Init(BusAttachment& busAttachment)
 
 _Message::~_Message(void)
 {
-    delete [] _msgBuf;
+    ReleaseBuffer(msgBuf);
     delete [] msgArgs;
     while (numHandles) {
         qcc::Close(handles[--numHandles]);
@@ -388,31 +386,19 @@ _Message::_Message(const _Message& other) :
     authVersion(other.authVersion),
     readState(other.readState),
     countRead(other.countRead),
-    writeState(other.writeState),
-    countWrite(other.countWrite),
     hdrFields(other.hdrFields),
     encryptionNotification(other.encryptionNotification),
     authorizationChecked(other.authorizationChecked)
 {
-    if (bufSize > 0) {
-        QCC_ASSERT(other.msgBuf != NULL);
-        _msgBuf = new uint8_t[bufSize + 7];
-        msgBuf = (uint64_t*)((uintptr_t)(_msgBuf + 7) & ~7);
-        bufEOD = ((uint8_t*)msgBuf) + (other.bufEOD - ((uint8_t*)other.msgBuf));
-        bufPos = ((uint8_t*)msgBuf) + (other.bufPos - ((uint8_t*)other.msgBuf));
-        bodyPtr = ((uint8_t*)msgBuf) + (other.bodyPtr - ((uint8_t*)other.msgBuf));
-        /*
-         * Copy in buffer and zero fill the pad at the end of the data
-         */
-        ::memcpy(msgBuf, other.msgBuf, bufSize);
-        ::memset(bufEOD, 0, (uint8_t*)msgBuf + bufSize - bufEOD);
-    } else {
-        QCC_ASSERT(other.msgBuf == NULL);
-        _msgBuf = NULL;
-        msgBuf = NULL;
-        bufEOD = NULL;
-        bufPos = NULL;
-        bodyPtr = NULL;
+    /*
+     * The copy shares the marshalled bytes with the other message.
+     */
+    msgBuf = other.msgBuf;
+    bufEOD = other.bufEOD;
+    bufPos = other.bufPos;
+    bodyPtr = other.bodyPtr;
+    if (msgBuf) {
+        AddRefBuffer(msgBuf);
     }
     if (numMsgArgs > 0) {
         msgArgs =  new MsgArg[numMsgArgs];
@@ -457,9 +443,9 @@ QStatus _Message::ReMarshal(const char* senderName)
     numRefMsgArgs = 0;
 
     /*
-     * We delete the current buffer after we have copied the body data
+     * We release the current buffer after we have copied the body data
      */
-    uint8_t* _savBuf = _msgBuf;
+    uint64_t* savBuf = msgBuf;
 
     /*
      * Compute the new header sizes
@@ -470,8 +456,7 @@ QStatus _Message::ReMarshal(const char* senderName)
      * message reducing the places where we need to check for bufEOD when unmarshaling the body.
      */
     bufSize = sizeof(msgHeader) + ((((msgHeader.headerLen + 7) & ~7) + msgHeader.bodyLen + 7) & ~7) + 8;
-    _msgBuf = new uint8_t[bufSize + 7];
-    msgBuf = (uint64_t*)((uintptr_t)(_msgBuf + 7) & ~7); /* Align to 8 byte boundary */
+    msgBuf = NewBuffer(bufSize);
     bufPos = (uint8_t*)msgBuf;
     memcpy(bufPos, &msgHeader, sizeof(msgHeader));
     bufPos += sizeof(msgHeader);
@@ -503,10 +488,42 @@ QStatus _Message::ReMarshal(const char* senderName)
      */
     QCC_ASSERT((size_t)(bufEOD - (uint8_t*)msgBuf) < bufSize);
     memset(bufEOD, 0, (uint8_t*)msgBuf + bufSize - bufEOD);
-    delete [] _savBuf;
+    ReleaseBuffer(savBuf);
     return ER_OK;
 }
 
+uint64_t* _Message::NewBuffer(size_t size)
+{
+    uint64_t* block = new uint64_t[1 + ((size + 7) / 8)];
+    *reinterpret_cast<int32_t*>(block) = 1;
+    return block + 1;
+}
+
+void _Message::AddRefBuffer(uint64_t* buf)
+{
+    IncrementAndFetch(reinterpret_cast<int32_t*>(buf - 1));
+}
+
+void _Message::ReleaseBuffer(uint64_t* buf)
+{
+    if (buf && (DecrementAndFetch(reinterpret_cast<int32_t*>(buf - 1)) == 0)) {
+        delete [] (buf - 1);
+    }
+}
+
+void _Message::MakeBufferWritable()
+{
+    if (msgBuf && (*reinterpret_cast<volatile int32_t*>(msgBuf - 1) > 1)) {
+        uint64_t* buf = NewBuffer(bufSize);
+        ::memcpy(buf, msgBuf, bufSize);
+        bufEOD = reinterpret_cast<uint8_t*>(buf) + (bufEOD - reinterpret_cast<uint8_t*>(msgBuf));
+        bufPos = reinterpret_cast<uint8_t*>(buf) + (bufPos - reinterpret_cast<uint8_t*>(msgBuf));
+        bodyPtr = reinterpret_cast<uint8_t*>(buf) + (bodyPtr - reinterpret_cast<uint8_t*>(msgBuf));
+        ReleaseBuffer(msgBuf);
+        msgBuf = buf;
+    }
+}
+
 bool _Message::IsExpired(uint32_t* tillExpireMS) const
 {
     uint32_t expires;
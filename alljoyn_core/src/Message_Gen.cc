@@ -35,6 +35,8 @@
 
 #include <qcc/platform.h>
 
+#include <algorithm>
+
 #include <qcc/String.h>
 #include <qcc/StringUtil.h>
 #include <qcc/Debug.h>
@@ -540,71 +542,132 @@ QStatus _Message::Deliver(RemoteEndpoint& endpoint)
     return status;
 }
 
-QStatus _Message::DeliverNonBlocking(RemoteEndpoint& endpoint)
+_Message::WriteCursor::WriteCursor(const Message& msg) :
+    msg(msg),
+    buf(NULL),
+    state(MESSAGE_NEW),
+    writePtr(NULL),
+    countWrite(0)
 {
-    size_t pushed;
-    QStatus status = ER_OK;
-    Sink& sink = endpoint->GetSink();
+}
 
-    switch (writeState) {
-    case MESSAGE_NEW:
-        writePtr = reinterpret_cast<uint8_t*>(msgBuf);
-        countWrite = bufEOD - writePtr;
-        pushed = 0;
+_Message::WriteCursor::WriteCursor(const WriteCursor& other) :
+    msg(other.msg),
+    buf(other.buf),
+    state(other.state),
+    writePtr(other.writePtr),
+    countWrite(other.countWrite)
+{
+    if (buf) {
+        AddRefBuffer(buf);
+    }
+}
 
-        if (countWrite == 0) {
-            status = ER_BUS_EMPTY_MESSAGE;
-            QCC_LogError(status, ("Message is empty"));
-            return status;
-        }
-        /*
-         * Handles can only be passed if that feature was negotiated.
-         */
-        if (handles && !endpoint->GetFeatures().handlePassing) {
-            status = ER_BUS_HANDLES_NOT_ENABLED;
-            QCC_LogError(status, ("Handle passing was not negotiated on this connection"));
-            return status;
+_Message::WriteCursor& _Message::WriteCursor::operator=(const WriteCursor& other)
+{
+    if (this != &other) {
+        if (other.buf) {
+            AddRefBuffer(other.buf);
         }
+        ReleaseBuffer(buf);
+        msg = other.msg;
+        buf = other.buf;
+        state = other.state;
+        writePtr = other.writePtr;
+        countWrite = other.countWrite;
+    }
+    return *this;
+}
+
+_Message::WriteCursor::~WriteCursor()
+{
+    ReleaseBuffer(buf);
+}
+
+QStatus _Message::PrepareDelivery(RemoteEndpoint& endpoint, WriteCursor& cursor)
+{
+    QStatus status = ER_OK;
+
+    if (cursor.msg->GetBufferSize() == 0) {
+        status = ER_BUS_EMPTY_MESSAGE;
+        QCC_LogError(status, ("Message is empty"));
+        return status;
+    }
+    /*
+     * Handles can only be passed if that feature was negotiated.
+     */
+    if (cursor.msg->handles && !endpoint->GetFeatures().handlePassing) {
+        status = ER_BUS_HANDLES_NOT_ENABLED;
+        QCC_LogError(status, ("Handle passing was not negotiated on this connection"));
+        return status;
+    }
+    /*
+     * If the message has a TTL, check if it has expired
+     */
+    if (cursor.msg->ttl && cursor.msg->IsExpired()) {
+        QCC_DbgHLPrintf(("TTL has expired - discarding message %s", cursor.msg->Description().c_str()));
+        cursor.state = MESSAGE_COMPLETE;
+        return ER_OK;
+    }
+    /*
+     * Check if message needs to be encrypted.  Encryption changes the message
+     * so this delivery gets its own copy of the message.
+     */
+    if (cursor.msg->encrypt) {
+        cursor.msg = Message(cursor.msg, true);
+        status = cursor.msg->EncryptMessage();
         /*
-         * If the message has a TTL, check if it has expired
+         * Delivery is retried when the authentication completes
          */
-        if (ttl && IsExpired()) {
-            QCC_DbgHLPrintf(("TTL has expired - discarding message %s", Description().c_str()));
+        if (status == ER_BUS_AUTHENTICATION_PENDING) {
+            cursor.state = MESSAGE_COMPLETE;
             return ER_OK;
         }
-        /*
-         * Check if message needs to be encrypted
-         */
-        if (encrypt) {
-            status = EncryptMessage();
-            /*
-             * Delivery is retried when the authentication completes
-             */
-            if (status == ER_BUS_AUTHENTICATION_PENDING) {
-                return ER_OK;
-            }
-            if (ER_PERMISSION_DENIED == status) {
-                return status;
-            }
-            /*
-             * Recompute because encryption increases the packet length
-             */
-            countWrite = bufEOD - writePtr;
+        if (ER_PERMISSION_DENIED == status) {
+            return status;
+        }
+    }
+    /*
+     * Hold on to the marshalled bytes in case the message is marshalled
+     * again while this delivery is in progress.
+     */
+    ReleaseBuffer(cursor.buf);
+    cursor.buf = cursor.msg->msgBuf;
+    AddRefBuffer(cursor.buf);
+    cursor.writePtr = reinterpret_cast<const uint8_t*>(cursor.buf);
+    cursor.countWrite = cursor.msg->GetBufferSize();
+    cursor.state = MESSAGE_HEADERFIELDS;
+    return ER_OK;
+}
+
+QStatus _Message::DeliverNonBlocking(RemoteEndpoint& endpoint, WriteCursor& cursor)
+{
+    size_t pushed;
+    QStatus status = ER_OK;
+    Sink& sink = endpoint->GetSink();
+
+    switch (cursor.state) {
+    case MESSAGE_NEW:
+        status = PrepareDelivery(endpoint, cursor);
+        if ((status != ER_OK) || (cursor.state == MESSAGE_COMPLETE)) {
+            break;
         }
-        writeState = MESSAGE_HEADERFIELDS;
     /* no break  FALLTHROUGH*/
 
     case MESSAGE_HEADERFIELDS:
-        if (handles) {
-            status = sink.PushBytesAndFds(writePtr, countWrite, pushed, handles, numHandles, endpoint->GetProcessId());
-        } else {
-            status = sink.PushBytes(writePtr, countWrite, pushed, (msgHeader.flags & ALLJOYN_FLAG_SESSIONLESS) ? (ttl * 1000) : ttl);
+        {
+            _Message& msg = *cursor.msg;
+            if (msg.handles) {
+                status = sink.PushBytesAndFds(cursor.writePtr, cursor.countWrite, pushed, msg.handles, msg.numHandles, endpoint->GetProcessId());
+            } else {
+                status = sink.PushBytes(cursor.writePtr, cursor.countWrite, pushed, (msg.msgHeader.flags & ALLJOYN_FLAG_SESSIONLESS) ? (msg.ttl * 1000) : msg.ttl);
+            }
         }
 
         if (status == ER_OK) {
-            countWrite -= pushed;
-            writePtr += pushed;
-            writeState = MESSAGE_HEADER_BODY;
+            cursor.countWrite -= pushed;
+            cursor.writePtr += pushed;
+            cursor.state = MESSAGE_HEADER_BODY;
         } else {
             break;
         }
@@ -612,15 +675,15 @@ QStatus _Message::DeliverNonBlocking(RemoteEndpoint& endpoint)
 
     case MESSAGE_HEADER_BODY:
         status = ER_OK;
-        while (status == ER_OK && countWrite > 0) {
-            status = sink.PushBytes(writePtr, countWrite, pushed);
+        while (status == ER_OK && cursor.countWrite > 0) {
+            status = sink.PushBytes(cursor.writePtr, cursor.countWrite, pushed);
             if (status == ER_OK) {
-                countWrite -= pushed;
-                writePtr += pushed;
+                cursor.countWrite -= pushed;
+                cursor.writePtr += pushed;
             }
         }
-        if (countWrite == 0) {
-            writeState = MESSAGE_COMPLETE;
+        if (cursor.countWrite == 0) {
+            cursor.state = MESSAGE_COMPLETE;
         }
         break;
 
@@ -631,6 +694,89 @@ QStatus _Message::DeliverNonBlocking(RemoteEndpoint& endpoint)
     }
     return status;
 }
+
+QStatus _Message::DeliverNonBlocking(RemoteEndpoint& endpoint, WriteCursor* cursors, size_t numCursors, size_t& numDelivered)
+{
+    QStatus status = ER_OK;
+    Sink& sink = endpoint->GetSink();
+    IOVec iov[SOCKET_MAX_IOVECS];
+
+    numDelivered = 0;
+
+    /*
+     * Messages that carry handles or that only need to be written in part
+     * go out on their own through the single message path.
+     */
+    if ((numCursors == 1) || cursors[0].msg->handles) {
+        status = DeliverNonBlocking(endpoint, cursors[0]);
+        if ((status == ER_OK) && cursors[0].IsComplete()) {
+            numDelivered = 1;
+        }
+        return status;
+    }
+
+    /*
+     * Prepare as many messages as can be gathered into a single write.  An
+     * error preparing a message other than the first one ends the batch
+     * early so the error is reported against the right message on the next
+     * call.
+     */
+    size_t numBatched = 0;
+    while ((numBatched < numCursors) && (numBatched < ArraySize(iov))) {
+        WriteCursor& cursor = cursors[numBatched];
+        if (cursor.msg->handles) {
+            break;
+        }
+        if (cursor.state == MESSAGE_NEW) {
+            status = PrepareDelivery(endpoint, cursor);
+            if (status != ER_OK) {
+                if (numBatched == 0) {
+                    return status;
+                }
+                cursor.state = MESSAGE_NEW;
+                status = ER_OK;
+                break;
+            }
+        }
+        ++numBatched;
+    }
+
+    while (status == ER_OK) {
+        size_t numIov = 0;
+        for (size_t i = 0; i < numBatched; ++i) {
+            WriteCursor& cursor = cursors[i];
+            if (!cursor.IsComplete()) {
+                iov[numIov].buf = reinterpret_cast<char*>(const_cast<uint8_t*>(cursor.writePtr));
+                iov[numIov].len = cursor.countWrite;
+                ++numIov;
+            }
+        }
+        if (numIov == 0) {
+            break;
+        }
+        size_t pushed = 0;
+        status = sink.PushBytesV(iov, numIov, pushed);
+        if (status != ER_OK) {
+            break;
+        }
+        for (size_t i = 0; (i < numBatched) && (pushed > 0); ++i) {
+            WriteCursor& cursor = cursors[i];
+            if (!cursor.IsComplete()) {
+                size_t n = (std::min)(pushed, cursor.countWrite);
+                cursor.countWrite -= n;
+                cursor.writePtr += n;
+                pushed -= n;
+                cursor.state = (cursor.countWrite == 0) ? MESSAGE_COMPLETE : MESSAGE_HEADER_BODY;
+            }
+        }
+    }
+
+    while ((numDelivered < numBatched) && cursors[numDelivered].IsComplete()) {
+        ++numDelivered;
+    }
+    return status;
+}
+
 /*
  * Map from our enumeration type to the wire protocol values
  */
@@ -763,8 +909,9 @@ size_t _Message::ComputeHeaderLen()
 QStatus _Message::EncryptMessage()
 {
     KeyBlob key;
+    std::shared_ptr<qcc::Crypto_AES> cipher;
     PeerState peerState = bus->GetInternal().GetPeerStateTable()->GetPeerState(GetDestination());
-    QStatus status = peerState->GetKey(key, PEER_SESSION_KEY);
+    QStatus status = peerState->GetKey(key, PEER_SESSION_KEY, cipher);
 
     if (status == ER_OK) {
         /*
@@ -805,7 +952,8 @@ QStatus _Message::EncryptMessage()
         size_t hdrLen = ROUNDUP8(sizeof(msgHeader) + msgHeader.headerLen);
         size_t bodyLen = msgHeader.bodyLen;
 
-        status = ajn::Crypto::Encrypt(*this, key, (uint8_t*)msgBuf, hdrLen, bodyLen);
+        MakeBufferWritable();
+        status = ajn::Crypto::Encrypt(*this, key, cipher.get(), (uint8_t*)msgBuf, hdrLen, bodyLen);
         if (status == ER_OK) {
             QCC_DbgHLPrintf(("EncryptMessage: %s", Description().c_str()));
             /*
@@ -896,7 +1044,7 @@ QStatus _Message::MarshalMessage(const qcc::String& expectedSignature,
      * Keep the old message buffer around until we are done because some of the strings we are
      * marshaling may point into the old message.
      */
-    uint8_t* _oldMsgBuf = _msgBuf;
+    uint64_t* oldMsgBuf = msgBuf;
     /*
      * Clear out stale message data
      */
@@ -904,7 +1052,6 @@ QStatus _Message::MarshalMessage(const qcc::String& expectedSignature,
     bufPos = NULL;
     bufEOD = NULL;
     msgBuf = NULL;
-    _msgBuf = NULL;
     /*
      * There should be a mapping for every field type
      */
@@ -979,8 +1126,7 @@ QStatus _Message::MarshalMessage(const qcc::String& expectedSignature,
      * Allocate buffer for entire message.
      */
     bufSize = (hdrLen + msgHeader.bodyLen + maxCryptoValsLen + 16);
-    _msgBuf = new uint8_t[bufSize];
-    msgBuf = (uint64_t*)((uintptr_t)(_msgBuf + 7) & ~7); /* Align to 8 byte boundary */
+    msgBuf = NewBuffer(bufSize);
     /*
      * Initialize the buffer and copy in the message header
      */
@@ -1064,15 +1210,14 @@ ExitMarshalMessage:
     /*
      * Don't need the old message buffer any more
      */
-    delete [] _oldMsgBuf;
+    ReleaseBuffer(oldMsgBuf);
 
     if (status == ER_OK) {
         QCC_DbgHLPrintf(("MarshalMessage: %d+%d %s %s", hdrLen, msgHeader.bodyLen, Description().c_str(), encrypt ? " (encrypted)" : ""));
     } else {
         QCC_LogError(status, ("MarshalMessage: %s", Description().c_str()));
+        ReleaseBuffer(msgBuf);
         msgBuf = NULL;
-        delete [] _msgBuf;
-        _msgBuf = NULL;
         bodyPtr = NULL;
         bufPos = NULL;
         bufEOD = NULL;
@@ -1606,6 +1751,7 @@ void _Message::SetSerialNumber(uint32_t serialNumber)
 {
     msgHeader.serialNum = serialNumber;
     if (msgBuf) {
+        MakeBufferWritable();
         ((MessageHeader*)msgBuf)->serialNum = endianSwap ? EndianSwap32(msgHeader.serialNum) : msgHeader.serialNum;
     }
 }
@@ -611,11 +611,12 @@ QStatus _Message::UnmarshalArgs(PeerStateTable* peerStateTable,
         size_t hdrLen = bodyPtr - (uint8_t*)msgBuf;
         PeerState peerState = peerStateTable->GetPeerState(GetSender());
         KeyBlob key;
+        std::shared_ptr<qcc::Crypto_AES> cipher;
         /* A broadcast message is encrypted but not authenticated since any
          * peer that connects with the sender has access to the same group key
          */
         authenticated = !broadcast;
-        status = peerState->GetKey(key, broadcast ? PEER_GROUP_KEY : PEER_SESSION_KEY);
+        status = peerState->GetKey(key, broadcast ? PEER_GROUP_KEY : PEER_SESSION_KEY, cipher);
         if (status != ER_OK) {
             QCC_LogError(status, ("Unable to decrypt (broadcast %d) message from sender %s", broadcast, GetSender()));
             /*
@@ -665,7 +666,8 @@ QStatus _Message::UnmarshalArgs(PeerStateTable* peerStateTable,
          * algorithm appends data to the end of the encrypted data.
          */
         size_t bodyLen = msgHeader.bodyLen;
-        status = ajn::Crypto::Decrypt(*this, key, (uint8_t*)msgBuf, hdrLen, bodyLen);
+        MakeBufferWritable();
+        status = ajn::Crypto::Decrypt(*this, key, cipher.get(), (uint8_t*)msgBuf, hdrLen, bodyLen);
         if (status != ER_OK) {
             goto ExitUnmarshalArgs;
         }
@@ -952,9 +954,8 @@ QStatus _Message::InterpretHeader()
      * message reducing the places where we need to check for bufEOD when unmarshaling the body.
      */
     bufSize = sizeof(msgHeader) + ((pktSize + 7) & ~7) + sizeof(uint64_t);
-    QCC_ASSERT(_msgBuf == nullptr);
-    _msgBuf = new uint8_t[bufSize + 7];
-    msgBuf = (uint64_t*)((uintptr_t)(_msgBuf + 7) & ~7); /* Align to 8 byte boundary */
+    QCC_ASSERT(msgBuf == nullptr);
+    msgBuf = NewBuffer(bufSize);
     /*
      * Copy header into the buffer
      */
@@ -1018,7 +1019,7 @@ QStatus _Message::PullBytes(RemoteEndpoint& endpoint, bool checkSender, bool ped
                 memcpy(handles, fdList, numHandles * sizeof(qcc::SocketFd));
             }
         } else {
-            status = source.PullBytes(bufPos, toRead, read, timeout);
+            status = endpoint->PullBytes(bufPos, toRead, read, timeout);
         }
         bufPos += read;
         countRead -= read;
@@ -1034,7 +1035,7 @@ QStatus _Message::PullBytes(RemoteEndpoint& endpoint, bool checkSender, bool ped
     case MESSAGE_HEADER_BODY:
         /* Read the rest of the message header and body */
         toRead = (std::min)(countRead, MAX_PULL);
-        status = source.PullBytes(bufPos, toRead, read, timeout);
+        status = endpoint->PullBytes(bufPos, toRead, read, timeout);
         if (status == ER_ALERTED_THREAD) {
             QCC_DbgPrintf(("PullBytes ALERTED continuing"));
             status = ER_OK;
@@ -1130,9 +1131,8 @@ QStatus _Message::Read(RemoteEndpoint& endpoint, bool checkSender, bool pedantic
     /*
      * Clear out any stale message state
      */
+    ReleaseBuffer(msgBuf);
     msgBuf = NULL;
-    delete [] _msgBuf;
-    _msgBuf = NULL;
     ClearHeader();
     readState = MESSAGE_NEW;
 
@@ -1374,9 +1374,8 @@ ExitUnmarshal:
         /*
          * There was an unrecoverable failure while unmarshaling the message, cleanup before we return.
          */
+        ReleaseBuffer(msgBuf);
         msgBuf = NULL;
-        delete [] _msgBuf;
-        _msgBuf = NULL;
         ClearHeader();
         if ((status != ER_SOCK_OTHER_END_CLOSED) && (status != ER_STOPPING_THREAD)) {
             QCC_LogError(status, ("Failed to unmarshal message received on %s", endpointName.c_str()));
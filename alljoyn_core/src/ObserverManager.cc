@@ -519,13 +519,56 @@ void ObserverManager::HandleActivePeerAnnouncement(DiscoveryMap::iterator peerit
     }
 }
 
+ObserverManager::InterfaceMask ObserverManager::InternInterfaces(const InterfaceSet& interfaces)
+{
+    InterfaceMask mask;
+    for (InterfaceSet::const_iterator it = interfaces.begin(); it != interfaces.end(); ++it) {
+        std::map<qcc::String, size_t>::iterator idit = interfaceIds.find(*it);
+        if (idit == interfaceIds.end()) {
+            size_t id = interfaceIds.size();
+            idit = interfaceIds.insert(std::make_pair(*it, id)).first;
+        }
+        size_t word = idit->second / 64;
+        if (mask.size() <= word) {
+            mask.resize(word + 1, 0);
+        }
+        mask[word] |= (uint64_t)1 << (idit->second % 64);
+    }
+    return mask;
+}
+
+bool ObserverManager::ImplementsAll(const DiscoveredObject& object, const InterfaceCombination& combination)
+{
+    if (object.maskInterned != interfaceIds.size()) {
+        /* (re)compute the object's mask over the current set of interned interfaces */
+        object.mask.assign((interfaceIds.size() + 63) / 64, 0);
+        for (InterfaceSet::const_iterator it = object.implements.begin(); it != object.implements.end(); ++it) {
+            std::map<qcc::String, size_t>::const_iterator idit = interfaceIds.find(*it);
+            if (idit != interfaceIds.end()) {
+                object.mask[idit->second / 64] |= (uint64_t)1 << (idit->second % 64);
+            }
+        }
+        object.maskInterned = interfaceIds.size();
+    }
+
+    const InterfaceMask& need = combination.mask;
+    const InterfaceMask& have = object.mask;
+    for (size_t i = 0; i < need.size(); ++i) {
+        uint64_t implemented = (i < have.size()) ? have[i] : 0;
+        if (need[i] & ~implemented) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ObserverManager::CheckRelevance(const ObjectSet& objects)
 {
     ObjectSet::iterator oit;
     for (oit = objects.begin(); oit != objects.end(); ++oit) {
         CombinationMap::iterator cit;
         for (cit = combinations.begin(); cit != combinations.end(); ++cit) {
-            if (oit->ImplementsAll(cit->second->interfaces)) {
+            if (ImplementsAll(*oit, *cit->second)) {
                 return true;
             }
         }
@@ -787,7 +830,7 @@ bool ObserverManager::InterfaceCombination::ObjectsDiscovered(const ObjectSet& o
     ObjectSet::iterator oit;
     for (oit = objects.begin(); oit != objects.end(); ++oit) {
         QCC_DbgPrintf(("Checking object %s:%s", oit->id.uniqueBusName.c_str(), oit->id.objectPath.c_str()));
-        if (!oit->ImplementsAll(interfaces)) {
+        if (!obsmgr->ImplementsAll(*oit, *this)) {
             QCC_DbgPrintf(("Not relevant..."));
             continue;
         }
@@ -807,7 +850,7 @@ bool ObserverManager::InterfaceCombination::ObjectsLost(const ObjectSet& objects
 
     ObjectSet::iterator oit;
     for (oit = objects.begin(); oit != objects.end(); ++oit) {
-        if (!oit->ImplementsAll(interfaces)) {
+        if (!obsmgr->ImplementsAll(*oit, *this)) {
             continue;
         }
         relevant = true;
@@ -842,7 +885,7 @@ void ObserverManager::InterfaceCombination::AddObserver(CoreObserver* observer)
     for (peerit = obsmgr->active.begin(); peerit != obsmgr->active.end(); ++peerit) {
         ObjectSet::iterator oit;
         for (oit = peerit->second.begin(); oit != peerit->second.end(); ++oit) {
-            if (oit->ImplementsAll(interfaces)) {
+            if (obsmgr->ImplementsAll(*oit, *this)) {
                 observer->ObjectDiscovered(oit->id, oit->implements, peerit->first.sessionid);
             }
         }
@@ -33,6 +33,7 @@
 #include <map>
 #include <set>
 #include <queue>
+#include <vector>
 #include <algorithm>
 #include <iterator>
 
@@ -150,6 +151,12 @@ class ObserverManager :
      */
     typedef std::set<qcc::String> InterfaceSet;
 
+    /**
+     * Set of interfaces as a bitmap indexed by the IDs handed out by
+     * InternInterfaces().
+     */
+    typedef std::vector<uint64_t> InterfaceMask;
+
     /**
      * Represents a bus object as advertised by About
      */
@@ -157,7 +164,15 @@ class ObserverManager :
         ObjectId id;
         InterfaceSet implements;
 
-        DiscoveredObject() { }
+        /**
+         * The interned interfaces in implements.  Filled in lazily by
+         * ObserverManager::ImplementsAll() whenever new interfaces have been
+         * interned since it was last computed.
+         */
+        mutable InterfaceMask mask;
+        mutable size_t maskInterned;
+
+        DiscoveredObject() : maskInterned(0) { }
 
         bool operator<(const DiscoveredObject& other) const {
             return id < other.id;
@@ -165,21 +180,6 @@ class ObserverManager :
         bool operator==(const DiscoveredObject& other) const {
             return id == other.id;
         }
-
-        bool ImplementsAll(const InterfaceSet& interfaces) const {
-            InterfaceSet diff;
-            set_difference(interfaces.begin(), interfaces.end(),
-                           implements.begin(), implements.end(),
-                           std::inserter(diff, diff.begin()));
-            return diff.empty();
-        }
-        bool ImplementsAny(const InterfaceSet& interfaces) const {
-            InterfaceSet intersection;
-            set_intersection(interfaces.begin(), interfaces.end(),
-                             implements.begin(), implements.end(),
-                             std::inserter(intersection, intersection.begin()));
-            return !intersection.empty();
-        }
     };
 
     /**
@@ -208,19 +208,21 @@ class ObserverManager :
     struct InterfaceCombination {
         ObserverManager* obsmgr;
         InterfaceSet interfaces;
+        InterfaceMask mask;
         std::vector<CoreObserver*> observers;
 
         InterfaceCombination(ObserverManager* mgr, const InterfaceSet& intfs) :
-            obsmgr(mgr), interfaces(intfs)
+            obsmgr(mgr), interfaces(intfs), mask(mgr->InternInterfaces(intfs))
         { }
 
         InterfaceCombination(const InterfaceCombination& other) :
-            obsmgr(other.obsmgr), interfaces(other.interfaces), observers(other.observers)
+            obsmgr(other.obsmgr), interfaces(other.interfaces), mask(other.mask), observers(other.observers)
         { }
 
         InterfaceCombination& operator=(const InterfaceCombination& other) {
             obsmgr = other.obsmgr;
             interfaces = other.interfaces;
+            mask = other.mask;
             observers = other.observers;
             return *this;
         }
@@ -263,6 +265,24 @@ class ObserverManager :
     typedef std::map<InterfaceSet, InterfaceCombination*> CombinationMap;
     CombinationMap combinations;
 
+    /**
+     * Dense IDs for the interfaces named by the interface combinations.
+     * IDs are never released, so the size of the map doubles as a version
+     * number for the object masks.
+     */
+    std::map<qcc::String, size_t> interfaceIds;
+
+    /**
+     * Assign IDs to any interfaces that don't have one yet.
+     * \return the mask of the given interfaces
+     */
+    InterfaceMask InternInterfaces(const InterfaceSet& interfaces);
+
+    /**
+     * Checks whether an object implements all interfaces of a combination.
+     */
+    bool ImplementsAll(const DiscoveredObject& object, const InterfaceCombination& combination);
+
     /**
      * Discovered objects, waiting for a session with the peer to be set up.
      */
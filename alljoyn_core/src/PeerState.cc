@@ -318,6 +318,76 @@ void _PeerState::SetConversationHashSensitiveMode(bool initiator, bool mode)
     }
 }
 
+void _PeerState::SetKey(const qcc::KeyBlob& key, PeerKeyType keyType)
+{
+    keyLock.Lock(MUTEX_CONTEXT);
+    keys[keyType] = key;
+    ciphers[keyType].reset();
+    isSecure = key.IsValid();
+    /* A new key means the peer (re)authenticated, possibly as someone else. */
+    ClearAuthorizationCache();
+    keyLock.Unlock(MUTEX_CONTEXT);
+}
+
+QStatus _PeerState::GetKey(qcc::KeyBlob& key, PeerKeyType keyType)
+{
+    keyLock.Lock(MUTEX_CONTEXT);
+    QStatus status = GetKeyLocked(key, keyType);
+    keyLock.Unlock(MUTEX_CONTEXT);
+    return status;
+}
+
+QStatus _PeerState::GetKey(qcc::KeyBlob& key, PeerKeyType keyType, std::shared_ptr<Crypto_AES>& cipher)
+{
+    keyLock.Lock(MUTEX_CONTEXT);
+    QStatus status = GetKeyLocked(key, keyType);
+    if ((status == ER_OK) && (key.GetType() == KeyBlob::AES)) {
+        /*
+         * Expanding the AES key schedule costs more than encrypting a small message so the
+         * context is built once and reused until the key is replaced.
+         */
+        if (!ciphers[keyType]) {
+            ciphers[keyType] = std::make_shared<Crypto_AES>(key, Crypto_AES::CCM);
+        }
+        cipher = ciphers[keyType];
+    } else {
+        cipher.reset();
+    }
+    keyLock.Unlock(MUTEX_CONTEXT);
+    return status;
+}
+
+QStatus _PeerState::GetKeyLocked(qcc::KeyBlob& key, PeerKeyType keyType)
+{
+    if (!isSecure) {
+        return ER_BUS_KEY_UNAVAILABLE;
+    }
+    key = keys[keyType];
+    if (key.HasExpired()) {
+        ClearKeysLocked();
+        return ER_BUS_KEY_EXPIRED;
+    }
+    return ER_OK;
+}
+
+void _PeerState::ClearKeys()
+{
+    keyLock.Lock(MUTEX_CONTEXT);
+    ClearKeysLocked();
+    keyLock.Unlock(MUTEX_CONTEXT);
+}
+
+void _PeerState::ClearKeysLocked()
+{
+    keys[PEER_SESSION_KEY].Erase();
+    keys[PEER_GROUP_KEY].Erase();
+    ciphers[PEER_SESSION_KEY].reset();
+    ciphers[PEER_GROUP_KEY].reset();
+    isSecure = false;
+    m_authSuite = 0;
+    ClearAuthorizationCache();
+}
+
 _PeerState::~_PeerState()
 {
     ClearGuildMap(guildMap);
@@ -437,6 +507,7 @@ void _PeerState::SetGuildMetadata(const qcc::String& serial, const qcc::String&
         guildMap.erase(key);
     }
     guildMap[key] = guild;
+    ClearAuthorizationCache();
 }
 
 _PeerState::GuildMetadata* _PeerState::GetGuildMetadata(const qcc::String& serial, const String& issuerAki)
@@ -568,6 +639,7 @@ QStatus _PeerState::SetAuthSuite(const String& authSuite)
 QStatus _PeerState::StoreManifest(const Manifest& manifest)
 {
     m_manifests.push_back(manifest);
+    ClearAuthorizationCache();
 
     return ER_OK;
 }
@@ -575,6 +647,7 @@ QStatus _PeerState::StoreManifest(const Manifest& manifest)
 QStatus _PeerState::ClearManifests()
 {
     m_manifests.clear();
+    ClearAuthorizationCache();
 
     return ER_OK;
 }
@@ -631,4 +704,41 @@ void _PeerState::SetHaveExchangedManifests(bool haveExchangedManifests)
     m_haveExchangedManifests = haveExchangedManifests;
 }
 
+bool _PeerState::GetCachedAuthorization(const std::string& request, uint32_t generation, bool& authorized, uint32_t& epoch)
+{
+    bool found = false;
+    m_authorizationCacheLock.Lock(MUTEX_CONTEXT);
+    if (generation == m_authorizationGeneration) {
+        std::unordered_map<std::string, bool>::const_iterator it = m_authorizationCache.find(request);
+        if (it != m_authorizationCache.end()) {
+            authorized = it->second;
+            found = true;
+        }
+    }
+    epoch = m_authorizationEpoch;
+    m_authorizationCacheLock.Unlock(MUTEX_CONTEXT);
+    return found;
+}
+
+void _PeerState::CacheAuthorization(const std::string& request, uint32_t generation, uint32_t epoch, bool authorized)
+{
+    m_authorizationCacheLock.Lock(MUTEX_CONTEXT);
+    if (epoch == m_authorizationEpoch) {
+        if ((generation != m_authorizationGeneration) || (m_authorizationCache.size() >= MAX_CACHED_AUTHORIZATIONS)) {
+            m_authorizationCache.clear();
+            m_authorizationGeneration = generation;
+        }
+        m_authorizationCache[request] = authorized;
+    }
+    m_authorizationCacheLock.Unlock(MUTEX_CONTEXT);
+}
+
+void _PeerState::ClearAuthorizationCache()
+{
+    m_authorizationCacheLock.Lock(MUTEX_CONTEXT);
+    m_authorizationCache.clear();
+    m_authorizationEpoch++;
+    m_authorizationCacheLock.Unlock(MUTEX_CONTEXT);
+}
+
 }
@@ -41,6 +41,7 @@
 #include <qcc/platform.h>
 
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <limits>
 
@@ -170,6 +171,7 @@ class _PeerState {
         lastDriftAdjustTime(0),
         isSecure(false),
         authEvent(NULL),
+        keyLock(qcc::LOCK_LEVEL_PEERSTATE_KEYLOCK),
         prevSerial(0),
         flagWindow(0),
         initiatorHash(NULL),
@@ -181,7 +183,10 @@ class _PeerState {
         m_authSuite(0),
         m_manifests(),
         m_manifestsSent(),
-        m_haveExchangedManifests(false)
+        m_haveExchangedManifests(false),
+        m_authorizationGeneration(0),
+        m_authorizationEpoch(0),
+        m_authorizationCacheLock(qcc::LOCK_LEVEL_PEERSTATE_AUTHORIZATIONCACHELOCK)
     {
         ::memset(authorizations, 0, sizeof(authorizations));
     }
@@ -233,15 +238,13 @@ class _PeerState {
     }
 
     /**
-     * Sets the session key for this peer
+     * Sets the session key for this peer. Any AES-CCM context expanded from the previous key of
+     * this type is discarded.
      *
      * @param[in] key        The session key to set.
      * @param[in] keyType    Indicate if this is the unicast or broadcast key.
      */
-    void SetKey(const qcc::KeyBlob& key, PeerKeyType keyType) {
-        keys[keyType] = key;
-        isSecure = key.IsValid();
-    }
+    void SetKey(const qcc::KeyBlob& key, PeerKeyType keyType);
 
     /**
      * Gets the session key for this peer.
@@ -252,29 +255,28 @@ class _PeerState {
      *          - ER_BUS_KEY_UNAVAILABLE if no session key has been set for this peer.
      *          - ER_BUS_KEY_EXPIRED if there was a session key but the key has expired.
      */
-    QStatus GetKey(qcc::KeyBlob& key, PeerKeyType keyType) {
-        if (isSecure) {
-            key = keys[keyType];
-            if (key.HasExpired()) {
-                ClearKeys();
-                return ER_BUS_KEY_EXPIRED;
-            } else {
-                return ER_OK;
-            }
-        } else {
-            return ER_BUS_KEY_UNAVAILABLE;
-        }
-    }
+    QStatus GetKey(qcc::KeyBlob& key, PeerKeyType keyType);
+
+    /**
+     * Gets the session key for this peer together with the AES-CCM context expanded from it. The
+     * context is created on first use and shared by all messages encrypted or decrypted with this
+     * key until the key is replaced or cleared.
+     *
+     * @param[out] key       Returns the session key.
+     * @param[in]  keyType   Indicate if this is the unicast or broadcast key.
+     * @param[out] cipher    Returns the AES-CCM context for the key, or an empty pointer if the key
+     *                       is not an AES key.
+     *
+     * @return  - ER_OK if there is a session key set for this peer.
+     *          - ER_BUS_KEY_UNAVAILABLE if no session key has been set for this peer.
+     *          - ER_BUS_KEY_EXPIRED if there was a session key but the key has expired.
+     */
+    QStatus GetKey(qcc::KeyBlob& key, PeerKeyType keyType, std::shared_ptr<qcc::Crypto_AES>& cipher);
 
     /**
      * Clear the keys for this peer.
      */
-    void ClearKeys() {
-        keys[PEER_SESSION_KEY].Erase();
-        keys[PEER_GROUP_KEY].Erase();
-        isSecure = false;
-        m_authSuite = 0;
-    }
+    void ClearKeys();
 
     /**
      * Tests if this peer is secure.
@@ -379,6 +381,36 @@ class _PeerState {
      */
     GuildMap guildMap;
 
+    /**
+     * Look up a cached authorization decision for this peer.
+     *
+     * @param[in] request     Key describing the request (object path, interface, member, action and direction)
+     * @param[in] generation  The policy generation the decision must have been made under
+     * @param[out] authorized The cached decision
+     * @param[out] epoch      On a miss, the token to pass to CacheAuthorization
+     *
+     * @return true if a decision was found, false otherwise.
+     */
+    bool GetCachedAuthorization(const std::string& request, uint32_t generation, bool& authorized, uint32_t& epoch);
+
+    /**
+     * Cache an authorization decision for this peer.  The decision is dropped
+     * if the cache was cleared since the GetCachedAuthorization call that
+     * returned epoch.
+     *
+     * @param[in] request     Key describing the request
+     * @param[in] generation  The policy generation the decision was made under
+     * @param[in] epoch       The token returned by GetCachedAuthorization
+     * @param[in] authorized  The decision
+     */
+    void CacheAuthorization(const std::string& request, uint32_t generation, uint32_t epoch, bool authorized);
+
+    /**
+     * Drop the cached authorization decisions.  Must be called whenever the
+     * peer's manifests, memberships or keys change.
+     */
+    void ClearAuthorizationCache();
+
     /**
      * Clear the guild map and its members
      */
@@ -682,6 +714,16 @@ class _PeerState {
      */
     qcc::Mutex& GetConversationHashLock(bool initiator);
 
+    /**
+     * Gets the session key. The key lock must be held.
+     */
+    QStatus GetKeyLocked(qcc::KeyBlob& key, PeerKeyType keyType);
+
+    /**
+     * Clears the session keys. The key lock must be held.
+     */
+    void ClearKeysLocked();
+
     /**
      * True if this peer state is for the local peer.
      */
@@ -733,6 +775,16 @@ class _PeerState {
      */
     qcc::KeyBlob keys[2];
 
+    /**
+     * AES-CCM contexts expanded from the session keys, created lazily by GetKey().
+     */
+    std::shared_ptr<qcc::Crypto_AES> ciphers[2];
+
+    /**
+     * Mutex to protect the session keys and their AES-CCM contexts.
+     */
+    qcc::Mutex keyLock;
+
     /**
      * The previous serial number seen from this peer.
      * Used by IsValidSerial() to detect replay attacks.
@@ -794,6 +846,29 @@ class _PeerState {
      */
     bool m_haveExchangedManifests;
 
+    /**
+     * Maximum number of cached authorization decisions.
+     */
+    static const size_t MAX_CACHED_AUTHORIZATIONS = 256;
+
+    /**
+     * Authorization decisions made for this peer under policy generation
+     * m_authorizationGeneration.
+     */
+    std::unordered_map<std::string, bool> m_authorizationCache;
+    uint32_t m_authorizationGeneration;
+
+    /**
+     * Bumped by ClearAuthorizationCache() so that a decision evaluated
+     * across a clear is not cached.
+     */
+    uint32_t m_authorizationEpoch;
+
+    /**
+     * Mutex to protect the authorization cache.
+     */
+    qcc::Mutex m_authorizationCacheLock;
+
 };
 
 
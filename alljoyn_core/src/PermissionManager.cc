@@ -445,11 +445,8 @@ static bool IsPeerAuthorized(const Request& request, const PermissionPolicy* pol
  * 5. all peers
  */
 
-static bool IsAuthorized(const Request& request, const PermissionPolicy* policy, PeerState& peerState, PermissionMgmtObj* permissionMgmtObj, bool authenticated = true)
+static bool EvaluateAuthorization(const Request& request, const Right& right, const PermissionPolicy* policy, PeerState& peerState, PermissionMgmtObj* permissionMgmtObj, bool authenticated, bool& cacheable)
 {
-    Right right;
-    GenRight(request, right);
-
     bool authorized = false;
     bool denied = false;
     bool enforceManifest = true;
@@ -474,6 +471,8 @@ static bool IsAuthorized(const Request& request, const PermissionPolicy* policy,
                     trustedPeerPublicKey = publicKeyInfo.GetPublicKey();
                     trustedPeer = true;
                     enforceManifest = false;
+                } else {
+                    cacheable = false;
                 }
             } else {
                 bool publicKeyFound = false;
@@ -496,6 +495,9 @@ static bool IsAuthorized(const Request& request, const PermissionPolicy* policy,
                     /* assuming the peer secret just expires so it is not a trusted
                      * peer */
                     enforceManifest = false;
+                    cacheable = false;
+                } else {
+                    cacheable = false;
                 }
             }
         }
@@ -524,61 +526,115 @@ static bool IsAuthorized(const Request& request, const PermissionPolicy* policy,
     return authorized;
 }
 
-static bool IsStdInterface(const char* iName)
+/**
+ * Evaluate the request, reusing the peer's cached decision when there is one.
+ * Decisions are tagged with the policy generation, and the peer drops them
+ * whenever its keys, manifests or memberships change.
+ */
+static bool IsAuthorized(const Request& request, const PermissionPolicy* policy, uint32_t policyGeneration, PeerState& peerState, PermissionMgmtObj* permissionMgmtObj, bool authenticated = true)
 {
-    if (strcmp(iName, org::alljoyn::Bus::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Daemon::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Daemon::Debug::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Bus::Peer::Authentication::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Bus::Peer::Session::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::allseen::Introspectable::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Bus::Peer::HeaderCompression::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::freedesktop::DBus::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::freedesktop::DBus::Peer::InterfaceName) == 0) {
-        return true;
+    Right right;
+    GenRight(request, right);
+
+    std::string key(request.objPath ? request.objPath : "");
+    key.push_back('\0');
+    key.append(request.iName ? request.iName : "");
+    key.push_back('\0');
+    if (request.mbrName) {
+        key.append(request.mbrName);
+    }
+    key.push_back('\0');
+    key.push_back(static_cast<char>(request.mbrType));
+    key.push_back(static_cast<char>(right.authByPolicy));
+    key.push_back(static_cast<char>((request.outgoing ? 0x01 : 0) |
+                                    (request.propertyRequest ? 0x02 : 0) |
+                                    (request.isSetProperty ? 0x04 : 0) |
+                                    (request.mbrName ? 0x08 : 0) |
+                                    (authenticated ? 0x10 : 0)));
+
+    bool authorized = false;
+    uint32_t epoch;
+    if (peerState->GetCachedAuthorization(key, policyGeneration, authorized, epoch)) {
+        return authorized;
     }
-    if (strcmp(iName, org::freedesktop::DBus::Introspectable::InterfaceName) == 0) {
-        return true;
+    bool cacheable = true;
+    authorized = EvaluateAuthorization(request, right, policy, peerState, permissionMgmtObj, authenticated, cacheable);
+    if (cacheable) {
+        peerState->CacheAuthorization(key, policyGeneration, epoch, authorized);
     }
-    return false;
+    return authorized;
 }
 
-static bool IsPropertyInterface(const char* iName)
+enum SpecialInterface {
+    NOT_SPECIAL_INTERFACE = 0,
+    STD_INTERFACE,
+    PROPERTY_INTERFACE,
+    PERMISSION_MGMT_INTERFACE
+};
+
+struct SpecialInterfaceSlot {
+    const char* const* name;
+    SpecialInterface kind;
+};
+
+/*
+ * The interfaces that get special treatment, placed by SpecialInterfaceHash().
+ * The hash is collision free for exactly this set of names so a lookup costs
+ * one strcmp.  Any change to the set requires rechecking the slot assignment.
+ */
+static const size_t SPECIAL_INTERFACE_SLOTS = 32;
+static const SpecialInterfaceSlot specialInterfaces[SPECIAL_INTERFACE_SLOTS] = {
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::alljoyn::Daemon::Debug::InterfaceName, STD_INTERFACE },
+    { &org::freedesktop::DBus::Properties::InterfaceName, PROPERTY_INTERFACE },
+    { &org::alljoyn::Daemon::InterfaceName, STD_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::alljoyn::Bus::Peer::Authentication::InterfaceName, STD_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::alljoyn::Bus::Security::Application::InterfaceName, PERMISSION_MGMT_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::freedesktop::DBus::Introspectable::InterfaceName, STD_INTERFACE },
+    { &org::alljoyn::Bus::Peer::HeaderCompression::InterfaceName, STD_INTERFACE },
+    { &org::freedesktop::DBus::InterfaceName, STD_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::allseen::Introspectable::InterfaceName, STD_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::alljoyn::Bus::Security::ManagedApplication::InterfaceName, PERMISSION_MGMT_INTERFACE },
+    { &org::freedesktop::DBus::Peer::InterfaceName, STD_INTERFACE },
+    { &org::alljoyn::Bus::Peer::Session::InterfaceName, STD_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::alljoyn::Bus::Security::ClaimableApplication::InterfaceName, PERMISSION_MGMT_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { NULL, NOT_SPECIAL_INTERFACE },
+    { &org::alljoyn::Bus::InterfaceName, STD_INTERFACE }
+};
+
+static SpecialInterface GetSpecialInterface(const char* iName)
 {
-    if (strcmp(iName, org::freedesktop::DBus::Properties::InterfaceName) == 0) {
-        return true;
+    /* All the special interface names are longer than "org.x" */
+    size_t len = strlen(iName);
+    if (len < 5) {
+        return NOT_SPECIAL_INTERFACE;
     }
-    return false;
+    const SpecialInterfaceSlot& slot = specialInterfaces[(2 * len + static_cast<uint8_t>(iName[4])) % SPECIAL_INTERFACE_SLOTS];
+    if (slot.name && (strcmp(iName, *slot.name) == 0)) {
+        return slot.kind;
+    }
+    return NOT_SPECIAL_INTERFACE;
 }
 
 static bool IsPermissionMgmtInterface(const char* iName)
 {
-    if (strcmp(iName, org::alljoyn::Bus::Security::Application::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Bus::Security::ClaimableApplication::InterfaceName) == 0) {
-        return true;
-    }
-    if (strcmp(iName, org::alljoyn::Bus::Security::ManagedApplication::InterfaceName) == 0) {
-        return true;
-    }
-    return false;
+    return GetSpecialInterface(iName) == PERMISSION_MGMT_INTERFACE;
 }
 
 static QStatus ParsePropertiesMessage(Request& request, Message& msg)
@@ -788,11 +844,12 @@ QStatus PermissionManager::AuthorizeMessage(bool outgoing, Message& msg, PeerSta
     }
 
     /* skip the AllJoyn Std interfaces */
-    if (IsStdInterface(msg->GetInterface())) {
+    SpecialInterface special = GetSpecialInterface(msg->GetInterface());
+    if (special == STD_INTERFACE) {
         return ER_OK;
     }
     Request request(msg, outgoing);
-    if (IsPropertyInterface(msg->GetInterface())) {
+    if (special == PROPERTY_INTERFACE) {
         status = ParsePropertiesMessage(request, msg);
         if (status != ER_OK) {
             return status;
@@ -829,7 +886,8 @@ QStatus PermissionManager::AuthorizeMessage(bool outgoing, Message& msg, PeerSta
     QCC_DbgPrintf(("PermissionManager::AuthorizeMessage with outgoing: %d msg %s", outgoing, msg->ToString().c_str()));
     QCC_DbgPrintf(("PermissionManager::AuthorizeMessage: local policy %s", GetPolicy() ? GetPolicy()->ToString().c_str() : "NULL"));
 
-    authorized = IsAuthorized(request, GetPolicy(), peerState, permissionMgmtObj, authenticated);
+    uint32_t policyGeneration = GetPolicyGeneration();
+    authorized = IsAuthorized(request, GetPolicy(), policyGeneration, peerState, permissionMgmtObj, authenticated);
     if (!authorized) {
         QCC_DbgPrintf(("PermissionManager::AuthorizeMessage IsAuthorized returns ER_PERMISSION_DENIED\n"));
         return ER_PERMISSION_DENIED;
@@ -851,7 +909,8 @@ QStatus PermissionManager::AuthorizeGetProperty(const char* objPath, const char*
     QCC_DbgPrintf(("PermissionManager::AuthorizeGetProperty: ifc %s prop %s local policy %s", ifcName, propName, GetPolicy() ? GetPolicy()->ToString().c_str() : "NULL"));
 
     Request request(objPath, ifcName, propName, PermissionPolicy::Rule::Member::PROPERTY, false, true);
-    if (!IsAuthorized(request, GetPolicy(), peerState, permissionMgmtObj)) {
+    uint32_t policyGeneration = GetPolicyGeneration();
+    if (!IsAuthorized(request, GetPolicy(), policyGeneration, peerState, permissionMgmtObj)) {
         QCC_DbgPrintf(("PermissionManager::AuthorizeGetProperty IsAuthorized returns ER_PERMISSION_DENIED\n"));
         return ER_PERMISSION_DENIED;
     }
@@ -38,6 +38,7 @@
 #error Only include PermissionManager.h in C++ code.
 #endif
 
+#include <qcc/atomic.h>
 #include <alljoyn/PermissionPolicy.h>
 #include "PermissionMgmtObj.h"
 
@@ -51,7 +52,7 @@ class PermissionManager {
      * Constructor
      *
      */
-    PermissionManager() : policy(NULL), permissionMgmtObj(NULL)
+    PermissionManager() : policy(NULL), permissionMgmtObj(NULL), policyGeneration(0)
     {
     }
 
@@ -72,6 +73,8 @@ class PermissionManager {
     {
         delete this->policy;
         this->policy = policy;
+        /* Authorization decisions cached by the peers are for the old policy. */
+        qcc::IncrementAndFetch(&policyGeneration);
     }
 
     /**
@@ -83,6 +86,15 @@ class PermissionManager {
         return policy;
     }
 
+    /**
+     * Retrieve the policy generation, which changes whenever the policy does.
+     * @return the policy generation.
+     */
+    uint32_t GetPolicyGeneration() const
+    {
+        return static_cast<uint32_t>(policyGeneration);
+    }
+
     /**
      * Authorize a message.  Make sure there is a proper permission is setup for this type of message.
      * @param outgoing indicating whether is a outgoing or incoming
@@ -139,6 +151,12 @@ class PermissionManager {
 
     PermissionPolicy* policy;
     PermissionMgmtObj* permissionMgmtObj;
+
+    /**
+     * Incremented on every policy change; tags the authorization decisions
+     * cached in each PeerState.
+     */
+    volatile int32_t policyGeneration;
 };
 
 }
@@ -36,6 +36,7 @@
 #include <alljoyn/AllJoynStd.h>
 #include <qcc/KeyInfoECC.h>
 #include <qcc/Crypto.h>
+#include <qcc/CertificateCache.h>
 #include <qcc/CertificateECC.h>
 #include <qcc/CertificateHelper.h>
 #include <qcc/StringUtil.h>
@@ -198,6 +199,8 @@ void PermissionMgmtObj::PolicyChanged(PermissionPolicy* policy)
     ca->GetGuid(localGUID);
     bus.GetInternal().GetPermissionManager().SetPolicy(policy);
     ManageTrustAnchors(policy);
+    /* Cached certificate verifications predate the new policy. */
+    CertificateCache::Clear();
 
     /* Finally, inform the application that it's security policy has changed. */
     bus.GetInternal().CallPolicyChangedCallback();
@@ -413,6 +416,7 @@ void PermissionMgmtObj::ClearTrustAnchors()
     trustAnchors.Lock(MUTEX_CONTEXT);
     trustAnchors.clear();
     trustAnchors.Unlock(MUTEX_CONTEXT);
+    CertificateCache::Clear();
 }
 
 QStatus PermissionMgmtObj::StoreDSAKeys(CredentialAccessor* ca, const ECCPrivateKey* privateKey, const ECCPublicKey* publicKey)
@@ -980,7 +984,7 @@ static QStatus ValidateCertificateWithTrustAnchors(const CertificateX509& cert,
         } else {
             qualified = true;
         }
-        if (qualified && (cert.Verify(ta->keyInfo.GetPublicKey()) == ER_OK)) {
+        if (qualified && (CertificateCache::Verify(cert, ta->keyInfo.GetPublicKey()) == ER_OK)) {
             status = ER_OK;  /* cert is verified */
             break;
         }
@@ -1048,7 +1052,7 @@ static QStatus ValidateMembershipCertificateChain(vector<CertificateX509*>& cert
 static QStatus LoadCertificate(CertificateX509::EncodingType encoding, const uint8_t* encoded, size_t encodedLen, CertificateX509& cert)
 {
     if (encoding == CertificateX509::ENCODING_X509_DER) {
-        return cert.DecodeCertificateDER(qcc::String((const char*) encoded, encodedLen));
+        return CertificateCache::DecodeCertificateDER(qcc::String((const char*) encoded, encodedLen), cert);
     } else if (encoding == CertificateX509::ENCODING_X509_DER_PEM) {
         return cert.DecodeCertificatePEM(qcc::String((const char*) encoded, encodedLen));
     }
@@ -1350,7 +1354,7 @@ QStatus PermissionMgmtObj::RetrieveIdentityCertificateId(qcc::String& serial, qc
             goto Exit;
         }
         for (TrustAnchorList::const_iterator it = anchors.begin(); it != anchors.end(); it++) {
-            if (ER_OK == leafCert.Verify((*it)->keyInfo.GetPublicKey())) {
+            if (ER_OK == CertificateCache::Verify(leafCert, (*it)->keyInfo.GetPublicKey())) {
                 issuerKeyInfo.SetPublicKey((*it)->keyInfo.GetPublicKey());
                 break;
             }
@@ -2274,7 +2278,7 @@ QStatus PermissionMgmtObj::GetMembershipSummaries(MsgArg& arg)
             TrustAnchorList anchors = LocateTrustAnchor(trustAnchors, leafCert->GetAuthorityKeyId());
 
             for (TrustAnchorList::const_iterator it = anchors.begin(); it != anchors.end(); it++) {
-                if (ER_OK == leafCert->Verify((*it)->keyInfo.GetPublicKey())) {
+                if (ER_OK == CertificateCache::Verify(*leafCert, (*it)->keyInfo.GetPublicKey())) {
                     issuerKeyInfo.SetPublicKey((*it)->keyInfo.GetPublicKey());
                     break;
                 }
@@ -2437,6 +2441,7 @@ QStatus PermissionMgmtObj::ParseSendManifests(Message& msg, PeerState& peerState
     vector<uint8_t> thumbprintVector(Crypto_SHA256::DIGEST_SIZE);
     thumbprintVector.assign(identityCertificateThumbprint, identityCertificateThumbprint + Crypto_SHA256::DIGEST_SIZE);
 
+    vector<Manifest> manifests;
     for (size_t i = 0; i < signedManifestCount; i++) {
         Manifest signedManifest;
         status = signedManifest->SetFromMsgArg(signedManifestArgs[i]);
@@ -2444,9 +2449,22 @@ QStatus PermissionMgmtObj::ParseSendManifests(Message& msg, PeerState& peerState
             QCC_LogError(status, ("Could not import manifest from MsgArg"));
             continue;
         }
+        manifests.push_back(signedManifest);
+    }
+
+    /* If we did get the public key of the leaf cert issuer, that key must have signed the
+     * manifests: check all of them against it at once.
+     */
+    vector<QStatus> results(manifests.size(), ER_CRYPTO_ERROR);
+    if (!manifests.empty() && !issuerPublicKeys.empty()) {
+        _Manifest::VerifyBatch(manifests.data(), manifests.size(), thumbprintVector, &(issuerPublicKeys[0]), results);
+    }
+
+    for (size_t i = 0; i < manifests.size(); i++) {
+        Manifest& signedManifest = manifests[i];
 
-        status = ER_CRYPTO_ERROR;
-        if (0 == issuerPublicKeys.size()) {
+        status = results[i];
+        if ((ER_OK != status) && (0 == issuerPublicKeys.size())) {
             /* Sometimes we don't get a full cert chain if the chain is just the leaf and then
              * a trust anchor. In this case, try to validate the manifest with all the CA trust
              * anchors.
@@ -2463,12 +2481,10 @@ QStatus PermissionMgmtObj::ParseSendManifests(Message& msg, PeerState& peerState
             }
 
             trustAnchors.Unlock(MUTEX_CONTEXT);
-        } else {
-            /* If we did get the public key of the leaf cert issuer, though, that key must have
-             * signed the manifest.
-             */
-            for (size_t i = 0; i < issuerPublicKeys.size(); i++) {
-                status = signedManifest->Verify(thumbprintVector, &(issuerPublicKeys[i]));
+        } else if (ER_OK != status) {
+            /* The first issuer key was tried by the batch above, try the others. */
+            for (size_t k = 1; k < issuerPublicKeys.size(); k++) {
+                status = signedManifest->Verify(thumbprintVector, &(issuerPublicKeys[k]));
                 if (ER_OK == status) {
                     break;
                 }
@@ -2555,6 +2571,7 @@ QStatus PermissionMgmtObj::ParseSendMemberships(Message& msg, bool& done)
         status = GetConnectedPeerPublicKey(peerState->GetGuid(), &peerPublicKey);
         if (ER_OK != status) {
             _PeerState::ClearGuildMap(peerState->guildMap);
+            peerState->ClearAuthorizationCache();
             done = true;
             return ER_OK;  /* could not validate */
         }
@@ -2598,6 +2615,7 @@ QStatus PermissionMgmtObj::ParseSendMemberships(Message& msg, bool& done)
                 break;  /* done */
             }
         }
+        peerState->ClearAuthorizationCache();
         done = true;
     }
     return ER_OK;
@@ -2985,14 +3003,14 @@ bool PermissionMgmtObj::ValidateCertChain(bool verifyIssuerChain, bool validateT
             /* locate the issuer */
             if (certChain[0].GetAuthorityKeyId().empty()) {
                 if (IsTrustAnchor(certChain[0].GetSubjectPublicKey())) {
-                    valid = (ER_OK == certChain[0].Verify(certChain[0].GetSubjectPublicKey()));
+                    valid = (ER_OK == CertificateCache::Verify(certChain[0], certChain[0].GetSubjectPublicKey()));
                 }
             } else {
                 TrustAnchorList anchors = LocateTrustAnchor(trustAnchors, certChain[0].GetAuthorityKeyId());
 
                 if (!anchors.empty()) {
                     for (TrustAnchorList::const_iterator it = anchors.begin(); it != anchors.end(); it++) {
-                        valid = (ER_OK == certChain[0].Verify((*it)->keyInfo.GetPublicKey()));
+                        valid = (ER_OK == CertificateCache::Verify(certChain[0], (*it)->keyInfo.GetPublicKey()));
                         if (valid) {
                             break;
                         }
@@ -1626,7 +1626,7 @@ QStatus _Manifest::ComputeThumbprintAndVerify(const CertificateX509& subjectCert
     return Verify(thumbprint, issuerPublicKey);
 }
 
-QStatus _Manifest::Verify(const std::vector<uint8_t>& subjectThumbprint, const ECCPublicKey* issuerPublicKey) const
+QStatus _Manifest::GetSignedDigest(const std::vector<uint8_t>& subjectThumbprint, std::vector<uint8_t>& digest, ECCSignature& signature) const
 {
     /* Only SHA-256 is supported as the thumbprint algorithm. */
     if (m_thumbprintAlgorithmOid != std::string(qcc::OID_DIG_SHA256.c_str())) {
@@ -1641,36 +1641,87 @@ QStatus _Manifest::Verify(const std::vector<uint8_t>& subjectThumbprint, const E
     }
 
     /* Compute our view of the digest. */
-    std::vector<uint8_t> digest;
     QStatus status = GetDigest(digest);
     if (ER_OK != status) {
         QCC_LogError(status, ("Could not compute manifest digest"));
         return status;
     }
 
-    /* Make sure the signature agrees. */
-    ECCSignature signature;
     status = GetECCSignature(signature);
     if (ER_OK != status) {
         QCC_LogError(status, ("Could not get ECC signature from manifest"));
         return status;
     }
 
-    Crypto_ECC ecc;
-    ecc.SetDSAPublicKey(issuerPublicKey);
-    status = ecc.DSAVerifyDigest(digest.data(), digest.size(), &signature);
+    return status;
+}
+
+/* Map the result of the signature check to the result of Verify. */
+static QStatus ManifestSignatureStatus(QStatus status)
+{
     if (ER_OK != status) {
         QCC_LogError(status, ("Manifest signature failed to verify"));
         if (ER_CRYPTO_ERROR == status) {
             return ER_DIGEST_MISMATCH;
-        } else {
-            return status;
         }
     }
-
     return status;
 }
 
+QStatus _Manifest::Verify(const std::vector<uint8_t>& subjectThumbprint, const ECCPublicKey* issuerPublicKey) const
+{
+    std::vector<uint8_t> digest;
+    ECCSignature signature;
+    QStatus status = GetSignedDigest(subjectThumbprint, digest, signature);
+    if (ER_OK != status) {
+        return status;
+    }
+
+    /* Make sure the signature agrees. */
+    Crypto_ECC ecc;
+    ecc.SetDSAPublicKey(issuerPublicKey);
+    status = ecc.DSAVerifyDigest(digest.data(), digest.size(), &signature);
+
+    return ManifestSignatureStatus(status);
+}
+
+QStatus _Manifest::VerifyBatch(const Manifest* manifests, size_t manifestCount, const std::vector<uint8_t>& subjectThumbprint, const ECCPublicKey* issuerPublicKey, std::vector<QStatus>& results)
+{
+    std::vector<std::vector<uint8_t> > digests(manifestCount);
+    std::vector<ECCSignature> signatures(manifestCount);
+    std::vector<Crypto_ECC::DSAVerifyEntry> entries;
+    std::vector<size_t> entryManifest;
+
+    results.assign(manifestCount, ER_OK);
+    for (size_t i = 0; i < manifestCount; i++) {
+        results[i] = manifests[i]->GetSignedDigest(subjectThumbprint, digests[i], signatures[i]);
+        if (ER_OK == results[i]) {
+            Crypto_ECC::DSAVerifyEntry entry;
+            entry.publicKey = issuerPublicKey;
+            entry.digest = digests[i].data();
+            entry.len = static_cast<uint16_t>(digests[i].size());
+            entry.sig = &signatures[i];
+            entry.status = ER_OK;
+            entries.push_back(entry);
+            entryManifest.push_back(i);
+        }
+    }
+
+    if (!entries.empty()) {
+        Crypto_ECC::DSAVerifyDigestBatch(entries.data(), entries.size());
+        for (size_t i = 0; i < entries.size(); i++) {
+            results[entryManifest[i]] = ManifestSignatureStatus(entries[i].status);
+        }
+    }
+
+    for (size_t i = 0; i < manifestCount; i++) {
+        if (ER_OK != results[i]) {
+            return results[i];
+        }
+    }
+    return ER_OK;
+}
+
 QStatus _Manifest::GetDigest(std::vector<uint8_t>& digest) const
 {
     QCC_DbgTrace(("%s", __FUNCTION__));
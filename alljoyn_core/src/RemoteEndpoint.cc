@@ -32,6 +32,8 @@
  ******************************************************************************/
 #include <qcc/platform.h>
 
+#include <algorithm>
+#include <vector>
 
 #include <qcc/Debug.h>
 #include <qcc/String.h>
@@ -66,6 +68,12 @@ namespace ajn {
 
 #define ENDPOINT_IS_DEAD_ALERTCODE  1
 
+/*
+ * Default size of the receive buffer. Large enough to pick up a burst of small
+ * messages with a single read of the stream.
+ */
+static const size_t RX_BUFFER_SIZE_DEFAULT = 64 * 1024;
+
 /*
  * SetState is defined as a macro so that the line number in the debug logs
  * corresponds to the location the state was changed at.
@@ -120,19 +128,62 @@ class _RemoteEndpoint::Internal {
         currentReadMsg(bus),
         validateSender(incoming),
         hasRxSessionMsg(false),
-        getNextMsg(true),
-        currentWriteMsg(bus),
+        numWriting(0),
         state(STOPPED),
         stopAfterTxEmpty(false),
         pingCallSerial(0),
         sendTimeout(0),
         maxControlMessages(30),
         numControlMessages(0),
-        numDataMessages(0)
+        numDataMessages(0),
+        maxTxQueueSize(1),
+        maxTxQueueBytes(0),
+        maxTxBatch(1),
+        txQueueBytes(0),
+        rxBuf(NULL),
+        rxBufSize(RX_BUFFER_SIZE_DEFAULT),
+        rxHead(0),
+        rxTail(0)
+    {
+    }
+
+    /**
+     * Check if there is room in the txQueue for another data message.  A
+     * message always fits if there are no data messages queued.  Caller must
+     * hold the lock.
+     */
+    bool TxQueueHasRoom(bool isLeaf, Message& msg) const
+    {
+        size_t numQueued = isLeaf ? txQueue.size() : numDataMessages;
+        if (numQueued == 0) {
+            return true;
+        }
+        if (numQueued >= maxTxQueueSize) {
+            return false;
+        }
+        return (maxTxQueueBytes == 0) || ((txQueueBytes + msg->GetBufferSize()) <= maxTxQueueBytes);
+    }
+
+    /**
+     * Add a message to the txQueue.  Caller must hold the lock.
+     */
+    void TxQueuePush(Message& msg)
     {
+        txQueue.push_front(msg);
+        txQueueBytes += msg->GetBufferSize();
+    }
+
+    /**
+     * Remove a message from the txQueue.  Caller must hold the lock.
+     */
+    void TxQueueErase(std::deque<Message>::iterator it)
+    {
+        txQueueBytes -= (std::min)(txQueueBytes, (*it)->GetBufferSize());
+        txQueue.erase(it);
     }
 
     ~Internal() {
+        delete [] rxBuf;
     }
 
     BusAttachment& bus;                      /**< Message bus associated with this endpoint */
@@ -166,8 +217,8 @@ class _RemoteEndpoint::Internal {
     Message currentReadMsg;                  /**< The message currently being read for this endpoint */
     const bool validateSender;               /**< If true, the sender field on incomming messages will be overwritten with actual endpoint name */
     bool hasRxSessionMsg;                    /**< true iff this endpoint has previously processed a non-control message */
-    bool getNextMsg;                         /**< If true, read the next message from the txQueue */
-    Message currentWriteMsg;                 /**< The message currently being read for this endpoint */
+    std::vector<_Message::WriteCursor> currentWrites; /**< Write positions of the messages at the back of txQueue currently being written */
+    size_t numWriting;                       /**< Number of messages at the back of txQueue currently being written */
     State state;                             /**< The state of the stream, protected by lock */
     bool stopAfterTxEmpty;                   /**< True to StopStream() when txQueue is empty */
     set<SessionId> sessionIdSet;                    /**< Set of session Ids that this endpoint is a part of */
@@ -180,6 +231,15 @@ class _RemoteEndpoint::Internal {
                                                   - used on Routing nodes only */
     volatile size_t numControlMessages;      /**< Number of control messages in txQueue - used on Routing nodes only */
     volatile size_t numDataMessages;         /**< Number of data messages in txQueue - used on Routing nodes only */
+    size_t maxTxQueueSize;                   /**< Number of data messages that can be queued before PushMessage() blocks */
+    size_t maxTxQueueBytes;                  /**< Number of bytes of data messages that can be queued before PushMessage() blocks
+                                                  or 0 for no byte limit */
+    size_t maxTxBatch;                       /**< Maximum number of queued messages written to the stream with a single write */
+    size_t txQueueBytes;                     /**< Number of bytes of messages in txQueue */
+    uint8_t* rxBuf;                          /**< Receive buffer, allocated on first use */
+    size_t rxBufSize;                        /**< Size of rxBuf or 0 to read messages directly from the stream */
+    size_t rxHead;                           /**< Offset of the first unconsumed byte in rxBuf */
+    size_t rxTail;                           /**< Offset one past the last byte read into rxBuf */
   private:
     Internal& operator=(const Internal&);
 };
@@ -397,6 +457,66 @@ QStatus _RemoteEndpoint::SetIdleTimeouts(uint32_t& idleTimeout, uint32_t& probeT
     return ER_OK;
 }
 
+void _RemoteEndpoint::SetTxQueueLimits(size_t maxMessages, size_t maxBytes, size_t maxBatch)
+{
+    QCC_DbgPrintf(("_RemoteEndpoint::SetTxQueueLimits(%u, %u, %u) for %s", static_cast<uint32_t>(maxMessages),
+                   static_cast<uint32_t>(maxBytes), static_cast<uint32_t>(maxBatch), GetUniqueName().c_str()));
+
+    if (internal) {
+        internal->lock.Lock(MUTEX_CONTEXT);
+        internal->maxTxQueueSize = (std::max)(maxMessages, static_cast<size_t>(1));
+        internal->maxTxQueueBytes = maxBytes;
+        internal->maxTxBatch = (std::max)((std::min)(maxBatch, SOCKET_MAX_IOVECS), static_cast<size_t>(1));
+        internal->lock.Unlock(MUTEX_CONTEXT);
+    }
+}
+
+void _RemoteEndpoint::SetRxBufferSize(size_t size)
+{
+    if (internal) {
+        QCC_ASSERT(internal->rxHead == internal->rxTail);
+        delete [] internal->rxBuf;
+        internal->rxBuf = NULL;
+        internal->rxBufSize = size;
+        internal->rxHead = 0;
+        internal->rxTail = 0;
+    }
+}
+
+QStatus _RemoteEndpoint::PullBytes(void* buf, size_t reqBytes, size_t& actualBytes, uint32_t timeout)
+{
+    if (!internal) {
+        return ER_BUS_NO_ENDPOINT;
+    }
+    if (internal->rxHead == internal->rxTail) {
+        /*
+         * Read directly from the stream if the request would not fit in the
+         * receive buffer. We also must not read ahead if handles are passed on
+         * this connection (the handles arrive with specific bytes) or if rx is
+         * armed to pause after the next reply (the bytes following the reply
+         * belong to a raw session).
+         */
+        if ((reqBytes >= internal->rxBufSize) || internal->features.handlePassing || internal->armRxPause) {
+            return internal->stream->PullBytes(buf, reqBytes, actualBytes, timeout);
+        }
+        if (!internal->rxBuf) {
+            internal->rxBuf = new uint8_t[internal->rxBufSize];
+        }
+        size_t received = 0;
+        QStatus status = internal->stream->PullBytes(internal->rxBuf, internal->rxBufSize, received, timeout);
+        if (status != ER_OK) {
+            actualBytes = 0;
+            return status;
+        }
+        internal->rxHead = 0;
+        internal->rxTail = received;
+    }
+    actualBytes = (std::min)(reqBytes, internal->rxTail - internal->rxHead);
+    memcpy(buf, internal->rxBuf + internal->rxHead, actualBytes);
+    internal->rxHead += actualBytes;
+    return ER_OK;
+}
+
 QStatus _RemoteEndpoint::SetIdleTimeouts(uint32_t idleTimeout, uint32_t probeTimeout, uint32_t maxIdleProbes)
 {
     QCC_DbgPrintf(("_RemoteEndpoint::SetIdleTimeouts(%u, %u, %u) for %s", idleTimeout, probeTimeout, maxIdleProbes, GetUniqueName().c_str()));
@@ -1055,16 +1175,21 @@ QStatus _RemoteEndpoint::WriteCallback(qcc::Sink& sink, bool isTimedOut)
             return ER_BUS_NO_ENDPOINT;
         }
 
-        /* Get the message */
-        if (internal->getNextMsg) {
+        /* Get the messages */
+        if (internal->currentWrites.empty()) {
             if (!internal->txQueue.empty()) {
                 /*
-                 * Make a deep copy of the message since there is state
-                 * information inside the message.  Each copy of the message
-                 * could be in different write state.
+                 * The write state of each message is kept in a cursor so the
+                 * same message can be written to several endpoints without
+                 * copying it.  Up to maxTxBatch messages from the back of the
+                 * txQueue are written together.
                  */
-                internal->currentWriteMsg = Message(internal->txQueue.back(), true);
-                internal->getNextMsg = false;
+                size_t numMsgs = (std::min)(internal->txQueue.size(), internal->maxTxBatch);
+                deque<Message>::reverse_iterator it = internal->txQueue.rbegin();
+                for (size_t i = 0; i < numMsgs; ++i, ++it) {
+                    internal->currentWrites.push_back(_Message::WriteCursor(*it));
+                }
+                internal->numWriting = numMsgs;
             } else {
                 internal->bus.GetInternal().GetIODispatch().DisableWriteCallback(internal->stream);
                 if (internal->txWaitQueue.empty()) {
@@ -1111,13 +1236,14 @@ QStatus _RemoteEndpoint::WriteCallback(qcc::Sink& sink, bool isTimedOut)
             }
         }
 
-        /* Deliver the message */
+        /* Deliver the messages */
         internal->lock.Unlock(MUTEX_CONTEXT);
         RemoteEndpoint rep = RemoteEndpoint::wrap(this);
-        status = internal->currentWriteMsg->DeliverNonBlocking(rep);
+        size_t numDelivered = 0;
+        status = _Message::DeliverNonBlocking(rep, &internal->currentWrites[0], internal->currentWrites.size(), numDelivered);
         /* Report authorization failure as a security violation */
         if ((status == ER_BUS_NOT_AUTHORIZED) || (status == ER_PERMISSION_DENIED)) {
-            internal->bus.GetInternal().GetLocalEndpoint()->GetPeerObj()->HandleSecurityViolation(internal->currentWriteMsg, status);
+            internal->bus.GetInternal().GetLocalEndpoint()->GetPeerObj()->HandleSecurityViolation(internal->currentWrites[numDelivered].GetMessage(), status);
             /*
              * Clear the error after reporting the security violation otherwise we will exit
              * this thread which will shut down the endpoint.
@@ -1126,27 +1252,31 @@ QStatus _RemoteEndpoint::WriteCallback(qcc::Sink& sink, bool isTimedOut)
              * it.
              */
             status = ER_OK;
+            ++numDelivered;
         }
         internal->lock.Lock(MUTEX_CONTEXT);
-        if (status == ER_OK) {
-            /* Message has been successfully delivered. i.e. PushBytes is complete */
-            internal->txQueue.pop_back();
-            internal->getNextMsg = true;
-            if (internal->bus.GetInternal().GetRouter().IsDaemon()) {
-                if (IsControlMessage(internal->currentWriteMsg)) {
-                    QCC_ASSERT(internal->numControlMessages > 0);
-                    internal->numControlMessages--;
-                } else {
-                    QCC_ASSERT(internal->numDataMessages > 0);
-                    internal->numDataMessages--;
+        if (numDelivered > 0) {
+            /* Messages have been successfully delivered. i.e. PushBytes is complete */
+            for (size_t i = 0; i < numDelivered; ++i) {
+                if (internal->bus.GetInternal().GetRouter().IsDaemon()) {
+                    if (IsControlMessage(internal->currentWrites[i].GetMessage())) {
+                        QCC_ASSERT(internal->numControlMessages > 0);
+                        internal->numControlMessages--;
+                    } else {
+                        QCC_ASSERT(internal->numDataMessages > 0);
+                        internal->numDataMessages--;
+                    }
                 }
+                internal->TxQueueErase(internal->txQueue.end() - 1);
             }
+            internal->currentWrites.erase(internal->currentWrites.begin(), internal->currentWrites.begin() + numDelivered);
+            internal->numWriting -= numDelivered;
             /* Alert the first one in the txWaitQueue */
             if (0 < internal->txWaitQueue.size()) {
                 Thread* wakeMe = internal->txWaitQueue.back();
-                status = wakeMe->Alert();
-                if (ER_OK != status) {
-                    QCC_LogError(status, ("Failed to alert thread blocked on full tx queue"));
+                QStatus alertStatus = wakeMe->Alert();
+                if (ER_OK != alertStatus) {
+                    QCC_LogError(alertStatus, ("Failed to alert thread blocked on full tx queue"));
                 }
             }
         }
@@ -1182,8 +1312,6 @@ QStatus _RemoteEndpoint::PushMessage(Message& msg)
 
     QStatus status = ER_OK;
 
-    static const size_t MAX_DATA_MESSAGES = 1;
-    static const size_t MAX_TX_QUEUE_SIZE = 1;
     size_t count;
     bool wasEmpty;
     bool threadWait = true;
@@ -1213,7 +1341,7 @@ QStatus _RemoteEndpoint::PushMessage(Message& msg)
 
         if (IsControlMessage(msg)) {
             if (internal->numControlMessages < internal->maxControlMessages) {
-                internal->txQueue.push_front(msg);
+                internal->TxQueuePush(msg);
                 internal->numControlMessages++;
                 if (wasEmpty) {
                     internal->bus.GetInternal().GetIODispatch().EnableWriteCallbackNow(internal->stream);
@@ -1236,17 +1364,12 @@ QStatus _RemoteEndpoint::PushMessage(Message& msg)
      * There are other threads that are blocked trying to send a message to
      * this RemoteEndpoint
      */
-    if (isLeaf) {
-        if ((count < MAX_TX_QUEUE_SIZE) && (internal->txWaitQueue.empty())) {
-            internal->txQueue.push_front(msg);
-            threadWait = false;
-        }
-    } else {
-        if ((internal->numDataMessages < MAX_DATA_MESSAGES) && (internal->txWaitQueue.empty())) {
-            internal->txQueue.push_front(msg);
+    if (internal->TxQueueHasRoom(isLeaf, msg) && internal->txWaitQueue.empty()) {
+        internal->TxQueuePush(msg);
+        if (!isLeaf) {
             internal->numDataMessages++;
-            threadWait = false;
         }
+        threadWait = false;
     }
     if (threadWait) {
         /* This thread will have to wait for room in the queue */
@@ -1265,8 +1388,9 @@ QStatus _RemoteEndpoint::PushMessage(Message& msg)
              */
             uint32_t maxWait = Event::WAIT_FOREVER;
             if (internal->txWaitQueue.back() == thread) {
+                /* Messages at the back of the queue that are being written must stay put */
                 deque<Message>::iterator it = internal->txQueue.begin();
-                while (it != internal->txQueue.end()) {
+                while (it != (internal->txQueue.end() - internal->numWriting)) {
                     uint32_t expMs;
                     if ((*it)->IsExpired(&expMs)) {
                         if (!isLeaf) {
@@ -1278,7 +1402,7 @@ QStatus _RemoteEndpoint::PushMessage(Message& msg)
                                 internal->numDataMessages--;
                             }
                         }
-                        internal->txQueue.erase(it);
+                        internal->TxQueueErase(it);
                         break;
                     } else {
                         ++it;
@@ -1290,14 +1414,13 @@ QStatus _RemoteEndpoint::PushMessage(Message& msg)
                     }
                 }
 
-                if ((isLeaf && (internal->txQueue.size() < MAX_TX_QUEUE_SIZE)) ||
-                    (!isLeaf && (internal->numDataMessages < MAX_DATA_MESSAGES))) {
+                if (internal->TxQueueHasRoom(isLeaf, msg)) {
                     count = internal->txQueue.size();
                     /* Check queue wasn't drained while we were waiting */
                     if (internal->txQueue.size() == 0) {
                         wasEmpty = true;
                     }
-                    internal->txQueue.push_front(msg);
+                    internal->TxQueuePush(msg);
                     if (!isLeaf) {
                         internal->numDataMessages++;
                     }
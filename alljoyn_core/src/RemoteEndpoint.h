@@ -399,6 +399,42 @@ class _RemoteEndpoint : public _BusEndpoint, public qcc::ThreadListener, public
      */
     virtual QStatus SetIdleTimeouts(uint32_t& reqIdleTimeout, uint32_t& reqProbeTimeout);
 
+    /**
+     * Set the transmit queue limits for this endpoint.  By default only one
+     * data message can be queued and messages are written one at a time.
+     *
+     * @param maxMessages   Number of data messages that can be queued before PushMessage() blocks.
+     * @param maxBytes      Number of bytes of data messages that can be queued before PushMessage()
+     *                      blocks or 0 for no byte limit.
+     * @param maxBatch      Maximum number of queued messages that are written to the stream with
+     *                      a single gathered write.
+     */
+    void SetTxQueueLimits(size_t maxMessages, size_t maxBytes, size_t maxBatch);
+
+    /**
+     * Set the size of the receive buffer for this endpoint.  Incoming messages
+     * are read ahead into this buffer with as few reads of the stream as
+     * possible.  Must be called before the endpoint starts reading messages.
+     *
+     * @param size   Size of the receive buffer in bytes or 0 to read each message
+     *               directly from the stream.
+     */
+    void SetRxBufferSize(size_t size);
+
+    /**
+     * Pull bytes of an incoming message from this endpoint.  Bytes are taken
+     * from the receive buffer, which is refilled with everything the stream
+     * has available when it runs empty.  Requests that do not fit in the
+     * receive buffer are read directly from the stream.
+     *
+     * @param buf          Buffer to store pulled bytes
+     * @param reqBytes     Number of bytes requested.
+     * @param actualBytes  [OUT] Actual number of bytes retrieved.
+     * @param timeout      Time to wait for bytes if the receive buffer is empty.
+     * @return   ER_OK if successful, otherwise the status returned by the stream.
+     */
+    QStatus PullBytes(void* buf, size_t reqBytes, size_t& actualBytes, uint32_t timeout);
+
     /**
      * Set the endpoint started state.  Provided for endpoints that do
      * not use the standard sockets and IODispatch mechanism and therefore
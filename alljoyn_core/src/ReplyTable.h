@@ -0,0 +1,372 @@
+#ifndef _ALLJOYN_REPLYTABLE_H
+#define _ALLJOYN_REPLYTABLE_H
+/**
+ * @file
+ * This file defines the containers used to track outstanding method call replies
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#error Only include ReplyTable.h in C++ code.
+#endif
+
+#include <qcc/platform.h>
+
+#include <vector>
+
+#include <qcc/Debug.h>
+
+namespace ajn {
+
+/**
+ * Open-addressing hash table of reply contexts indexed by method call serial
+ * number. Lookups, insertions and removals do not allocate; the slot array
+ * only grows when the table becomes half full.
+ *
+ * Serial numbers are handed out sequentially so a multiplicative hash spreads
+ * them evenly, and linear probing with backward-shift deletion keeps probe
+ * sequences short without needing tombstones.
+ *
+ * The table does not own the contexts it holds. It is not thread safe.
+ */
+template <typename T>
+class ReplyTable {
+  public:
+
+    /**
+     * Constructor
+     */
+    ReplyTable() : slots(MIN_CAPACITY), bits(MIN_CAPACITY_BITS), count(0) { }
+
+    /**
+     * Find the context registered for a serial number.
+     *
+     * @param serial  The method call serial number.
+     *
+     * @return  The context or NULL if there is no context for the serial number.
+     */
+    T* Find(uint32_t serial) const
+    {
+        for (size_t i = Index(serial);; i = Next(i)) {
+            const Slot& slot = slots[i];
+            if (slot.context == NULL) {
+                return NULL;
+            }
+            if (slot.serial == serial) {
+                return slot.context;
+            }
+        }
+    }
+
+    /**
+     * Add a context for a serial number.
+     *
+     * @param serial   The method call serial number.
+     * @param context  The context to add (must not be NULL).
+     *
+     * @return  false if there is already a context for the serial number.
+     */
+    bool Insert(uint32_t serial, T* context)
+    {
+        QCC_ASSERT(context != NULL);
+        if (2 * (count + 1) > slots.size()) {
+            Rehash(2 * slots.size());  /* Keep the load factor at or below 1/2 */
+        }
+        size_t i = Index(serial);
+        while (slots[i].context != NULL) {
+            if (slots[i].serial == serial) {
+                return false;
+            }
+            i = Next(i);
+        }
+        slots[i].serial = serial;
+        slots[i].context = context;
+        ++count;
+        return true;
+    }
+
+    /**
+     * Remove the context for a serial number.
+     *
+     * @param serial  The method call serial number.
+     *
+     * @return  The context that was removed or NULL if there was none.
+     */
+    T* Remove(uint32_t serial)
+    {
+        size_t i = Index(serial);
+        while (slots[i].serial != serial) {
+            if (slots[i].context == NULL) {
+                return NULL;
+            }
+            i = Next(i);
+        }
+        T* context = slots[i].context;
+        if (context == NULL) {
+            return NULL;
+        }
+        /*
+         * Shift back any entries in the probe sequence that follow the removed
+         * slot and whose home slot does not lie between the hole and themselves.
+         */
+        size_t hole = i;
+        for (size_t j = Next(i); slots[j].context != NULL; j = Next(j)) {
+            size_t home = Index(slots[j].serial);
+            if (((j - home) & Mask()) >= ((j - hole) & Mask())) {
+                slots[hole] = slots[j];
+                hole = j;
+            }
+        }
+        slots[hole].context = NULL;
+        --count;
+        return context;
+    }
+
+    /**
+     * Get all the contexts in the table.
+     *
+     * @param[out] contexts  Vector the contexts are appended to.
+     */
+    void GetAll(std::vector<T*>& contexts) const
+    {
+        for (size_t i = 0; i < slots.size(); ++i) {
+            if (slots[i].context != NULL) {
+                contexts.push_back(slots[i].context);
+            }
+        }
+    }
+
+    /**
+     * Remove all the contexts from the table.
+     */
+    void Clear()
+    {
+        slots.assign(MIN_CAPACITY, Slot());
+        bits = MIN_CAPACITY_BITS;
+        count = 0;
+    }
+
+    /**
+     * @return  The number of contexts in the table.
+     */
+    size_t Size() const { return count; }
+
+    /**
+     * @return  true if the table is empty.
+     */
+    bool Empty() const { return count == 0; }
+
+  private:
+
+    static const uint32_t MIN_CAPACITY_BITS = 6;
+    static const size_t MIN_CAPACITY = 1 << MIN_CAPACITY_BITS;  /**< Initial number of slots */
+
+    struct Slot {
+        Slot() : serial(0), context(NULL) { }
+        uint32_t serial;
+        T* context;
+    };
+
+    size_t Mask() const { return slots.size() - 1; }
+
+    size_t Index(uint32_t serial) const
+    {
+        /* Fibonacci hashing, take the high bits of the product */
+        return static_cast<size_t>((serial * 2654435769U) >> (32 - bits));
+    }
+
+    size_t Next(size_t i) const { return (i + 1) & Mask(); }
+
+    void Rehash(size_t capacity)
+    {
+        std::vector<Slot> old(capacity);
+        old.swap(slots);
+        ++bits;
+        count = 0;
+        for (size_t i = 0; i < old.size(); ++i) {
+            if (old[i].context != NULL) {
+                Insert(old[i].serial, old[i].context);
+            }
+        }
+    }
+
+    std::vector<Slot> slots;
+    uint32_t bits;    /**< log2 of the number of slots */
+    size_t count;
+};
+
+/**
+ * Coarse grained timing wheel for method call reply timeouts. Contexts are
+ * dropped into 10 ms buckets by deadline rather than each getting their own
+ * timer alarm. Timeouts are therefore reported up to one bucket late.
+ *
+ * A context type T must provide the following members that are managed by
+ * the wheel:
+ *   - uint64_t deadline     Absolute expiry time in milliseconds (set by the caller)
+ *   - uint32_t timeoutSlot  Bucket holding the context or ReplyTimeoutWheel::NOT_SCHEDULED
+ *   - uint32_t timeoutPos   Position of the context within its bucket
+ *
+ * The wheel does not own the contexts it holds. It is not thread safe.
+ */
+template <typename T>
+class ReplyTimeoutWheel {
+  public:
+
+    static const uint32_t TICK_MS = 10;                 /**< Bucket granularity in milliseconds */
+    static const uint32_t NUM_SLOTS = 1024;             /**< Number of buckets, must be a power of 2 */
+    static const uint32_t NOT_SCHEDULED = 0xFFFFFFFF;   /**< timeoutSlot of a context that is not in the wheel */
+
+    /**
+     * Constructor
+     *
+     * @param now  Current time in milliseconds.
+     */
+    ReplyTimeoutWheel(uint64_t now = 0) : slots(NUM_SLOTS), sweptTick(now / TICK_MS), count(0) { }
+
+    /**
+     * Schedule a context to expire at context->deadline.
+     *
+     * @param context  The context to schedule. Must not already be scheduled.
+     */
+    void Add(T* context)
+    {
+        QCC_ASSERT(context->timeoutSlot == NOT_SCHEDULED);
+        uint64_t tick = (context->deadline + TICK_MS - 1) / TICK_MS;
+        /* Deadlines that have already passed go in the next bucket to be swept */
+        if (tick <= sweptTick) {
+            tick = sweptTick + 1;
+        }
+        uint32_t slot = static_cast<uint32_t>(tick & (NUM_SLOTS - 1));
+        context->timeoutSlot = slot;
+        context->timeoutPos = static_cast<uint32_t>(slots[slot].size());
+        slots[slot].push_back(context);
+        ++count;
+    }
+
+    /**
+     * Unschedule a context.
+     *
+     * @param context  The context to unschedule.
+     *
+     * @return  true if the context was scheduled.
+     */
+    bool Remove(T* context)
+    {
+        if (context->timeoutSlot == NOT_SCHEDULED) {
+            return false;
+        }
+        std::vector<T*>& bucket = slots[context->timeoutSlot];
+        QCC_ASSERT(bucket[context->timeoutPos] == context);
+        T* last = bucket.back();
+        bucket[context->timeoutPos] = last;
+        last->timeoutPos = context->timeoutPos;
+        bucket.pop_back();
+        context->timeoutSlot = NOT_SCHEDULED;
+        --count;
+        return true;
+    }
+
+    /**
+     * Unschedule all the contexts whose deadline has passed.
+     *
+     * @param now            Current time in milliseconds.
+     * @param[out] expired   Vector the expired contexts are appended to.
+     */
+    void Expire(uint64_t now, std::vector<T*>& expired)
+    {
+        uint64_t nowTick = now / TICK_MS;
+        if (count == 0) {
+            if (nowTick > sweptTick) {
+                sweptTick = nowTick;
+            }
+            return;
+        }
+        /* After a full revolution every bucket has been looked at */
+        uint64_t tick = sweptTick + 1;
+        if (nowTick >= tick + NUM_SLOTS) {
+            tick = nowTick - NUM_SLOTS + 1;
+        }
+        for (; tick <= nowTick; ++tick) {
+            std::vector<T*>& bucket = slots[tick & (NUM_SLOTS - 1)];
+            for (size_t i = 0; i < bucket.size();) {
+                T* context = bucket[i];
+                /* Buckets also hold contexts that are due in a later revolution */
+                if (context->deadline <= now) {
+                    Remove(context);
+                    expired.push_back(context);
+                } else {
+                    ++i;
+                }
+            }
+        }
+        if (nowTick > sweptTick) {
+            sweptTick = nowTick;
+        }
+    }
+
+    /**
+     * Get the time the next non-empty bucket is due to be swept. The bucket
+     * may only hold contexts due in a later revolution of the wheel.
+     *
+     * @return  Time in milliseconds or 0 if the wheel is empty.
+     */
+    uint64_t NextSweep() const
+    {
+        if (count == 0) {
+            return 0;
+        }
+        for (uint64_t tick = sweptTick + 1; tick <= sweptTick + NUM_SLOTS; ++tick) {
+            if (!slots[tick & (NUM_SLOTS - 1)].empty()) {
+                return tick * TICK_MS;
+            }
+        }
+        QCC_ASSERT(!"ReplyTimeoutWheel count does not match buckets");
+        return (sweptTick + 1) * TICK_MS;
+    }
+
+    /**
+     * @return  The number of scheduled contexts.
+     */
+    size_t Size() const { return count; }
+
+  private:
+    std::vector<std::vector<T*> > slots;
+    uint64_t sweptTick;   /**< Last tick whose bucket has been swept */
+    size_t count;
+};
+
+template <typename T> const uint32_t ReplyTimeoutWheel<T>::TICK_MS;
+template <typename T> const uint32_t ReplyTimeoutWheel<T>::NUM_SLOTS;
+template <typename T> const uint32_t ReplyTimeoutWheel<T>::NOT_SCHEDULED;
+
+}
+
+#endif
@@ -140,8 +140,101 @@ Rule::Rule(const char* ruleSpec, QStatus* outStatus) : type(MESSAGE_INVALID), se
     }
 }
 
-bool Rule::IsMatch(const Message& msg, std::set<qcc::String>* cachedWhoImplements /* = nullptr */) const
+/* Rules can only reference args 0 through 63 */
+#define MAX_RULE_ARG 64
+
+void ParsedMessage::Parse()
+{
+    state = PARSED;
+    hasImplements = false;
+
+    /*
+     * Clone the message since this message is unmarshalled by the
+     * LocalEndpoint too and the process of unmarshalling is not
+     * thread-safe.
+     */
+    Message clone = Message(msg, true);
+    QStatus status = clone->UnmarshalArgs(clone->GetSignature());
+    if (status != ER_OK) {
+        return;
+    }
+
+    size_t numArgs;
+    const MsgArg* args;
+    clone->GetArgs(numArgs, args);
+    if (numArgs > MAX_RULE_ARG) {
+        numArgs = MAX_RULE_ARG;
+    }
+    stringArgs.resize(numArgs);
+    isStringArg.resize(numArgs, false);
+    for (size_t i = 0; i < numArgs; ++i) {
+        if (ALLJOYN_STRING == args[i].typeId) {
+            stringArgs[i] = args[i].v_string.str;
+            isStringArg[i] = true;
+        }
+    }
+
+    if ((0 != strcmp(msg->GetInterface(), "org.alljoyn.About")) || (0 != strcmp(msg->GetMemberName(), "Announce")) ||
+        (0 != strcmp(clone->GetSignature(), "qqa(oas)a{sv}"))) {
+        return;
+    }
+    size_t numObjectDescriptions;
+    MsgArg* objectDescriptions;
+    status = args[2].Get("a(oas)", &numObjectDescriptions, &objectDescriptions);
+    if (status != ER_OK) {
+        return;
+    }
+    for (size_t ob = 0; ob < numObjectDescriptions; ++ob) {
+        char* objectPath;
+        size_t numIntfs;
+        MsgArg* intfs;
+        status = objectDescriptions[ob].Get("(oas)", &objectPath, &numIntfs, &intfs);
+        if (status != ER_OK) {
+            implements.clear();
+            return;
+        }
+        for (size_t in = 0; in < numIntfs; ++in) {
+            char* intf;
+            status = intfs[in].Get("s", &intf);
+            if (status != ER_OK) {
+                implements.clear();
+                return;
+            }
+            implements.insert(intf);
+        }
+    }
+    hasImplements = true;
+}
+
+const qcc::String* ParsedMessage::GetStringArg(uint32_t index)
+{
+    if (state == NOT_PARSED) {
+        Parse();
+    }
+    if ((index >= isStringArg.size()) || !isStringArg[index]) {
+        return NULL;
+    }
+    return &stringArgs[index];
+}
+
+const std::set<qcc::String>* ParsedMessage::GetImplements()
+{
+    if (state == NOT_PARSED) {
+        Parse();
+    }
+    return hasImplements ? &implements : NULL;
+}
+
+bool Rule::IsMatch(const Message& msg) const
 {
+    ParsedMessage parsed(msg);
+    return IsMatch(parsed);
+}
+
+bool Rule::IsMatch(ParsedMessage& parsed) const
+{
+    const Message& msg = parsed.GetMessage();
+
     /* The fields of a rule (if specified) are logically anded together */
     if ((type != MESSAGE_INVALID) && (type != msg->GetType())) {
         return false;
@@ -161,79 +254,16 @@ bool Rule::IsMatch(const Message& msg, std::set<qcc::String>* cachedWhoImplement
     if (!destination.empty() && (0 != strcmp(destination.c_str(), msg->GetDestination()))) {
         return false;
     }
-    if (!args.empty()) {
-        /*
-         * Clone the message since this message is unmarshalled by the
-         * LocalEndpoint too and the process of unmarshalling is not
-         * thread-safe.
-         */
-        Message clone = Message(msg, true);
-        QStatus status = clone->UnmarshalArgs(clone->GetSignature());
-        if (status != ER_OK) {
+    for (map<uint32_t, String>::const_iterator it = args.begin(); it != args.end(); ++it) {
+        const String* arg = parsed.GetStringArg(it->first);
+        if (!arg || (it->second != *arg)) {
             return false;
         }
-        for (map<uint32_t, String>::const_iterator it = args.begin(); it != args.end(); ++it) {
-            const MsgArg* arg = clone->GetArg(it->first);
-            if (!arg) {
-                return false;
-            }
-            if (ALLJOYN_STRING != arg->typeId) {
-                return false;
-            }
-            if (it->second != arg->v_string.str) {
-                return false;
-            }
-        }
     }
     if (!implements.empty()) {
-        set<String> nonCacheInterfaces;
-        set<String>* interfaces = (cachedWhoImplements == nullptr) ? &nonCacheInterfaces : cachedWhoImplements;
-        /*
-         * Parse the message for the list of interfaces if there's a cache provided OR the cache is still empty.
-         * This is to avoid having to repeatedly call UnmarshalArgs as it is a costly operation.
-         */
-        if ((cachedWhoImplements == nullptr) || (cachedWhoImplements->size() == 0)) {
-            if ((0 != strcmp(msg->GetInterface(), "org.alljoyn.About")) || (0 != strcmp(msg->GetMemberName(), "Announce"))) {
-                return false;
-            }
-            /*
-             * Clone the message since this message is unmarshalled by the
-             * LocalEndpoint too and the process of unmarshalling is not
-             * thread-safe.
-             */
-            Message clone = Message(msg, true);
-            QStatus status = clone->UnmarshalArgs("qqa(oas)a{sv}");
-            if (status != ER_OK) {
-                return false;
-            }
-
-            const MsgArg* arg = clone->GetArg(2);
-            if (!arg) {
-                return false;
-            }
-            size_t numObjectDescriptions;
-            MsgArg* objectDescriptions;
-            status = arg->Get("a(oas)", &numObjectDescriptions, &objectDescriptions);
-            if (status != ER_OK) {
-                return false;
-            }
-            for (size_t ob = 0; ob < numObjectDescriptions; ++ob) {
-                char* objectPath;
-                size_t numIntfs;
-                MsgArg* intfs;
-                status = objectDescriptions[ob].Get("(oas)", &objectPath, &numIntfs, &intfs);
-                if (status != ER_OK) {
-                    return false;
-                }
-                for (size_t in = 0; in < numIntfs; ++in) {
-                    char* intf;
-                    status = intfs[in].Get("s", &intf);
-                    if (status != ER_OK) {
-                        return false;
-                    }
-                    interfaces->insert(intf);
-                }
-            }
+        const set<String>* interfaces = parsed.GetImplements();
+        if (!interfaces) {
+            return false;
         }
         /*
          * Compare 'implements' interfaces against the message.
@@ -38,6 +38,7 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include <qcc/String.h>
 #include <alljoyn/Message.h>
@@ -45,6 +46,63 @@
 
 namespace ajn {
 
+/**
+ * ParsedMessage is a lazily parsed view of a message that is shared by all of
+ * the rules a message is matched against during a single routing pass.
+ *
+ * The message args are unmarshalled at most once, the first time a rule with
+ * argN or implements constraints needs them, and only the top-level string
+ * args and the interfaces of an org.alljoyn.About.Announce signal are kept.
+ * A ParsedMessage is not thread-safe; callers that share one must serialize
+ * access to it.
+ */
+class ParsedMessage {
+  public:
+
+    /**
+     * Constructor
+     *
+     * @param msg   Message to be matched against rules.
+     */
+    ParsedMessage(const Message& msg) : msg(msg), state(NOT_PARSED), hasImplements(false) { }
+
+    /**
+     * Get the message this view was created from.
+     *
+     * @return  The message.
+     */
+    const Message& GetMessage() const { return msg; }
+
+    /**
+     * Get a string arg of the message.
+     *
+     * @param index   Index of the arg.
+     *
+     * @return  The value of the arg or NULL if the arg does not exist, is not a
+     *          string, or the message args could not be unmarshalled.
+     */
+    const qcc::String* GetStringArg(uint32_t index);
+
+    /**
+     * Get the interfaces implemented in an org.alljoyn.About.Announce signal.
+     *
+     * @return  The interfaces or NULL if the message is not a well-formed
+     *          Announce signal.
+     */
+    const std::set<qcc::String>* GetImplements();
+
+  private:
+
+    void Parse();
+
+    Message msg;
+    enum { NOT_PARSED, PARSED } state;
+    std::vector<qcc::String> stringArgs;        /**< Top-level string args, indexed by arg number */
+    std::vector<bool> isStringArg;              /**< true iff the corresponding arg is a string */
+    bool hasImplements;                         /**< true iff implements holds the Announce interfaces */
+    std::set<qcc::String> implements;           /**< Interfaces implemented in an Announce signal */
+};
+
 /**
  * Rule defines a message bus routing rule.
  */
@@ -103,12 +161,20 @@ struct Rule {
      * Return true if messages matches rule.
      *
      * @param msg   Message to compare with rule.
-     * @param cachedWhoImplements   Optional in/out collection of who-implements interfaces
-     *                              cached from 'msg' param. If provided, the interfaces
-     *                              found in the message will be populated.
      * @return      true if this rule matches the message.
      */
-    bool IsMatch(const Message& msg, std::set<qcc::String>* cachedWhoImplements = nullptr) const;
+    bool IsMatch(const Message& msg) const;
+
+    /**
+     * Return true if messages matches rule.
+     *
+     * Use this variant when matching the same message against several rules
+     * so that the message args are only unmarshalled once.
+     *
+     * @param parsed   Parsed view of the message to compare with rule.
+     * @return         true if this rule matches the message.
+     */
+    bool IsMatch(ParsedMessage& parsed) const;
 
     /**
      * String representation of a rule
@@ -37,6 +37,7 @@
 #include <qcc/LockLevel.h>
 #include <alljoyn/Init.h>
 #include <alljoyn/PasswordManager.h>
+#include "AllJoynCrypto.h"
 #include "AutoPingerInternal.h"
 #include "BusInternal.h"
 #include "KeyStoreListener.h"
@@ -61,6 +62,7 @@ class StaticGlobals {
     static void Init()
     {
         ProtectedAuthListener::Init();
+        Crypto::Init();
         KeyStore::Init();
         NamedPipeClientTransport::Init();
         AutoPingerInternal::Init();
@@ -89,6 +91,7 @@ class StaticGlobals {
         AutoPingerInternal::Shutdown();
         NamedPipeClientTransport::Shutdown();
         KeyStore::Shutdown();
+        Crypto::Shutdown();
         ProtectedAuthListener::Shutdown();
     }
 };
@@ -156,6 +156,18 @@ class MyMessage : public _Message {
     {
         return _Message::Deliver(ep);
     }
+
+    static QStatus DeliverNonBlocking(RemoteEndpoint& ep, const Message& msg)
+    {
+        _Message::WriteCursor cursor(msg);
+        QStatus status = _Message::DeliverNonBlocking(ep, cursor);
+        if ((status == ER_OK) && !cursor.IsComplete()) {
+            status = ER_FAIL;
+        }
+        return status;
+    }
+
+    void SetSerialNumber(uint32_t serialNumber) { _Message::SetSerialNumber(serialNumber); }
 };
 
 
@@ -361,6 +373,112 @@ TEST(MarshalTest, ReplayProtection) {
     delete bus;
 }
 
+static uint32_t GetWireSerial(const uint8_t* buf)
+{
+    uint32_t serial;
+    /* The serial number follows the endian, type, flags, version and body length */
+    memcpy(&serial, buf + 8, sizeof(serial));
+    return (buf[0] == ALLJOYN_LITTLE_ENDIAN) ? letoh32(serial) : betoh32(serial);
+}
+
+TEST(MarshalTest, DeliverSharedMessage) {
+    QStatus status = ER_OK;
+
+    BusAttachment* bus = new BusAttachment("DeliverSharedMessage", false);
+    bus->Start();
+
+    ManagedObj<MyMessage> myMsg(*bus);
+    MsgArg args[2];
+    size_t numArgs = ArraySize(args);
+    MsgArg::Set(args, numArgs, "us", 4, "hello");
+    status = myMsg->Signal("a.b.c", "/foo/bar", "foo.bar", "test", args, numArgs);
+    ASSERT_EQ(ER_OK, status);
+    Message msg = Message::cast(myMsg);
+
+    static const bool falsiness = false;
+    TestPipe streams[3];
+    RemoteEndpoint eps[3];
+    for (size_t i = 0; i < ArraySize(streams); ++i) {
+        TestPipe* pStream = &streams[i];
+        eps[i] = RemoteEndpoint(*bus, falsiness, pStream);
+    }
+
+    /* Deliver the message to two endpoints and a modified copy of it to a third one */
+    status = MyMessage::DeliverNonBlocking(eps[0], msg);
+    ASSERT_EQ(ER_OK, status);
+
+    ManagedObj<MyMessage> copy(*myMsg);
+    copy->SetSerialNumber(msg->GetCallSerial() + 1);
+
+    status = MyMessage::DeliverNonBlocking(eps[1], msg);
+    ASSERT_EQ(ER_OK, status);
+
+    status = MyMessage::DeliverNonBlocking(eps[2], Message::cast(copy));
+    ASSERT_EQ(ER_OK, status);
+
+    uint8_t bufs[3][256];
+    size_t lens[3];
+    for (size_t i = 0; i < ArraySize(streams); ++i) {
+        status = streams[i].PullBytes(bufs[i], sizeof(bufs[i]), lens[i]);
+        ASSERT_EQ(ER_OK, status);
+    }
+    ASSERT_EQ(lens[0], lens[1]);
+    ASSERT_EQ(lens[0], lens[2]);
+    EXPECT_EQ(0, memcmp(bufs[0], bufs[1], lens[0]));
+    EXPECT_EQ(msg->GetCallSerial(), GetWireSerial(bufs[0]));
+    EXPECT_EQ(msg->GetCallSerial() + 1, GetWireSerial(bufs[2]));
+
+    delete bus;
+}
+
+
+TEST(MarshalTest, ReadBufferedMessages) {
+    QStatus status = ER_OK;
+
+    BusAttachment* bus = new BusAttachment("ReadBufferedMessages", false);
+    bus->Start();
+
+    TestPipe stream;
+    TestPipe* pStream = &stream;
+    static const bool falsiness = false;
+    RemoteEndpoint ep(*bus, falsiness, pStream);
+    ep->SetRxBufferSize(256);
+
+    /* Several small messages with one that is bigger than the receive buffer in the middle */
+    static const uint32_t numMsgs = 8;
+    static const uint32_t bigMsg = 4;
+    qcc::String bigString(1000, 'x');
+    for (uint32_t n = 0; n < numMsgs; ++n) {
+        MyMessage msg(*bus);
+        MsgArg args[2];
+        size_t numArgs = ArraySize(args);
+        MsgArg::Set(args, numArgs, "us", n, (n == bigMsg) ? bigString.c_str() : "hello");
+        status = msg.Signal("a.b.c", "/foo/bar", "foo.bar", "test", args, numArgs);
+        ASSERT_EQ(ER_OK, status);
+        status = msg.Deliver(ep);
+        ASSERT_EQ(ER_OK, status);
+    }
+
+    for (uint32_t n = 0; n < numMsgs; ++n) {
+        MyMessage msg(*bus);
+        status = msg.Read(ep, ":88.88");
+        ASSERT_EQ(ER_OK, status);
+        status = msg.Unmarshal(ep, ":88.88");
+        ASSERT_EQ(ER_OK, status);
+        status = msg.UnmarshalBody();
+        ASSERT_EQ(ER_OK, status);
+
+        uint32_t u;
+        const char* s;
+        status = msg.GetArgs("us", &u, &s);
+        ASSERT_EQ(ER_OK, status);
+        EXPECT_EQ(n, u);
+        EXPECT_STREQ((n == bigMsg) ? bigString.c_str() : "hello", s);
+    }
+
+    delete bus;
+}
+
 
 /*--------------------------FUZZING TEST CODE---------------------------------*/
 static bool fuzzing = false;
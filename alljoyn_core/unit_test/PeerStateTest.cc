@@ -0,0 +1,135 @@
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <qcc/platform.h>
+
+#include <memory>
+
+#include <qcc/Crypto.h>
+#include <qcc/KeyBlob.h>
+
+#include "PeerState.h"
+
+/* Header files included for Google Test Framework */
+#include <gtest/gtest.h>
+#include "ajTestCommon.h"
+
+using namespace std;
+using namespace qcc;
+using namespace ajn;
+
+TEST(PeerStateTest, CipherCachedPerKey)
+{
+    PeerState peerState;
+    KeyBlob key;
+    shared_ptr<Crypto_AES> cipher;
+
+    EXPECT_EQ(ER_BUS_KEY_UNAVAILABLE, peerState->GetKey(key, PEER_SESSION_KEY, cipher));
+    EXPECT_FALSE(cipher);
+
+    uint8_t keyData[Crypto_AES::AES128_SIZE] = { 0x11 };
+    peerState->SetKey(KeyBlob(keyData, sizeof(keyData), KeyBlob::AES), PEER_SESSION_KEY);
+    ASSERT_EQ(ER_OK, peerState->GetKey(key, PEER_SESSION_KEY, cipher));
+    ASSERT_TRUE(cipher);
+
+    shared_ptr<Crypto_AES> again;
+    ASSERT_EQ(ER_OK, peerState->GetKey(key, PEER_SESSION_KEY, again));
+    EXPECT_EQ(cipher, again);
+
+    /* A rekey must not hand out the context expanded from the old key */
+    keyData[0] = 0x22;
+    peerState->SetKey(KeyBlob(keyData, sizeof(keyData), KeyBlob::AES), PEER_SESSION_KEY);
+    ASSERT_EQ(ER_OK, peerState->GetKey(key, PEER_SESSION_KEY, again));
+    ASSERT_TRUE(again);
+    EXPECT_NE(cipher, again);
+
+    peerState->ClearKeys();
+    EXPECT_EQ(ER_BUS_KEY_UNAVAILABLE, peerState->GetKey(key, PEER_SESSION_KEY, again));
+    EXPECT_FALSE(again);
+}
+
+TEST(PeerStateTest, CachedCipherMatchesFreshCipher)
+{
+    PeerState peerState;
+    uint8_t keyData[Crypto_AES::AES128_SIZE] = { 0x5a, 0xa5 };
+    KeyBlob key(keyData, sizeof(keyData), KeyBlob::AES);
+    peerState->SetKey(key, PEER_SESSION_KEY);
+
+    KeyBlob sessionKey;
+    shared_ptr<Crypto_AES> cipher;
+    ASSERT_EQ(ER_OK, peerState->GetKey(sessionKey, PEER_SESSION_KEY, cipher));
+    ASSERT_TRUE(cipher);
+
+    uint8_t nonceData[13] = { 1, 2, 3, 4, 5 };
+    KeyBlob nonce(nonceData, sizeof(nonceData), KeyBlob::GENERIC);
+    const uint8_t hdr[16] = { 0x6c, 0x01 };
+    uint8_t cached[32 + 16] = { 0x42 };
+    uint8_t fresh[32 + 16] = { 0x42 };
+
+    for (int i = 0; i < 2; ++i) {
+        size_t cachedLen = 32;
+        size_t freshLen = 32;
+        ASSERT_EQ(ER_OK, cipher->Encrypt_CCM(cached, cached, cachedLen, nonce, hdr, sizeof(hdr), 16));
+        Crypto_AES aes(key, Crypto_AES::CCM);
+        ASSERT_EQ(ER_OK, aes.Encrypt_CCM(fresh, fresh, freshLen, nonce, hdr, sizeof(hdr), 16));
+        ASSERT_EQ(freshLen, cachedLen);
+        EXPECT_EQ(0, memcmp(cached, fresh, cachedLen));
+    }
+}
+
+TEST(PeerStateTest, AuthorizationCacheInvalidation)
+{
+    PeerState peerState;
+    const string request("/obj\0org.example\0Ping\0", 22);
+    bool authorized = false;
+    uint32_t epoch;
+
+    EXPECT_FALSE(peerState->GetCachedAuthorization(request, 1, authorized, epoch));
+    peerState->CacheAuthorization(request, 1, epoch, true);
+    ASSERT_TRUE(peerState->GetCachedAuthorization(request, 1, authorized, epoch));
+    EXPECT_TRUE(authorized);
+
+    /* A new policy generation does not see the old decision */
+    EXPECT_FALSE(peerState->GetCachedAuthorization(request, 2, authorized, epoch));
+
+    /* A decision evaluated across a clear is discarded */
+    peerState->ClearAuthorizationCache();
+    EXPECT_FALSE(peerState->GetCachedAuthorization(request, 1, authorized, epoch));
+    peerState->ClearAuthorizationCache();
+    peerState->CacheAuthorization(request, 1, epoch, false);
+    EXPECT_FALSE(peerState->GetCachedAuthorization(request, 1, authorized, epoch));
+
+    /* A new key clears the cache */
+    peerState->CacheAuthorization(request, 1, epoch, false);
+    ASSERT_TRUE(peerState->GetCachedAuthorization(request, 1, authorized, epoch));
+    EXPECT_FALSE(authorized);
+    uint8_t keyData[Crypto_AES::AES128_SIZE] = { 0x11 };
+    KeyBlob key(keyData, sizeof(keyData), KeyBlob::AES);
+    peerState->SetKey(key, PEER_SESSION_KEY);
+    EXPECT_FALSE(peerState->GetCachedAuthorization(request, 1, authorized, epoch));
+}
@@ -0,0 +1,146 @@
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <qcc/platform.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "ReplyTable.h"
+
+/* Header files included for Google Test Framework */
+#include <gtest/gtest.h>
+#include "ajTestCommon.h"
+
+using namespace std;
+using namespace ajn;
+
+namespace {
+
+struct TestContext {
+    TestContext(uint32_t serial = 0, uint64_t deadline = 0) :
+        serial(serial), deadline(deadline), timeoutSlot(ReplyTimeoutWheel<TestContext>::NOT_SCHEDULED), timeoutPos(0) { }
+
+    uint32_t serial;
+    uint64_t deadline;
+    uint32_t timeoutSlot;
+    uint32_t timeoutPos;
+};
+
+typedef ReplyTimeoutWheel<TestContext> TestWheel;
+
+}
+
+TEST(ReplyTableTest, InsertFindRemove)
+{
+    const uint32_t count = 5000;
+    vector<TestContext> contexts(count);
+    ReplyTable<TestContext> table;
+
+    /* Serial numbers wrap around and skip 0 */
+    for (uint32_t i = 0; i < count; ++i) {
+        contexts[i].serial = 0xFFFFF000 + i * 3;
+        if (contexts[i].serial == 0) {
+            contexts[i].serial = 1;
+        }
+        EXPECT_TRUE(table.Insert(contexts[i].serial, &contexts[i]));
+    }
+    EXPECT_EQ(count, table.Size());
+    EXPECT_FALSE(table.Insert(contexts[7].serial, &contexts[8]));
+    EXPECT_EQ(count, table.Size());
+
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_EQ(&contexts[i], table.Find(contexts[i].serial));
+    }
+    EXPECT_TRUE(table.Find(0xFFFFF001) == NULL);
+
+    /* Remove every other entry, the rest must still be reachable */
+    for (uint32_t i = 0; i < count; i += 2) {
+        EXPECT_EQ(&contexts[i], table.Remove(contexts[i].serial));
+    }
+    EXPECT_TRUE(table.Remove(contexts[0].serial) == NULL);
+    EXPECT_EQ(count / 2, table.Size());
+    for (uint32_t i = 0; i < count; ++i) {
+        EXPECT_EQ((i & 1) ? &contexts[i] : NULL, table.Find(contexts[i].serial));
+    }
+
+    vector<TestContext*> all;
+    table.GetAll(all);
+    EXPECT_EQ(count / 2, all.size());
+
+    table.Clear();
+    EXPECT_TRUE(table.Empty());
+    EXPECT_TRUE(table.Find(contexts[1].serial) == NULL);
+}
+
+TEST(ReplyTableTest, TimeoutWheelExpire)
+{
+    const uint64_t start = 1000000;
+    TestWheel wheel(start);
+    TestContext soon(1, start + 25);
+    TestContext later(2, start + 300);
+    TestContext nextRevolution(3, start + 25 + TestWheel::TICK_MS * TestWheel::NUM_SLOTS);
+    TestContext removed(4, start + 30);
+    TestContext overdue(5, start - 500);
+
+    wheel.Add(&soon);
+    wheel.Add(&later);
+    wheel.Add(&nextRevolution);
+    wheel.Add(&removed);
+    EXPECT_EQ(4U, wheel.Size());
+    EXPECT_EQ(start + 30, wheel.NextSweep());
+
+    EXPECT_TRUE(wheel.Remove(&removed));
+    EXPECT_FALSE(wheel.Remove(&removed));
+
+    vector<TestContext*> expired;
+    wheel.Expire(start + 20, expired);
+    EXPECT_TRUE(expired.empty());
+
+    /* Deadlines that have already passed go in the next bucket */
+    wheel.Add(&overdue);
+    wheel.Expire(start + 30, expired);
+    ASSERT_EQ(2U, expired.size());
+    EXPECT_NE(expired.end(), find(expired.begin(), expired.end(), &soon));
+    EXPECT_NE(expired.end(), find(expired.begin(), expired.end(), &overdue));
+    EXPECT_EQ(TestWheel::NOT_SCHEDULED, soon.timeoutSlot);
+
+    /* Sweeping the bucket of the next revolution early must not expire it */
+    expired.clear();
+    wheel.Expire(start + 300, expired);
+    ASSERT_EQ(1U, expired.size());
+    EXPECT_EQ(&later, expired[0]);
+    EXPECT_EQ(1U, wheel.Size());
+
+    expired.clear();
+    wheel.Expire(start + 300 + TestWheel::TICK_MS * TestWheel::NUM_SLOTS, expired);
+    ASSERT_EQ(1U, expired.size());
+    EXPECT_EQ(&nextRevolution, expired[0]);
+    EXPECT_EQ(0U, wheel.Size());
+    EXPECT_EQ(0U, wheel.NextSweep());
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <qcc/platform.h>
+
+#include <set>
+
+#include <qcc/String.h>
+#include <qcc/Util.h>
+
+#include "BusUtil.h"
+#include "NameMatcher.h"
+
+/* Header files included for Google Test Framework */
+#include <gtest/gtest.h>
+#include "../ajTestCommon.h"
+
+using namespace std;
+using namespace qcc;
+using namespace ajn;
+
+static const char* names[] = {
+    "org.alljoyn.Bus",
+    "org.alljoyn.BusNode",
+    "org.alljoyn.About",
+    "org.alljoyn.sample.chat",
+    "org.alljoyn.sample.chat.room1",
+    "com.example.a",
+    "com.example.ab",
+    "com.example.ba",
+    "a",
+    "ab",
+    "abc"
+};
+
+static const char* patterns[] = {
+    "*",
+    "org.*",
+    "org.alljoyn.Bus*",
+    "org.alljoyn.Bus",
+    "org.alljoyn.Bus?",
+    "org.alljoyn.Bus????",
+    "org.alljoyn.*.chat",
+    "org.alljoyn.*.chat*",
+    "org.alljoyn.*.*",
+    "org.alljoyn.*?",
+    "*.a",
+    "*b",
+    "com.example.?",
+    "com.example.?b",
+    "a*c",
+    "a*",
+    "ab*c",
+    "?",
+    "??",
+    "abc*",
+    "x*"
+};
+
+/* The matcher must agree with WildcardMatch() for every name and pattern */
+TEST(NameMatcherTest, MatchPatternAgreesWithWildcardMatch)
+{
+    NameMatcher matcher;
+    for (size_t i = 0; i < ArraySize(names); ++i) {
+        matcher.Add(names[i]);
+    }
+    for (size_t p = 0; p < ArraySize(patterns); ++p) {
+        set<String> expected;
+        for (size_t i = 0; i < ArraySize(names); ++i) {
+            if (!WildcardMatch(names[i], patterns[p])) {
+                expected.insert(names[i]);
+            }
+        }
+        set<String> matches;
+        matcher.MatchPattern(patterns[p], matches);
+        EXPECT_EQ(expected, matches) << "pattern " << patterns[p];
+        EXPECT_EQ(!expected.empty(), matcher.AnyMatchPattern(patterns[p])) << "pattern " << patterns[p];
+    }
+}
+
+TEST(NameMatcherTest, MatchNameAgreesWithWildcardMatch)
+{
+    NameMatcher matcher;
+    for (size_t p = 0; p < ArraySize(patterns); ++p) {
+        matcher.Add(patterns[p]);
+    }
+    for (size_t i = 0; i < ArraySize(names); ++i) {
+        set<String> expected;
+        for (size_t p = 0; p < ArraySize(patterns); ++p) {
+            if (!WildcardMatch(names[i], patterns[p])) {
+                expected.insert(patterns[p]);
+            }
+        }
+        set<String> matches;
+        matcher.MatchName(names[i], matches);
+        EXPECT_EQ(expected, matches) << "name " << names[i];
+    }
+}
+
+TEST(NameMatcherTest, RemoveDropsReferences)
+{
+    NameMatcher matcher;
+    EXPECT_TRUE(matcher.Empty());
+    matcher.Add("org.alljoyn.Bus");
+    matcher.Add("org.alljoyn.Bus");
+    matcher.Add("org.alljoyn.BusNode");
+
+    matcher.Remove("org.alljoyn.Bus");
+    EXPECT_TRUE(matcher.AnyMatchPattern("org.alljoyn.Bus"));
+    matcher.Remove("org.alljoyn.Bus");
+    EXPECT_FALSE(matcher.AnyMatchPattern("org.alljoyn.Bus"));
+    EXPECT_TRUE(matcher.AnyMatchPattern("org.alljoyn.BusNode"));
+
+    /* Removing something that was never added is harmless */
+    matcher.Remove("org.alljoyn");
+    matcher.Remove("org.alljoyn.BusNodes");
+    EXPECT_TRUE(matcher.AnyMatchPattern("org.alljoyn.BusNode"));
+
+    matcher.Remove("org.alljoyn.BusNode");
+    EXPECT_TRUE(matcher.Empty());
+
+    matcher.Add("org.alljoyn.About");
+    matcher.Clear();
+    EXPECT_TRUE(matcher.Empty());
+    EXPECT_FALSE(matcher.AnyMatchPattern("*"));
+}
@@ -0,0 +1,216 @@
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <qcc/platform.h>
+
+#include <set>
+#include <vector>
+
+#include <qcc/StringUtil.h>
+#include <qcc/Util.h>
+#include <alljoyn/Message.h>
+
+#include "BusEndpoint.h"
+#include "RuleTable.h"
+
+/* Header files included for Google Test Framework */
+#include <gtest/gtest.h>
+#include "../ajTestCommon.h"
+
+using namespace std;
+using namespace qcc;
+using namespace ajn;
+
+namespace {
+
+class _RuleTableTestEndpoint : public _BusEndpoint {
+  public:
+    _RuleTableTestEndpoint(const String& name) : _BusEndpoint(ENDPOINT_TYPE_NULL), name(name) { }
+    const String& GetUniqueName() const { return name; }
+  private:
+    String name;
+};
+typedef ManagedObj<_RuleTableTestEndpoint> RuleTableTestEndpoint;
+
+class _RuleTableTestMessage : public _Message {
+  public:
+    _RuleTableTestMessage(BusAttachment& bus, const char* sender, const char* path, const char* iface,
+                          const char* member, const char* arg0, uint8_t flags) : _Message(bus)
+    {
+        MsgArg arg("s", arg0);
+        SignalMsg("s", sender, NULL, 0, path, iface, member, &arg, 1, flags, 0);
+    }
+};
+typedef ManagedObj<_RuleTableTestMessage> RuleTableTestMessage;
+
+const char* testRules[] = {
+    "type='signal'",
+    "type='method_call'",
+    "type='signal',interface='org.test.A'",
+    "type='signal',interface='org.test.A',member='Foo'",
+    "type='signal',interface='org.test.B',member='Bar'",
+    "type='signal',member='Foo'",
+    "type='signal',path='/a'",
+    "type='signal',sender=':sender.1'",
+    "interface='org.test.B'",
+    "type='signal',interface='org.test.A',arg0='x'",
+    "type='signal',interface='org.test.A',sessionless='t'",
+    "type='signal',sessionless='t'",
+    "type='signal',interface='org.test.B',sessionless='f'",
+};
+
+const char* senders[] = { ":sender.1", ":sender.2" };
+const char* paths[] = { "/a", "/b" };
+const char* ifaces[] = { "org.test.A", "org.test.B", "org.test.C" };
+const char* members[] = { "Foo", "Bar" };
+const char* arg0s[] = { "x", "y" };
+const uint8_t flags[] = { 0, ALLJOYN_FLAG_SESSIONLESS };
+
+}
+
+class RuleTableTest : public testing::Test {
+  public:
+    RuleTableTest() : bus("RuleTableTest") { }
+
+    virtual void SetUp()
+    {
+        /* The bus must be started for the arg rules to unmarshal the test messages */
+        ASSERT_EQ(ER_OK, bus.Start());
+
+        /*
+         * Give each endpoint a different combination of rules, some with more
+         * than one rule filed under the same index key.
+         */
+        for (uint32_t i = 0; i < 64; ++i) {
+            String name = ":ep." + U32ToString(i);
+            RuleTableTestEndpoint tep(name);
+            BusEndpoint ep = BusEndpoint::cast(tep);
+            eps.push_back(ep);
+            for (size_t r = 0; r < ArraySize(testRules); ++r) {
+                if (((i + 1) * (r + 3)) % 5 < 2) {
+                    ruleTable.AddRule(ep, Rule(testRules[r]));
+                }
+            }
+        }
+    }
+
+    /* Check that the rule index gives the same answer as the linear scan for all test messages. */
+    void CheckAllMessages()
+    {
+        for (size_t s = 0; s < ArraySize(senders); ++s) {
+            for (size_t p = 0; p < ArraySize(paths); ++p) {
+                for (size_t i = 0; i < ArraySize(ifaces); ++i) {
+                    for (size_t m = 0; m < ArraySize(members); ++m) {
+                        for (size_t a = 0; a < ArraySize(arg0s); ++a) {
+                            for (size_t f = 0; f < ArraySize(flags); ++f) {
+                                RuleTableTestMessage tmsg(bus, senders[s], paths[p], ifaces[i], members[m], arg0s[a], flags[f]);
+                                Message msg = Message::cast(tmsg);
+                                set<BusEndpoint> expected;
+                                for (vector<BusEndpoint>::iterator it = eps.begin(); it != eps.end(); ++it) {
+                                    if (ruleTable.OkToSend(msg, *it)) {
+                                        expected.insert(*it);
+                                    }
+                                }
+                                set<BusEndpoint> actual;
+                                ruleTable.GetMatchingEndpoints(msg, actual);
+                                EXPECT_EQ(expected.size(), actual.size()) << msg->ToString();
+                                EXPECT_TRUE(expected == actual) << msg->ToString();
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    BusAttachment bus;
+    RuleTable ruleTable;
+    vector<BusEndpoint> eps;
+};
+
+TEST_F(RuleTableTest, IndexMatchesLinearScan)
+{
+    CheckAllMessages();
+}
+
+TEST_F(RuleTableTest, IndexMatchesLinearScanAfterRemoveRule)
+{
+    for (size_t i = 0; i < eps.size(); i += 3) {
+        for (size_t r = 0; r < ArraySize(testRules); r += 2) {
+            Rule rule(testRules[r]);
+            ruleTable.RemoveRule(eps[i], rule);
+        }
+    }
+    CheckAllMessages();
+}
+
+TEST_F(RuleTableTest, IndexMatchesLinearScanAfterRemoveAllRules)
+{
+    for (size_t i = 0; i < eps.size(); i += 2) {
+        ruleTable.RemoveAllRules(eps[i]);
+    }
+    CheckAllMessages();
+
+    for (size_t i = 1; i < eps.size(); i += 2) {
+        ruleTable.RemoveAllRules(eps[i]);
+    }
+    uint8_t noFlags = 0;
+    RuleTableTestMessage tmsg(bus, senders[0], paths[0], ifaces[0], members[0], arg0s[0], noFlags);
+    Message msg = Message::cast(tmsg);
+    set<BusEndpoint> actual;
+    ruleTable.GetMatchingEndpoints(msg, actual);
+    EXPECT_TRUE(actual.empty());
+}
+
+TEST(RuleTest, ParsedMessageMatchesArgRules)
+{
+    BusAttachment bus("RuleTest");
+    ASSERT_EQ(ER_OK, bus.Start());
+    uint8_t noFlags = 0;
+    RuleTableTestMessage tmsg(bus, senders[0], paths[0], ifaces[0], members[0], arg0s[0], noFlags);
+    Message msg = Message::cast(tmsg);
+
+    ParsedMessage parsed(msg);
+    ASSERT_TRUE(parsed.GetStringArg(0) != NULL);
+    EXPECT_STREQ(arg0s[0], parsed.GetStringArg(0)->c_str());
+    EXPECT_TRUE(parsed.GetStringArg(1) == NULL);
+    EXPECT_TRUE(parsed.GetImplements() == NULL);
+
+    const char* matchRules[] = { "arg0='x'", "type='signal',arg0='x'", "interface='org.test.A',arg0='x'" };
+    for (size_t r = 0; r < ArraySize(matchRules); ++r) {
+        Rule rule(matchRules[r]);
+        EXPECT_TRUE(rule.IsMatch(parsed)) << matchRules[r];
+        EXPECT_TRUE(rule.IsMatch(msg)) << matchRules[r];
+    }
+    const char* noMatchRules[] = { "arg0='y'", "arg1='x'", "arg0='x',arg1=''", "implements='org.test.A'" };
+    for (size_t r = 0; r < ArraySize(noMatchRules); ++r) {
+        Rule rule(noMatchRules[r]);
+        EXPECT_FALSE(rule.IsMatch(parsed)) << noMatchRules[r];
+        EXPECT_FALSE(rule.IsMatch(msg)) << noMatchRules[r];
+    }
+}
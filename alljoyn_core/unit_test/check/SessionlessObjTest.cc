@@ -110,6 +110,56 @@ INSTANTIATE_TEST_CASE_P(SessionlessBackoff, SessionlessBackoffAlgorithmTest,
                                           SessionlessObj::BackoffLimits(1500, 5, 32, 120),
                                           SessionlessObj::BackoffLimits(1500, 2, 16, 120)));
 
+TEST(SessionlessChangeIdRangeTest, GetChangeIdRange)
+{
+    SessionlessObj::ChangeIdIndex index;
+    index.insert(std::pair<uint32_t, String>(0, "a"));
+    index.insert(std::pair<uint32_t, String>(5, "c"));
+    index.insert(std::pair<uint32_t, String>(5, "b"));
+    index.insert(std::pair<uint32_t, String>(7, "d"));
+    index.insert(std::pair<uint32_t, String>(numeric_limits<uint32_t>::max(), "e"));
+
+    vector<String> keys;
+    SessionlessObj::GetChangeIdRange(index, 5, 7, keys);
+    ASSERT_EQ(2U, keys.size());
+    EXPECT_EQ(String("b"), keys[0]);
+    EXPECT_EQ(String("c"), keys[1]);
+
+    /* Empty range */
+    keys.clear();
+    SessionlessObj::GetChangeIdRange(index, 5, 5, keys);
+    EXPECT_TRUE(keys.empty());
+
+    /* Range that wraps around */
+    keys.clear();
+    SessionlessObj::GetChangeIdRange(index, 6, 1, keys);
+    ASSERT_EQ(3U, keys.size());
+    EXPECT_EQ(String("d"), keys[0]);
+    EXPECT_EQ(String("e"), keys[1]);
+    EXPECT_EQ(String("a"), keys[2]);
+}
+
+TEST(SessionlessRoutedMessagesTest, Insert)
+{
+    SessionlessObj::RoutedMessages routed(3);
+    EXPECT_TRUE(routed.Insert(":a.1", 1));
+    EXPECT_TRUE(routed.Insert(":a.1", 2));
+    EXPECT_TRUE(routed.Insert(":b.1", 1));
+    EXPECT_FALSE(routed.Insert(":a.1", 1));
+    EXPECT_FALSE(routed.Insert(":b.1", 1));
+    EXPECT_EQ(3U, routed.Size());
+
+    /* The oldest message is forgotten once the limit is reached */
+    EXPECT_TRUE(routed.Insert(":b.1", 2));
+    EXPECT_EQ(3U, routed.Size());
+    EXPECT_TRUE(routed.Insert(":a.1", 1));
+    EXPECT_FALSE(routed.Insert(":b.1", 2));
+
+    routed.Clear();
+    EXPECT_EQ(0U, routed.Size());
+    EXPECT_TRUE(routed.Insert(":b.1", 2));
+}
+
 #if GTEST_HAS_COMBINE
 
 typedef::testing::TestWithParam<tuple<bool, bool, bool, bool, bool> > TestParamTuple;
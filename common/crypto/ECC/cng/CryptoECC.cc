@@ -1250,6 +1250,25 @@ Exit:
     return status;
 }
 
+QStatus Crypto_ECC::DSAVerifyDigestBatch(DSAVerifyEntry* entries, size_t count)
+{
+    QStatus status = ER_OK;
+
+    QCC_DbgTrace(("Crypto_ECC::DSAVerifyDigestBatch"));
+
+    /* CNG has no batch verification, verify the signatures one at a time. */
+    for (size_t i = 0; i < count; i++) {
+        Crypto_ECC ecc;
+        ecc.SetDSAPublicKey(entries[i].publicKey);
+        entries[i].status = ecc.DSAVerifyDigest(entries[i].digest, entries[i].len, entries[i].sig);
+        if (ER_OK != entries[i].status) {
+            status = ER_FAIL;
+        }
+    }
+
+    return status;
+}
+
 QStatus Crypto_ECC::DSAVerify(const uint8_t* buf, uint16_t len, const ECCSignature* sig)
 {
     Crypto_SHA256 hash;
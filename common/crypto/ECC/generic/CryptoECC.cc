@@ -243,7 +243,7 @@ static verify_res_t ECDSA_verify_inner(bigval_t const* msgdgst,
         goto Exit;
     }
 
-    ec_scalarmul(&(curve.generator), digU1, &P1, &curve);
+    ec_scalarmul_base(digU1, &P1, &curve);
     ec_scalarmul(&Q, digU2, &P2, &curve);
 
     // copy P1 to X
@@ -278,6 +278,147 @@ bool ECDSA_verify(bigval_t const* msgdgst,
 }
 
 
+/*
+ * Maximum number of signatures checked by one batch equation.  Finding the
+ * signs of the R points costs 2^(ECDSA_BATCH_MAX-1) point additions.
+ */
+#define ECDSA_BATCH_MAX EC_MULTISCALAR_MAX_POINTS
+
+/*
+ * Checks count signatures at once.  For each signature, u1*G + u2*Q = +-R
+ * where R is a point with x coordinate r.  With z_0 = 1 and random 128-bit
+ * z_1, ..., z_(count-1), the signatures are checked with one equation:
+ *
+ *   (sum z_i*u1_i)*G + sum_Q (sum z_i*u2_i)*Q = +-z_0*R_0 +- ... +- z_(count-1)*R_(count-1)
+ *
+ * The left side costs one fixed-base multiplication and one multi-scalar
+ * multiplication over the distinct public keys, instead of count of each.
+ *
+ * Returns true only if all the signatures are valid (the chance of accepting
+ * an invalid one is below 2^-120).  A false return does not mean that a
+ * signature is invalid, since rare valid signatures (those where x(R) is
+ * r + n rather than r) do not fit the equation: verify them one at a time to
+ * find out.
+ */
+static bool ECDSA_verify_batch(bigval_t const* msgdgst,
+                               affine_point_t const* pubkey,
+                               ECDSA_sig_t const* sig,
+                               size_t count)
+{
+    bool res = false;
+    bigval_t w;
+    bigval_t u1;
+    bigval_t u2;
+    bigval_t t;
+    bigval_t z;
+    bigval_t coefG;
+    bigval_t coefQ[ECDSA_BATCH_MAX];
+    digit256_t digCoef[ECDSA_BATCH_MAX];
+    digit256_t digZ;
+    digit256_t digR;
+    ecpoint_t keys[ECDSA_BATCH_MAX];
+    ecpoint_t Q;
+    ecpoint_t R;
+    ecpoint_t P1;
+    ecpoint_jacobian_t A;
+    ecpoint_jacobian_t P1j;
+    ecpoint_jacobian_t Z[ECDSA_BATCH_MAX];
+    size_t nkeys = 0;
+    size_t i;
+    size_t j;
+    uint8_t random[16];
+    ec_t curve;
+
+    if ((count == 0) || (count > ECDSA_BATCH_MAX)) {
+        return false;
+    }
+    if (ec_getcurve(&curve, NISTP256r1) != ER_OK) {
+        return false;
+    }
+
+    memset(&coefG, 0, sizeof(coefG));
+    memset(coefQ, 0, sizeof(coefQ));
+
+    for (i = 0; i < count; i++) {
+        if ((big_cmp(&sig[i].r, &big_one) < 0) || (big_cmp(&sig[i].r, &orderP) >= 0) ||
+            (big_cmp(&sig[i].s, &big_one) < 0) || (big_cmp(&sig[i].s, &orderP) >= 0)) {
+            goto Exit;
+        }
+        if (!bigval_to_digit256(&(pubkey[i].x), Q.x) || !bigval_to_digit256(&(pubkey[i].y), Q.y) ||
+            !ecpoint_validation(&Q, &curve)) {
+            goto Exit;
+        }
+        if (!bigval_to_digit256(&sig[i].r, digR) || !ec_decompress_x(digR, &R, &curve)) {
+            goto Exit;
+        }
+
+        /* Random multiplier z, except for the first signature */
+        if (i == 0) {
+            z = big_one;
+        } else {
+            if (Crypto_GetRandomBytes(random, sizeof(random)) != ER_OK) {
+                goto Exit;
+            }
+            binary_to_bigval(random, &z, sizeof(random));
+            if (big_is_zero(&z)) {
+                z = big_one;
+            }
+        }
+
+        big_divide(&w, &big_one, &sig[i].s, &orderP);
+        big_mpyP(&u1, &msgdgst[i], &w, MOD_ORDER);
+        big_precise_reduce(&u1, &u1, &orderP);
+        big_mpyP(&u2, &sig[i].r, &w, MOD_ORDER);
+        big_precise_reduce(&u2, &u2, &orderP);
+
+        /* coefG += z*u1 */
+        big_mpyP(&t, &z, &u1, MOD_ORDER);
+        big_add(&coefG, &coefG, &t);
+        big_precise_reduce(&coefG, &coefG, &orderP);
+
+        /* coefQ += z*u2, for the coefficient of this signature's public key */
+        for (j = 0; j < nkeys; j++) {
+            if (fpequal_p256(keys[j].x, Q.x) && fpequal_p256(keys[j].y, Q.y)) {
+                break;
+            }
+        }
+        if (j == nkeys) {
+            keys[nkeys++] = Q;
+        }
+        big_mpyP(&t, &z, &u2, MOD_ORDER);
+        big_add(&coefQ[j], &coefQ[j], &t);
+        big_precise_reduce(&coefQ[j], &coefQ[j], &orderP);
+
+        /* Z[i] = z*R */
+        if (!bigval_to_digit256(&z, digZ) || (ec_multiscalarmul_vartime(&R, &digZ, 1, &Z[i], &curve) != ER_OK)) {
+            goto Exit;
+        }
+    }
+
+    /* A = coefG*G + sum coefQ*Q */
+    for (j = 0; j < nkeys; j++) {
+        if (!bigval_to_digit256(&coefQ[j], digCoef[j])) {
+            goto Exit;
+        }
+    }
+    if (ec_multiscalarmul_vartime(keys, digCoef, nkeys, &A, &curve) != ER_OK) {
+        goto Exit;
+    }
+    if (!big_is_zero(&coefG)) {
+        if (!bigval_to_digit256(&coefG, digCoef[0]) || (ec_scalarmul_base(digCoef[0], &P1, &curve) != ER_OK)) {
+            goto Exit;
+        }
+        ec_affine_tojacobian(&P1, &P1j);
+        ec_add_jacobian(&P1j, &A, &curve);
+    }
+
+    res = ec_is_signed_sum_vartime(&A, Z, count, &curve);
+
+Exit:
+    ec_freecurve(&curve);
+    return res;
+}
+
 /*
  * Converts a hash value to a bigval_t.  The rules for this in
  * ANSIX9.62 are strange.  Let b be the number of octets necessary to
@@ -572,6 +713,52 @@ QStatus Crypto_ECC::DSAVerify(const uint8_t* buf, uint16_t len, const ECCSignatu
     return Crypto_ECC_DSAVerify(buf, len, &eccState->dsaPublicKey, sig);
 }
 
+QStatus Crypto_ECC::DSAVerifyDigestBatch(DSAVerifyEntry* entries, size_t count)
+{
+    QStatus status = ER_OK;
+
+    for (size_t first = 0; first < count; first += ECDSA_BATCH_MAX) {
+        size_t n = ((count - first) < ECDSA_BATCH_MAX) ? (count - first) : ECDSA_BATCH_MAX;
+        bigval_t source[ECDSA_BATCH_MAX];
+        affine_point_t pub[ECDSA_BATCH_MAX];
+        ECDSA_sig_t localSig[ECDSA_BATCH_MAX];
+        /* Two signatures by different keys cost about as much to check either way. */
+        bool batch = (n > 2) || ((n == 2) && (*entries[first].publicKey == *entries[first + 1].publicKey));
+
+        for (size_t i = 0; batch && (i < n); i++) {
+            const DSAVerifyEntry& entry = entries[first + i];
+            if (entry.len != Crypto_SHA256::DIGEST_SIZE) {
+                batch = false;
+                break;
+            }
+            pub[i].infinity = 0;
+            binary_to_bigval(entry.publicKey->GetX(), &pub[i].x, entry.publicKey->GetCoordinateSize());
+            binary_to_bigval(entry.publicKey->GetY(), &pub[i].y, entry.publicKey->GetCoordinateSize());
+            binary_to_bigval(entry.sig->r, &localSig[i].r, sizeof(entry.sig->r));
+            binary_to_bigval(entry.sig->s, &localSig[i].s, sizeof(entry.sig->s));
+            ECC_hash_to_bigval(&source[i], entry.digest, entry.len);
+        }
+
+        if (batch && ECDSA_verify_batch(source, pub, localSig, n)) {
+            for (size_t i = 0; i < n; i++) {
+                entries[first + i].status = ER_OK;
+            }
+            continue;
+        }
+
+        /* Find out which signatures are bad. */
+        for (size_t i = 0; i < n; i++) {
+            DSAVerifyEntry& entry = entries[first + i];
+            entry.status = Crypto_ECC_DSAVerifyDigest(entry.digest, entry.len, entry.publicKey, entry.sig);
+            if (entry.status != ER_OK) {
+                status = ER_FAIL;
+            }
+        }
+    }
+
+    return status;
+}
+
 const ECCPublicKey* Crypto_ECC::GetDHPublicKey() const
 {
     if (eccState->dhPublicKey.empty()) {
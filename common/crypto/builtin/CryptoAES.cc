@@ -52,6 +52,8 @@
 
 #include <Status.h>
 
+#include "CryptoAESAccel.h"
+
 using namespace std;
 using namespace qcc;
 
@@ -295,6 +297,24 @@ static void AJ_AES_ECB_128_ENCRYPT(const uint32_t* fkey, const uint8_t* in, uint
     Unpack32(out, out32);
 }
 
+/*
+ * On little-endian targets the packed key schedule is laid out as the FIPS-197 round keys so it can
+ * be handed to the AES instructions as is.
+ */
+static inline bool UseAccel()
+{
+#if (QCC_TARGET_ENDIAN == QCC_LITTLE_ENDIAN)
+    return AESAccel::Available();
+#else
+    return false;
+#endif
+}
+
+static inline const uint8_t* RoundKeys(const uint32_t* fkey)
+{
+    return reinterpret_cast<const uint8_t*>(fkey);
+}
+
 Crypto_AES::Crypto_AES(const KeyBlob& key, Mode mode) : mode(mode), keyState(new KeyState())
 {
     const int rounds = 10;
@@ -325,8 +345,13 @@ QStatus Crypto_AES::Encrypt(const Block* in, Block* out, uint32_t numBlocks)
         return ER_CRYPTO_ERROR;
     }
 
+    const bool accel = UseAccel();
     while (numBlocks--) {
-        AJ_AES_ECB_128_ENCRYPT(keyState->fkey, in->data, out->data);
+        if (accel) {
+            AESAccel::EncryptBlock(RoundKeys(keyState->fkey), in->data, out->data);
+        } else {
+            AJ_AES_ECB_128_ENCRYPT(keyState->fkey, in->data, out->data);
+        }
         ++in;
         ++out;
     }
@@ -365,7 +390,31 @@ QStatus Crypto_AES::Encrypt(const void* in, size_t len, Block* out, uint32_t num
     return status;
 }
 
-static void Compute_CCM_AuthField(const uint32_t* fkey, Crypto_AES::Block& T, uint8_t M, uint8_t L, const KeyBlob& nonce, const uint8_t* mData, size_t mLen, const uint8_t* addData, size_t addLen)
+/*
+ * Continues a CBC-MAC over whole blocks, mac holds the running value.
+ */
+typedef void (*MACBlocksFunc)(const uint32_t* fkey, uint8_t* mac, const uint8_t* data, size_t len);
+
+static void MACBlocks_Table(const uint32_t* fkey, uint8_t* mac, const uint8_t* data, size_t len)
+{
+    Crypto_AES::Block out;
+    while (len >= AES_BLOCK_LEN) {
+        AJ_AES_CBC_128_ENCRYPT(fkey, data, out.data, AES_BLOCK_LEN, mac);
+        data += AES_BLOCK_LEN;
+        len -= AES_BLOCK_LEN;
+    }
+}
+
+static void MACBlocks_Accel(const uint32_t* fkey, uint8_t* mac, const uint8_t* data, size_t len)
+{
+    AESAccel::MACBlocks(RoundKeys(fkey), mac, data, len);
+}
+
+/*
+ * Computes the CBC-MAC over the B_0 block and the additional authenticated data. The message data
+ * is authenticated separately.
+ */
+static void Start_CCM_AuthField(const uint32_t* fkey, MACBlocksFunc macBlocks, Crypto_AES::Block& T, uint8_t M, uint8_t L, const KeyBlob& nonce, size_t mLen, const uint8_t* addData, size_t addLen)
 {
     uint8_t flags = ((addLen) ? 0x40 : 0) | (((M - 2) / 2) << 3) | (L - 1);
     /*
@@ -382,9 +431,9 @@ static void Compute_CCM_AuthField(const uint32_t* fkey, Crypto_AES::Block& T, ui
     /*
      * Initialize CBC-MAC with B_0 initialization vector is 0.
      */
-    Crypto_AES::Block ivec(0);
+    memset(T.data, 0, sizeof(T.data));
     Trace("CBC IV in: ", B_0.data, sizeof(B_0.data));
-    AJ_AES_CBC_128_ENCRYPT(fkey, B_0.data, T.data, sizeof(T.data), ivec.data);
+    macBlocks(fkey, T.data, B_0.data, sizeof(B_0.data));
     Trace("CBC IV out:", T.data, sizeof(T.data));
     /*
      * Compute CBC-MAC for the add data.
@@ -416,37 +465,40 @@ static void Compute_CCM_AuthField(const uint32_t* fkey, Crypto_AES::Block& T, ui
         /*
          * Continue computing the CBC-MAC
          */
-        AJ_AES_CBC_128_ENCRYPT(fkey, A.data, T.data, sizeof(T.data), ivec.data);
+        macBlocks(fkey, T.data, A.data, sizeof(A.data));
         Trace("After AES 1: ", T.data, sizeof(T.data));
-        while (addLen >= AES_BLOCK_LEN) {
-            AJ_AES_CBC_128_ENCRYPT(fkey, addData, T.data, sizeof(T.data), ivec.data);
-            Trace("After AES 2: ", T.data, sizeof(T.data));
-            addData += AES_BLOCK_LEN;
-            addLen -= AES_BLOCK_LEN;
-        }
+        size_t wholeLen = addLen - (addLen % AES_BLOCK_LEN);
+        macBlocks(fkey, T.data, addData, wholeLen);
+        Trace("After AES 2: ", T.data, sizeof(T.data));
+        addData += wholeLen;
+        addLen -= wholeLen;
         if (addLen) {
             memcpy(A.data, addData, addLen);
             A.Pad(16 - addLen);
-            AJ_AES_CBC_128_ENCRYPT(fkey, A.data, T.data, sizeof(T.data), ivec.data);
+            macBlocks(fkey, T.data, A.data, sizeof(A.data));
             Trace("After AES 3: ", T.data, sizeof(T.data));
         }
 
     }
+}
+
+static void Compute_CCM_AuthField(const uint32_t* fkey, Crypto_AES::Block& T, uint8_t M, uint8_t L, const KeyBlob& nonce, const uint8_t* mData, size_t mLen, const uint8_t* addData, size_t addLen)
+{
+    Start_CCM_AuthField(fkey, MACBlocks_Table, T, M, L, nonce, mLen, addData, addLen);
     /*
      * Continue computing CBC-MAC over the message data.
      */
     if (mLen) {
-        while (mLen >= AES_BLOCK_LEN) {
-            AJ_AES_CBC_128_ENCRYPT(fkey, mData, T.data, sizeof(T.data), ivec.data);
-            Trace("After AES 4: ", T.data, sizeof(T.data));
-            mData += AES_BLOCK_LEN;
-            mLen -= AES_BLOCK_LEN;
-        }
+        size_t wholeLen = mLen - (mLen % AES_BLOCK_LEN);
+        MACBlocks_Table(fkey, T.data, mData, wholeLen);
+        Trace("After AES 4: ", T.data, sizeof(T.data));
+        mData += wholeLen;
+        mLen -= wholeLen;
         if (mLen) {
             Crypto_AES::Block final;
             memcpy(final.data, mData, mLen);
             final.Pad(16 - mLen);
-            AJ_AES_CBC_128_ENCRYPT(fkey, final.data, T.data, sizeof(T.data), ivec.data);
+            MACBlocks_Table(fkey, T.data, final.data, sizeof(final.data));
             Trace("After AES 5: ", T.data, sizeof(T.data));
         }
     }
@@ -492,25 +544,39 @@ QStatus Crypto_AES::Encrypt_CCM(const void* in, void* out, size_t& len, const Ke
     if (L < LengthOctetsFor(len)) {
         return ER_BAD_ARG_3;
     }
-    /*
-     * Compute the authentication field T.
-     */
-    Block T;
-    Compute_CCM_AuthField(keyState->fkey, T, authLen, L, nonce, (uint8_t*)in, len, (uint8_t*)addData, addLen);
     /*
      * Initialize ivec and other initial args.
      */
     Block ivec(0);
     ivec.data[0] = (L - 1);
     memcpy(&ivec.data[1], nonce.GetData(), nLen);
-    Block ecount_buf(0);
-    /*
-     * Encrypt the authentication field
-     */
+    Block T;
     Block U;
-    AJ_AES_CTR_128(keyState->fkey, T.data, U.data, 16, ivec.data);
-    Trace("CTR Start: ", ivec.data, 16);
-    AJ_AES_CTR_128(keyState->fkey, (const uint8_t*)in, (uint8_t*)out, len, ivec.data);
+    if (UseAccel()) {
+        /*
+         * The payload is authenticated and encrypted in a single pass. Counter block A_0
+         * encrypts the authentication field and the payload starts at A_1.
+         */
+        const uint8_t* roundKeys = RoundKeys(keyState->fkey);
+        Start_CCM_AuthField(keyState->fkey, MACBlocks_Accel, T, authLen, L, nonce, len, (uint8_t*)addData, addLen);
+        AESAccel::EncryptBlock(roundKeys, ivec.data, U.data);
+        ivec.data[15] = 1;
+        AESAccel::CCMEncrypt(roundKeys, T.data, ivec.data, (const uint8_t*)in, (uint8_t*)out, len);
+        for (size_t i = 0; i < authLen; ++i) {
+            U.data[i] ^= T.data[i];
+        }
+    } else {
+        /*
+         * Compute the authentication field T.
+         */
+        Compute_CCM_AuthField(keyState->fkey, T, authLen, L, nonce, (uint8_t*)in, len, (uint8_t*)addData, addLen);
+        /*
+         * Encrypt the authentication field
+         */
+        AJ_AES_CTR_128(keyState->fkey, T.data, U.data, 16, ivec.data);
+        Trace("CTR Start: ", ivec.data, 16);
+        AJ_AES_CTR_128(keyState->fkey, (const uint8_t*)in, (uint8_t*)out, len, ivec.data);
+    }
     memcpy((uint8_t*)out + len, U.data, authLen);
     len += authLen;
     return ER_OK;
@@ -548,24 +614,41 @@ QStatus Crypto_AES::Decrypt_CCM(const void* in, void* out, size_t& len, const Ke
     Block ivec(0);
     ivec.data[0] = (L - 1);
     memcpy(&ivec.data[1], nonce.GetData(), nLen);
-    Block ecount_buf(0);
     /*
      * Decrypt the authentication field
      */
     Block U;
     Block T;
+    Block F;
     len = len - authLen;
     memcpy(U.data, (const uint8_t*)in + len, authLen);
-    AJ_AES_CTR_128(keyState->fkey, U.data, T.data, sizeof(T.data), ivec.data);
-    /*
-     * Decrypt message.
-     */
-    AJ_AES_CTR_128(keyState->fkey, (const uint8_t*)in, (uint8_t*)out, len, ivec.data);
+    if (UseAccel()) {
+        /*
+         * Decrypt the payload starting at counter block A_1 and compute the authentication
+         * field over the plaintext as it is produced.
+         */
+        const uint8_t* roundKeys = RoundKeys(keyState->fkey);
+        AESAccel::EncryptBlock(roundKeys, ivec.data, T.data);
+        for (size_t i = 0; i < authLen; ++i) {
+            T.data[i] ^= U.data[i];
+        }
+        ivec.data[15] = 1;
+        Start_CCM_AuthField(keyState->fkey, MACBlocks_Accel, F, authLen, L, nonce, len, (uint8_t*)addData, addLen);
+        AESAccel::CCMDecrypt(roundKeys, F.data, ivec.data, (const uint8_t*)in, (uint8_t*)out, len);
+    } else {
+        AJ_AES_CTR_128(keyState->fkey, U.data, T.data, sizeof(T.data), ivec.data);
+        /*
+         * Decrypt message.
+         */
+        AJ_AES_CTR_128(keyState->fkey, (const uint8_t*)in, (uint8_t*)out, len, ivec.data);
+        /*
+         * Compute the authentication field.
+         */
+        Compute_CCM_AuthField(keyState->fkey, F, authLen, L, nonce, (uint8_t*)out, len, (uint8_t*)addData, addLen);
+    }
     /*
-     * Compute and verify the authentication field T.
+     * Verify the authentication field T.
      */
-    Block F;
-    Compute_CCM_AuthField(keyState->fkey, F, authLen, L, nonce, (uint8_t*)out, len, (uint8_t*)addData, addLen);
     if (Crypto_Compare(F.data, T.data, authLen) == 0) {
         return ER_OK;
     } else {
@@ -0,0 +1,360 @@
+/**
+ * @file CryptoAESAccel.cc
+ *
+ * Hardware accelerated AES-128 primitives for the builtin crypto backend.
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#include <qcc/platform.h>
+
+#include <string.h>
+
+#include <qcc/Util.h>
+
+#include "CryptoAESAccel.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+#define QCC_AES_ACCEL_X86
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define QCC_AES_TARGET
+#else
+#include <cpuid.h>
+#define QCC_AES_TARGET __attribute__((target("aes,sse2")))
+#endif
+
+#elif defined(__aarch64__) && defined(__linux__) && !defined(__AARCH64EB__)
+
+#define QCC_AES_ACCEL_ARMV8
+#include <arm_neon.h>
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#if defined(__clang__)
+#define QCC_AES_TARGET __attribute__((target("crypto")))
+#else
+#define QCC_AES_TARGET __attribute__((target("+crypto")))
+#endif
+
+#endif
+
+namespace qcc {
+
+namespace AESAccel {
+
+#if defined(QCC_AES_ACCEL_X86)
+
+typedef __m128i Block128;
+
+static bool Detect()
+{
+    unsigned int ecx;
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    ecx = static_cast<unsigned int>(info[2]);
+#else
+    unsigned int eax, ebx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+#endif
+    /* CPUID.01H:ECX.AES[bit 25] */
+    return (ecx & (1u << 25)) != 0;
+}
+
+QCC_AES_TARGET static inline Block128 Load(const uint8_t* p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+QCC_AES_TARGET static inline void Store(uint8_t* p, Block128 b)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), b);
+}
+
+QCC_AES_TARGET static inline Block128 Xor(Block128 a, Block128 b)
+{
+    return _mm_xor_si128(a, b);
+}
+
+QCC_AES_TARGET static inline Block128 Encrypt1(const Block128* k, Block128 a)
+{
+    a = _mm_xor_si128(a, k[0]);
+    for (int r = 1; r < 10; ++r) {
+        a = _mm_aesenc_si128(a, k[r]);
+    }
+    return _mm_aesenclast_si128(a, k[10]);
+}
+
+/*
+ * Two independent blocks are interleaved so the second fills the latency of the first.
+ */
+QCC_AES_TARGET static inline void Encrypt2(const Block128* k, Block128& a, Block128& b)
+{
+    a = _mm_xor_si128(a, k[0]);
+    b = _mm_xor_si128(b, k[0]);
+    for (int r = 1; r < 10; ++r) {
+        a = _mm_aesenc_si128(a, k[r]);
+        b = _mm_aesenc_si128(b, k[r]);
+    }
+    a = _mm_aesenclast_si128(a, k[10]);
+    b = _mm_aesenclast_si128(b, k[10]);
+}
+
+#elif defined(QCC_AES_ACCEL_ARMV8)
+
+typedef uint8x16_t Block128;
+
+static bool Detect()
+{
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+}
+
+QCC_AES_TARGET static inline Block128 Load(const uint8_t* p)
+{
+    return vld1q_u8(p);
+}
+
+QCC_AES_TARGET static inline void Store(uint8_t* p, Block128 b)
+{
+    vst1q_u8(p, b);
+}
+
+QCC_AES_TARGET static inline Block128 Xor(Block128 a, Block128 b)
+{
+    return veorq_u8(a, b);
+}
+
+/*
+ * AESE combines AddRoundKey with SubBytes and ShiftRows so the last round key is applied
+ * separately.
+ */
+QCC_AES_TARGET static inline Block128 Encrypt1(const Block128* k, Block128 a)
+{
+    for (int r = 0; r < 9; ++r) {
+        a = vaesmcq_u8(vaeseq_u8(a, k[r]));
+    }
+    return veorq_u8(vaeseq_u8(a, k[9]), k[10]);
+}
+
+QCC_AES_TARGET static inline void Encrypt2(const Block128* k, Block128& a, Block128& b)
+{
+    for (int r = 0; r < 9; ++r) {
+        a = vaesmcq_u8(vaeseq_u8(a, k[r]));
+        b = vaesmcq_u8(vaeseq_u8(b, k[r]));
+    }
+    a = veorq_u8(vaeseq_u8(a, k[9]), k[10]);
+    b = veorq_u8(vaeseq_u8(b, k[9]), k[10]);
+}
+
+#endif
+
+#if defined(QCC_AES_TARGET)
+
+QCC_AES_TARGET static inline void LoadKeys(const uint8_t* roundKeys, Block128* k)
+{
+    for (int r = 0; r < 11; ++r) {
+        k[r] = Load(roundKeys + 16 * r);
+    }
+}
+
+/*
+ * Loads up to 16 bytes, zero padding a partial block.
+ */
+QCC_AES_TARGET static inline Block128 LoadPartial(const uint8_t* p, size_t len)
+{
+    if (len == 16) {
+        return Load(p);
+    }
+    uint8_t buf[16] = { 0 };
+    memcpy(buf, p, len);
+    return Load(buf);
+}
+
+QCC_AES_TARGET static inline void StorePartial(uint8_t* p, Block128 b, size_t len)
+{
+    if (len == 16) {
+        Store(p, b);
+    } else {
+        uint8_t buf[16];
+        Store(buf, b);
+        memcpy(p, buf, len);
+    }
+}
+
+/*
+ * Returns the current counter block and advances the big-endian counter in the last 4 bytes.
+ */
+QCC_AES_TARGET static inline Block128 NextCounter(uint8_t* ctr)
+{
+    Block128 b = Load(ctr);
+    for (int i = 15; i >= 12; --i) {
+        if (++ctr[i] != 0) {
+            break;
+        }
+    }
+    return b;
+}
+
+bool Available()
+{
+    static const bool available = Detect();
+    return available;
+}
+
+QCC_AES_TARGET void EncryptBlock(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out)
+{
+    Block128 k[11];
+    LoadKeys(roundKeys, k);
+    Store(out, Encrypt1(k, Load(in)));
+}
+
+QCC_AES_TARGET void MACBlocks(const uint8_t* roundKeys, uint8_t* mac, const uint8_t* data, size_t len)
+{
+    Block128 k[11];
+    LoadKeys(roundKeys, k);
+    Block128 t = Load(mac);
+    for (; len >= 16; len -= 16, data += 16) {
+        t = Encrypt1(k, Xor(t, Load(data)));
+    }
+    Store(mac, t);
+}
+
+QCC_AES_TARGET void CCMEncrypt(const uint8_t* roundKeys, uint8_t* mac, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len)
+{
+    Block128 k[11];
+    LoadKeys(roundKeys, k);
+    Block128 t = Load(mac);
+    while (len) {
+        size_t n = (len < 16) ? len : 16;
+        Block128 p = LoadPartial(in, n);
+        Block128 s = NextCounter(ctr);
+        t = Xor(t, p);
+        Encrypt2(k, t, s);
+        StorePartial(out, Xor(p, s), n);
+        in += n;
+        out += n;
+        len -= n;
+    }
+    Store(mac, t);
+}
+
+QCC_AES_TARGET void CCMDecrypt(const uint8_t* roundKeys, uint8_t* mac, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len)
+{
+    Block128 k[11];
+    LoadKeys(roundKeys, k);
+    Block128 t = Load(mac);
+    if (len) {
+        Block128 s = Encrypt1(k, NextCounter(ctr));
+        while (len) {
+            size_t n = (len < 16) ? len : 16;
+            Block128 p;
+            if (n == 16) {
+                p = Xor(Load(in), s);
+                Store(out, p);
+            } else {
+                /*
+                 * The plaintext of a partial block is zero padded for the CBC-MAC so the
+                 * keystream beyond it is discarded.
+                 */
+                uint8_t buf[16] = { 0 };
+                memcpy(buf, in, n);
+                Store(buf, Xor(Load(buf), s));
+                memset(buf + n, 0, 16 - n);
+                memcpy(out, buf, n);
+                p = Load(buf);
+                ClearMemory(buf, sizeof(buf));
+            }
+            in += n;
+            out += n;
+            len -= n;
+            t = Xor(t, p);
+            if (len) {
+                s = NextCounter(ctr);
+                Encrypt2(k, t, s);
+            } else {
+                t = Encrypt1(k, t);
+            }
+        }
+    }
+    Store(mac, t);
+}
+
+#else
+
+bool Available()
+{
+    return false;
+}
+
+void EncryptBlock(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out)
+{
+    QCC_UNUSED(roundKeys);
+    QCC_UNUSED(in);
+    QCC_UNUSED(out);
+}
+
+void MACBlocks(const uint8_t* roundKeys, uint8_t* mac, const uint8_t* data, size_t len)
+{
+    QCC_UNUSED(roundKeys);
+    QCC_UNUSED(mac);
+    QCC_UNUSED(data);
+    QCC_UNUSED(len);
+}
+
+void CCMEncrypt(const uint8_t* roundKeys, uint8_t* mac, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len)
+{
+    QCC_UNUSED(roundKeys);
+    QCC_UNUSED(mac);
+    QCC_UNUSED(ctr);
+    QCC_UNUSED(in);
+    QCC_UNUSED(out);
+    QCC_UNUSED(len);
+}
+
+void CCMDecrypt(const uint8_t* roundKeys, uint8_t* mac, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len)
+{
+    QCC_UNUSED(roundKeys);
+    QCC_UNUSED(mac);
+    QCC_UNUSED(ctr);
+    QCC_UNUSED(in);
+    QCC_UNUSED(out);
+    QCC_UNUSED(len);
+}
+
+#endif
+
+}
+
+}
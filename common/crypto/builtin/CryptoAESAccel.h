@@ -0,0 +1,108 @@
+/**
+ * @file
+ *
+ * Hardware accelerated AES-128 primitives for the builtin crypto backend.
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef _QCC_CRYPTOAESACCEL_H
+#define _QCC_CRYPTOAESACCEL_H
+
+#include <qcc/platform.h>
+
+namespace qcc {
+
+/**
+ * AES-128 using the CPU's AES instructions: AES-NI on x86 and the ARMv8 Cryptography Extensions
+ * on AArch64. All functions take the expanded encryption key as 11 consecutive 16 byte round keys
+ * in FIPS-197 byte order. None of the functions other than Available() may be called unless
+ * Available() has returned true.
+ */
+namespace AESAccel {
+
+/**
+ * Checks, once per process, whether the CPU supports the AES instructions.
+ *
+ * @return true if the accelerated functions can be used.
+ */
+bool Available();
+
+/**
+ * Encrypt a single 16 byte block.
+ *
+ * @param roundKeys  The expanded key.
+ * @param in         The plaintext block.
+ * @param out        Returns the ciphertext block, may be the same as in.
+ */
+void EncryptBlock(const uint8_t* roundKeys, const uint8_t* in, uint8_t* out);
+
+/**
+ * Continue a CBC-MAC over whole blocks.
+ *
+ * @param roundKeys  The expanded key.
+ * @param mac        The running 16 byte CBC-MAC value, updated in place.
+ * @param data       The data to authenticate.
+ * @param len        The length of data, a multiple of 16.
+ */
+void MACBlocks(const uint8_t* roundKeys, uint8_t* mac, const uint8_t* data, size_t len);
+
+/**
+ * The payload part of CCM encryption. Each block of plaintext is folded into the CBC-MAC and
+ * encrypted in counter mode, with the two AES operations for a block issued together. A partial
+ * final block is zero padded for the CBC-MAC.
+ *
+ * @param roundKeys  The expanded key.
+ * @param mac        The running 16 byte CBC-MAC value, updated in place.
+ * @param ctr        The 16 byte counter block for the first payload block. The low 32 bits are
+ *                   incremented big-endian for each block and the next counter is returned.
+ * @param in         The plaintext.
+ * @param out        Returns the ciphertext, may be the same as in.
+ * @param len        The length of the payload.
+ */
+void CCMEncrypt(const uint8_t* roundKeys, uint8_t* mac, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len);
+
+/**
+ * The payload part of CCM decryption. The counter mode decryption of each block is overlapped
+ * with folding the previous plaintext block into the CBC-MAC.
+ *
+ * @param roundKeys  The expanded key.
+ * @param mac        The running 16 byte CBC-MAC value, updated in place.
+ * @param ctr        The 16 byte counter block for the first payload block, as for CCMEncrypt().
+ * @param in         The ciphertext.
+ * @param out        Returns the plaintext, may be the same as in.
+ * @param len        The length of the payload.
+ */
+void CCMDecrypt(const uint8_t* roundKeys, uint8_t* mac, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len);
+
+}
+
+}
+
+#endif
@@ -52,6 +52,7 @@ class Timer;
 class _Alarm;
 class TimerImpl;
 class TimerThread;
+class TimingWheel;
 
 typedef ManagedObj<_Alarm> Alarm;
 
@@ -82,6 +83,7 @@ class AlarmListener {
 class _Alarm {
     friend class TimerImpl;
     friend class TimerThread;
+    friend class TimingWheel;
 
   public:
 
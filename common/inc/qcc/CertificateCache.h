@@ -0,0 +1,146 @@
+#ifndef _QCC_CERTIFICATE_CACHE_H_
+#define _QCC_CERTIFICATE_CACHE_H_
+/**
+ * @file
+ *
+ * Process-wide cache of decoded and verified certificates
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <qcc/platform.h>
+#include <qcc/CertificateECC.h>
+#include <qcc/CryptoECC.h>
+#include <qcc/String.h>
+
+#include <Status.h>
+
+namespace qcc {
+
+/**
+ * A bounded, process-wide LRU cache of X.509 certificates.  Entries are keyed
+ * by the SHA-256 digest of the DER encoding of the certificate and hold the
+ * decoded certificate along with the results of verifying its signature
+ * against a small number of issuer public keys.
+ *
+ * Only facts that depend on the certificate bytes alone are cached.  The
+ * validity period and the trust decisions built on top of a verified
+ * signature are always evaluated by the caller.
+ */
+class CertificateCache {
+
+  public:
+
+    /**
+     * The default maximum number of certificates held in the cache.
+     */
+    static const size_t DEFAULT_CAPACITY = 128;
+
+    /**
+     * The maximum number of issuer keys for which a verification result is
+     * remembered per certificate.
+     */
+    static const size_t MAX_ISSUERS_PER_ENTRY = 4;
+
+    /**
+     * Decode a DER encoded certificate, reusing a previously decoded copy
+     * when the same encoding has been seen before.
+     * @param der the encoded certificate.
+     * @param[out] cert the decoded certificate.
+     * @return ER_OK for success; otherwise, error code.
+     */
+    static QStatus AJ_CALL DecodeCertificateDER(const qcc::String& der, CertificateX509& cert);
+
+    /**
+     * Verify the signature of a certificate, reusing a previous result for
+     * the same certificate and issuer key when one is cached.
+     * @param cert the certificate.
+     * @param issuerKey the ECDSA public key of the issuer.
+     * @return ER_OK for success; otherwise, error code.
+     */
+    static QStatus AJ_CALL Verify(const CertificateX509& cert, const ECCPublicKey* issuerKey);
+
+    /**
+     * Compute the digest a certificate is cached under.
+     * @param cert the certificate.
+     * @param[out] digest buffer of Crypto_SHA256::DIGEST_SIZE bytes.
+     * @return ER_OK for success; otherwise, error code.
+     */
+    static QStatus AJ_CALL GetCertificateDigest(const CertificateX509& cert, uint8_t* digest);
+
+    /**
+     * Look up the result of verifying a certificate with an issuer key.
+     * @param digest the certificate digest from GetCertificateDigest().
+     * @param issuerKey the ECDSA public key of the issuer.
+     * @param[out] status the cached verification result.
+     * @return true if a result is cached; false otherwise.
+     */
+    static bool AJ_CALL LookupVerification(const uint8_t* digest, const ECCPublicKey* issuerKey, QStatus& status);
+
+    /**
+     * Remember the result of verifying a certificate with an issuer key.
+     * @param digest the certificate digest from GetCertificateDigest().
+     * @param issuerKey the ECDSA public key of the issuer.
+     * @param status the verification result.
+     */
+    static void AJ_CALL StoreVerification(const uint8_t* digest, const ECCPublicKey* issuerKey, QStatus status);
+
+    /**
+     * Drop every cached certificate.  Called whenever the trust anchors or
+     * the policy change.
+     */
+    static void AJ_CALL Clear();
+
+    /**
+     * Set the maximum number of certificates held in the cache.  Zero
+     * disables caching.
+     * @param capacity the new capacity.
+     */
+    static void AJ_CALL SetCapacity(size_t capacity);
+
+    /**
+     * Get the number of certificates currently cached.
+     * @return the number of entries.
+     */
+    static size_t AJ_CALL GetSize();
+
+    /**
+     * Create the process-wide cache.  Called by qcc::Init().
+     */
+    static void Init();
+
+    /**
+     * Destroy the process-wide cache.  Called by qcc::Shutdown().
+     */
+    static void Shutdown();
+};
+
+} /* namespace qcc */
+
+#endif
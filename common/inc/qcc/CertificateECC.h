@@ -295,6 +295,23 @@ class CertificateX509 {
      */
     QStatus Sign(const ECCPrivateKey* key);
 
+    /**
+     * Get the signature of the certificate.
+     * @return the signature
+     */
+    const ECCSignature* GetSignature() const
+    {
+        return &signature;
+    }
+
+    /**
+     * Compute the SHA-256 digest of the TBS portion of the certificate, which is
+     * what the signature covers.
+     * @param[out] digest the buffer to receive the digest, of size Crypto_SHA256::DIGEST_SIZE.
+     * @return ER_OK for success; otherwise, error code.
+     */
+    QStatus GetTBSDigest(uint8_t* digest) const;
+
     /**
      * Set the signature to a provided byte array, when signing the certificate externally.
      * This method does not verify the signature is valid, please use Verify with the
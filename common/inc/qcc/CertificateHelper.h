@@ -38,6 +38,8 @@
 
 namespace qcc {
 
+class CertificateX509;
+
 class CertificateHelper {
 
   public:
@@ -50,6 +52,17 @@ class CertificateHelper {
      */
     static QStatus AJ_CALL GetCertCount(const String& encoded, size_t* count);
 
+    /**
+     * Verify the signatures of a certificate chain, where each certificate is
+     * signed by the subject key of the next one.  The signatures are checked in
+     * one batch, which costs much less than verifying each certificate on its own.
+     * The signature of the last certificate is not checked.
+     * @param certs the certificate chain, leaf first
+     * @param count the number of certificates in the chain
+     * @return ER_OK if all the signatures verify; otherwise, error code.
+     */
+    static QStatus AJ_CALL VerifyCertChainSignatures(const CertificateX509* certs, size_t count);
+
 };
 
 } /* namespace qcc */
@@ -714,6 +714,30 @@ class Crypto_ECC {
      */
     QStatus DSAVerify(const uint8_t* buf, uint16_t len, const ECCSignature* sig);
 
+    /**
+     * One signature to check with DSAVerifyDigestBatch.
+     */
+    struct DSAVerifyEntry {
+        const ECCPublicKey* publicKey;  /**< The public key of the signer */
+        const uint8_t* digest;          /**< The signed digest */
+        uint16_t len;                   /**< The digest len */
+        const ECCSignature* sig;        /**< The signature */
+        QStatus status;                 /**< [out] ER_OK if this signature verifies, ER_FAIL or other error status otherwise */
+    };
+
+    /**
+     * Verify several DSA signatures of digests, possibly by different keys.
+     * This is much cheaper than calling DSAVerifyDigest for each signature when all
+     * of them are valid, and the common case for certificate chains and manifests.
+     *
+     * @param entries The signatures to verify.  The status field of each entry is set.
+     * @param count The number of entries
+     * @return
+     *      ER_OK if all the signatures verify
+     *      ER_FAIL otherwise
+     */
+    static QStatus DSAVerifyDigestBatch(DSAVerifyEntry* entries, size_t count);
+
     /**
      * Retrieve the ECC curve type.
      * @return the ECC curve type
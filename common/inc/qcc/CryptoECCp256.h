@@ -179,6 +179,66 @@ void ec_affine_tojacobian(const ecpoint_t* Q, ecpoint_jacobian_t* P);
  */
 QStatus ec_scalarmul(const ecpoint_t* P, digit256_t k, ecpoint_t* Q, ec_t* curve);
 
+/**
+ * Compute the scalar multiplication k*G, where G is the generator of the curve.
+ * Unless the library was built with ECC_FIXEDBASE=off, this uses a precomputed
+ * table of multiples of G and is several times faster than ec_scalarmul.
+ *
+ * @param[in]  k     The scalar, in [1, r-1] where r is the order of the curve.
+ * @param[out] Q     The output point Q = k*G.
+ * @param[in]  curve The curve (must be NISTP256r1).
+ *
+ * @return ER_OK if succcessful
+ */
+QStatus ec_scalarmul_base(digit256_t k, ecpoint_t* Q, ec_t* curve);
+
+/* Maximum number of points accepted by ec_multiscalarmul_vartime. */
+#define EC_MULTISCALAR_MAX_POINTS 8
+
+/**
+ * Compute the multi-scalar multiplication Q = k[0]*P[0] + ... + k[n-1]*P[n-1].
+ * The doublings are shared by all the points, so this costs little more than a
+ * single scalar multiplication.
+ *
+ * This function does not run in constant time, it must only be used on public
+ * data (e.g., to verify signatures).
+ *
+ * @param[in]  P       The points, which must be valid.
+ * @param[in]  k       The scalars, in [0, r-1] where r is the order of the curve.
+ * @param[in]  npoints The number of points, at most EC_MULTISCALAR_MAX_POINTS.
+ * @param[out] Q       The output point, in Jacobian coordinates.  May be the point at infinity.
+ * @param[in]  curve   The curve the points are on.
+ *
+ * @return ER_OK if succcessful
+ */
+QStatus ec_multiscalarmul_vartime(const ecpoint_t* P, const digit256_t* k, size_t npoints, ecpoint_jacobian_t* Q, ec_t* curve);
+
+/**
+ * Find a point with the given x coordinate.  Which of the two possible points
+ * is returned is unspecified.
+ *
+ * @param[in]  x     The x coordinate.
+ * @param[out] P     The point (x,y).
+ * @param[in]  curve The curve.
+ *
+ * @return true if x is the x coordinate of a point on the curve, false otherwise.
+ */
+boolean_t ec_decompress_x(digit256_tc x, ecpoint_t* P, ec_t* curve);
+
+/**
+ * Test whether A = +-Z[0] +- Z[1] ... +- Z[n-1] for some choice of signs.
+ * This costs 2^(n-1) point additions and runs in variable time; it must only be
+ * used on public data.
+ *
+ * @param[in] A     The point to compare with, in Jacobian coordinates.
+ * @param[in] Z     The points to sum, in Jacobian coordinates.
+ * @param[in] n     The number of points, in [1, EC_MULTISCALAR_MAX_POINTS].
+ * @param[in] curve The curve the points are on.
+ *
+ * @return true if some signed sum equals A, false otherwise.
+ */
+boolean_t ec_is_signed_sum_vartime(const ecpoint_jacobian_t* A, const ecpoint_jacobian_t* Z, size_t n, ec_t* curve);
+
 /**
  * Check that a point is on the given curve.
  *
@@ -213,6 +273,7 @@ void ec_add(ecpoint_t* P, const ecpoint_t* Q, ec_t* curve);
 /* These are internal to the ECC code -- defined here for testing.  */
 void ec_double_jacobian(ecpoint_jacobian_t* P);
 void ec_add_jacobian(ecpoint_jacobian_t* Q, ecpoint_jacobian_t* P, ec_t* curve);
+void fixed_window_recode(digit256_t scalar, unsigned int nbit, unsigned int w, int* digits);
 
 }
 
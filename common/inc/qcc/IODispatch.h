@@ -42,6 +42,7 @@
 #include <qcc/Timer.h>
 #include <Status.h>
 #include <map>
+#include <set>
 namespace qcc {
 
 /* Forward References */
@@ -163,6 +164,8 @@ struct IODispatchEntry {
     bool writeInProgress;   /* Whether write is currently in progress for this stream */
     bool mainAddingRead;    /* Whether the main thread will re-add a read alarm for this stream */
     bool mainAddingWrite;   /* Whether the main thread will re-add a write alarm for this stream */
+    bool pollRegistered;    /* Whether this stream is registered in the IODispatch poll set */
+    uint32_t pollEvents;    /* Events this stream is currently registered for in the poll set */
 
     StoppingState stopping_state;          /* Whether this stream is in the process of being stopped*/
 
@@ -181,6 +184,8 @@ struct IODispatchEntry {
         writeInProgress(false),
         mainAddingRead(false),
         mainAddingWrite(false),
+        pollRegistered(false),
+        pollEvents(0),
         stopping_state(IO_RUNNING) { }
 
     /**
@@ -206,6 +211,8 @@ struct IODispatchEntry {
         writeInProgress(writeInProgress),
         mainAddingRead(false),
         mainAddingWrite(false),
+        pollRegistered(false),
+        pollEvents(0),
         stopping_state(IO_RUNNING)
     {
         QCC_UNUSED(stream);
@@ -356,9 +363,54 @@ class IODispatch : public Thread, public AlarmListener {
      */
     virtual ThreadReturn STDCALL Run(void* arg);
 
+    /**
+     * Register a newly started stream.  On platforms with epoll, streams whose
+     * source and sink events are backed by the same socket are registered once
+     * in the poll set and stay registered until they are stopped.  All other
+     * streams are added to the set of streams whose events are collected on
+     * every iteration of the main thread.  Caller must hold the lock.
+     */
+    void RegisterStream(Stream* stream, IODispatchEntry& entry);
+
+    /**
+     * Remove a stream from the poll set or the set of waited on streams.
+     * Caller must hold the lock.
+     */
+    void UnregisterStream(Stream* stream, IODispatchEntry& entry);
+
+    /**
+     * Bring the poll set registration of a stream in line with its read and
+     * write state.  Caller must hold the lock.
+     */
+    void UpdateStream(Stream* stream, IODispatchEntry& entry);
+
+    /**
+     * Add a read alarm for a stream whose source event is signaled.  Caller
+     * must hold the lock, which is released and re-acquired.
+     *
+     * @return true if the stream was waiting for its source event.
+     */
+    bool SourceEventSignaled(Stream* stream);
+
+    /**
+     * Add a write alarm for a stream whose sink event is signaled.  Caller
+     * must hold the lock, which is released and re-acquired.
+     *
+     * @return true if the stream was waiting for its sink event.
+     */
+    bool SinkEventSignaled(Stream* stream);
+
+    /**
+     * Add read and write alarms for the streams that are ready in the poll set.
+     */
+    void DispatchPollSet();
+
     Timer timer;                                /* The timer used to add and process callbacks */
     Mutex lock;                                 /* Lock for mutual exclusion of dispatchEntries */
     std::map<Stream*, IODispatchEntry> dispatchEntries; /* map holding details of various streams registered with this IODispatch */
+    std::set<Stream*> waitStreams;              /* Streams not in the poll set whose events the main thread waits on */
+    int pollFd;                                 /* epoll set of registered streams or -1 if not available */
+    Event* pollEvent;                           /* Event signaled when a stream in the poll set is ready */
     volatile bool reload;                       /* Flag used for synchronization of various methods with the Run thread */
     volatile bool isRunning;                    /* Whether the run thread is still running. */
     volatile int32_t numAlarmsInProgress;       /* Number of alarms currently in progress. */
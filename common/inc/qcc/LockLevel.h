@@ -83,6 +83,9 @@ typedef enum {
      */
     LOCK_LEVEL_NOT_SPECIFIED = 0,
 
+    /* LocalTransport.cc */
+    LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_DISPATCHER_REENTRANCYLOCK = 400,
+
     /* Timer.cc */
     LOCK_LEVEL_TIMERIMPL_REENTRANCYLOCK = 500,
 
@@ -147,7 +150,6 @@ typedef enum {
     LOCK_LEVEL_THREAD_AUXLISTENERSLOCK = 16000,
 
     /* LocalTransport.cc */
-    LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_DISPATCHER_WORKLOCK = 17000,
     LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_OBJECTSLOCK = 17100,
     LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_HANDLERTHREADSLOCK = 17200,
     LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_REPLYMAPLOCK = 17300,
@@ -206,9 +208,19 @@ typedef enum {
     /* Event.cc */
     LOCK_LEVEL_EVENT_IOEVENTMONITOR_LOCK = 35000,
 
+    /* LocalTransport.cc */
+    LOCK_LEVEL_LOCALTRANSPORT_LOCALENDPOINT_DISPATCHER_QUEUELOCK = 35500,
+
     /* Timer.cc */
     LOCK_LEVEL_TIMERIMPL_LOCK = 36000,
 
+    /* PeerState.h */
+    LOCK_LEVEL_PEERSTATE_KEYLOCK = 36400,
+    LOCK_LEVEL_PEERSTATE_AUTHORIZATIONCACHELOCK = 36450,
+
+    /* AllJoynCrypto.cc */
+    LOCK_LEVEL_ALLJOYNCRYPTO_EXTRANONCELOCK = 36500,
+
     /* OpenSsl.cc */
     LOCK_LEVEL_OPENSSL_LOCK = 37000,
 
@@ -219,6 +231,9 @@ typedef enum {
     /* CngCache.cc */
     LOCK_LEVEL_CNGCACHELOCK = 39000,
 
+    /* CertificateCache.cc */
+    LOCK_LEVEL_CERTIFICATECACHE_LOCK = 39500,
+
     /* BusAttachment.cc */
     LOCK_LEVEL_BUSATTACHMENT_INTERNAL_BUSATTACHMENTSETLOCK = 40000,
 
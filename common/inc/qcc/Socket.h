@@ -364,6 +364,85 @@ QStatus RecvWithFds(SocketFd sockfd, void* buf, size_t len, size_t& received, So
  */
 QStatus SendWithFds(SocketFd sockfd, const void* buf, size_t len, size_t& sent, SocketFd* fdList, size_t numFds, uint32_t pid);
 
+/**
+ * The maximum number of buffers that can be sent with a single call to SendV().
+ */
+static const size_t SOCKET_MAX_IOVECS = 64;
+
+/**
+ * Send the contents of several buffers over a socket with a single system call.
+ * The buffers are sent in order as though they were one contiguous buffer.
+ *
+ * @param sockfd    Socket descriptor.
+ * @param iov       Array of buffers to send.
+ * @param iovLen    Number of buffers in iov.  Only the first #SOCKET_MAX_IOVECS
+ *                  buffers are sent.
+ * @param[out] sent Number of octets sent.
+ *
+ * @return
+ * - #ER_OK the send succeeded.
+ * - #ER_OS_ERROR the underlying send failed.
+ * - #ER_WOULDBLOCK sockfd is non-blocking and the underlying send would block.
+ */
+QStatus SendV(SocketFd sockfd, const IOVec* iov, size_t iovLen, size_t& sent);
+
+/**
+ * Describes one datagram in a call to SendToBatch() or RecvFromBatch().
+ */
+struct Datagram {
+    IOVec* iov;         /**< Buffers holding (or receiving) the datagram */
+    size_t iovLen;      /**< Number of entries in iov */
+    size_t len;         /**< [out] Number of octets sent or received */
+    IPAddress addr;     /**< [out] IP Address of the remote host for a received datagram */
+    uint16_t port;      /**< [out] IP Port on the remote host for a received datagram */
+};
+
+/**
+ * The maximum number of datagrams that are moved by a single call to
+ * SendToBatch() or RecvFromBatch().
+ */
+static const size_t SOCKET_MAX_DATAGRAMS = 64;
+
+/**
+ * Send several datagrams to the same remote host with as few system calls as
+ * the platform allows (sendmmsg() on Linux).  Datagrams are sent in order.
+ *
+ * @param sockfd          Socket descriptor.
+ * @param remoteAddr      IP Address of remote host.
+ * @param remotePort      IP Port on remote host.
+ * @param dgrams          Array of datagrams to send.
+ * @param count           Number of datagrams in dgrams.  At most
+ *                        #SOCKET_MAX_DATAGRAMS are sent.
+ * @param[out] sentCount  Number of datagrams sent.
+ * @param flags           SendMsgFlags to underlying sockets call (see sendmsg() in sockets API)
+ *
+ * @return
+ * - #ER_OK at least one datagram was sent.  If fewer than count were sent the
+ *          caller may retry the remainder to learn why.
+ * - #ER_OS_ERROR the underlying send failed.
+ * - #ER_WOULDBLOCK sockfd is non-blocking and the underlying send would block.
+ */
+QStatus SendToBatch(SocketFd sockfd, IPAddress& remoteAddr, uint16_t remotePort,
+                    Datagram* dgrams, size_t count, size_t& sentCount, SendMsgFlags flags = QCC_MSG_NONE);
+
+/**
+ * Receive as many pending datagrams as are available, up to count, with as
+ * few system calls as the platform allows (recvmmsg() on Linux).  This call
+ * does not block waiting for more datagrams once at least one is received.
+ *
+ * @param sockfd          Socket descriptor.
+ * @param dgrams          Array of datagrams describing the receive buffers.
+ * @param count           Number of datagrams in dgrams.  At most
+ *                        #SOCKET_MAX_DATAGRAMS are received.
+ * @param[out] recvCount  Number of datagrams received.
+ *
+ * @return
+ * - #ER_OK at least one datagram was received.
+ * - #ER_OS_ERROR the underlying receive failed.
+ * - #ER_WOULDBLOCK sockfd is non-blocking and no datagram is pending.
+ */
+QStatus RecvFromBatch(SocketFd sockfd, Datagram* dgrams, size_t count, size_t& recvCount);
+
 /**
  * Set a socket to blocking or not blocking.
  *
@@ -103,6 +103,30 @@ class Source {
         return ER_NOT_IMPLEMENTED;
     }
 
+    /**
+     * Get direct access to the unread bytes of the source without copying or consuming them.
+     * Sources that hold their contents in memory can implement this so callers can parse in place.
+     *
+     * @param buf          [OUT] Pointer to the unread bytes. Valid until the source is modified.
+     * @param availBytes   [OUT] Number of unread bytes at buf.
+     * @return   ER_OK if successful. ER_EOF if source is exhausted.
+     *           ER_NOT_IMPLEMENTED if the source does not support direct access.
+     */
+    virtual QStatus PeekBytes(const void*& buf, size_t& availBytes) {
+        QCC_UNUSED(buf);
+        QCC_UNUSED(availBytes);
+        return ER_NOT_IMPLEMENTED;
+    }
+
+    /**
+     * Consume bytes previously returned by PeekBytes().
+     *
+     * @param numBytes     Number of bytes to mark as read.
+     */
+    virtual void ConsumeBytes(size_t numBytes) {
+        QCC_UNUSED(numBytes);
+    }
+
     /**
      * Get the Event indicating that data is available when signaled.
      *
@@ -161,6 +185,24 @@ class Sink {
         return PushBytes(buf, numBytes, numSent);
     }
 
+    /**
+     * Push the contents of several buffers into the sink.  The buffers are
+     * pushed in order as though they were one contiguous buffer.  Sinks that
+     * cannot gather buffers only push (part of) the first one.
+     *
+     * @param iov          Array of buffers to push.
+     * @param iovLen       Number of buffers in iov.
+     * @param numSent      Number of bytes actually consumed by sink.
+     * @return   ER_OK if successful.
+     */
+    virtual QStatus PushBytesV(const IOVec* iov, size_t iovLen, size_t& numSent) {
+        if (iovLen == 0) {
+            numSent = 0;
+            return ER_OK;
+        }
+        return PushBytes(iov[0].buf, iov[0].len, numSent);
+    }
+
     /**
      * Push one or more byte accompanied by one or more file/socket descriptors to a sink.
      *
@@ -80,6 +80,22 @@ class StringSource : public Source {
      */
     QStatus PullBytes(void* buf, size_t reqBytes, size_t& actualBytes, uint32_t timeout = Event::WAIT_FOREVER);
 
+    /**
+     * Get direct access to the unread bytes of the source.
+     *
+     * @param buf          [OUT] Pointer to the unread bytes.
+     * @param availBytes   [OUT] Number of unread bytes at buf.
+     * @return   ER_OK if successful. ER_EOF if source is exhausted.
+     */
+    QStatus PeekBytes(const void*& buf, size_t& availBytes);
+
+    /**
+     * Consume bytes previously returned by PeekBytes().
+     *
+     * @param numBytes     Number of bytes to mark as read.
+     */
+    void ConsumeBytes(size_t numBytes) { outIdx += (std::min)(numBytes, Remaining()); }
+
     /**
      * Return the number of octets not yet read.
      *
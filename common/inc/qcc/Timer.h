@@ -67,8 +67,10 @@ class Timer {
      * @param concurrency        Dispatch up to this number of alarms concurently (using multiple threads). 0 means no limit.
      * @param prevenReentrancy   Prevent re-entrant call of AlarmTriggered.
      * @param maxAlarms          Maximum number of outstanding alarms allowed before blocking calls to AddAlarm or 0 for infinite.
+     * @param useTimingWheel     Keep pending alarms in a hierarchical timing wheel (O(1) add/remove) rather than
+     *                           an ordered set. Worthwhile for timers that hold many short-lived alarms.
      */
-    Timer(qcc::String name, bool expireOnExit = false, uint32_t concurrency = 1, bool preventReentrancy = false, uint32_t maxAlarms = 0);
+    Timer(qcc::String name, bool expireOnExit = false, uint32_t concurrency = 1, bool preventReentrancy = false, uint32_t maxAlarms = 0, bool useTimingWheel = false);
 
     /**
      * Destructor.
@@ -269,6 +269,23 @@ class XmlElement {
      * @param ctx  Parsing context.
      */
     static void FinalizeElement(XmlParseContext& ctx);
+
+    /**
+     * Make the next block of unparsed XML available in the parse context.
+     *
+     * @param ctx    Parsing context
+     * @return    ER_OK if ctx has unparsed bytes (or the source returned none without error),
+     *            ER_EOF if the source is exhausted, otherwise the source's error.
+     */
+    static QStatus FillBlock(XmlParseContext& ctx);
+
+    /**
+     * Mark bytes at the start of the current block as parsed.
+     *
+     * @param ctx       Parsing context
+     * @param numBytes  Number of bytes consumed by the parser
+     */
+    static void ConsumeBlock(XmlParseContext& ctx, size_t numBytes);
 };
 
 /**
@@ -295,7 +312,11 @@ struct XmlParseContext {
         isCommentDelim(false),
         shouldIgnore(false),
         isTextDecleration(false),
-        foundTxtDeclDelim(false) { }
+        foundTxtDeclDelim(false),
+        readBuf(NULL),
+        block(NULL),
+        blockLen(0),
+        inPlace(false) { }
 
     /** Reset state of XmlParseContext in preparation for reuse */
     void Reset();
@@ -324,6 +345,7 @@ struct XmlParseContext {
      */
     ~XmlParseContext() {
         delete root;
+        delete [] readBuf;
     }
 
   private:
@@ -373,6 +395,16 @@ struct XmlParseContext {
     bool shouldIgnore;        /**< true iff currently parsed tag is a comment */
     bool isTextDecleration;   /**< true iff currently parsed tag is a text decleration tag (<?) */
     bool foundTxtDeclDelim;   /**< true iff a question mark was found during the current pass */
+
+    /*
+     * Input is consumed a block at a time, in place for sources that support Source::PeekBytes.
+     * Bytes pulled from other sources but not yet parsed (i.e. beyond the end of a completed
+     * document) are kept here for the next call to Parse.
+     */
+    char* readBuf;            /**< Read-ahead buffer for sources without PeekBytes */
+    const char* block;        /**< Next unparsed byte */
+    size_t blockLen;          /**< Number of unparsed bytes at block */
+    bool inPlace;             /**< true iff block points into the source's own storage */
 };
 
 }
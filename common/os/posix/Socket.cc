@@ -864,6 +864,183 @@ QStatus SendWithFds(SocketFd sockfd, const void* buf, size_t len, size_t& sent,
     return status;
 }
 
+QStatus SendV(SocketFd sockfd, const IOVec* iov, size_t iovLen, size_t& sent)
+{
+    QStatus status = ER_OK;
+
+    QCC_DbgTrace(("SendV(sockfd = %d, *iov = <>, iovLen = %lu, sent = <>)", sockfd, iovLen));
+    IncrementPerfCounter(PERF_COUNTER_SOCKET_SEND);
+    QCC_ASSERT(iov != NULL);
+
+    /* IOVec matches struct iovec so it can be passed directly */
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = reinterpret_cast<struct iovec*>(const_cast<IOVec*>(iov));
+    msg.msg_iovlen = (std::min)(iovLen, SOCKET_MAX_IOVECS);
+
+    ssize_t ret = sendmsg(static_cast<int>(sockfd), &msg, MSG_NOSIGNAL);
+    if (ret == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            status = ER_WOULDBLOCK;
+        } else {
+            status = ER_OS_ERROR;
+            QCC_DbgHLPrintf(("SendV (sockfd = %u): %d - %s", sockfd, errno, strerror(errno)));
+        }
+    } else {
+        sent = static_cast<size_t>(ret);
+    }
+    return status;
+}
+
+QStatus SendToBatch(SocketFd sockfd, IPAddress& remoteAddr, uint16_t remotePort,
+                    Datagram* dgrams, size_t count, size_t& sentCount, SendMsgFlags flags)
+{
+    QStatus status = ER_OK;
+    struct sockaddr_storage addr;
+    socklen_t addrLen = sizeof(addr);
+
+    QCC_DbgTrace(("SendToBatch(sockfd = %d, remoteAddr = %s, remotePort = %u, *dgrams = <>, count = %lu, sentCount = <>, flags = 0x%x)",
+                  sockfd, remoteAddr.ToString().c_str(), remotePort, count, (int)flags));
+    IncrementPerfCounter(PERF_COUNTER_SOCKET_SENDTO);
+    QCC_ASSERT(dgrams != NULL);
+
+    sentCount = 0;
+    count = (std::min)(count, SOCKET_MAX_DATAGRAMS);
+
+    status = MakeSockAddr(remoteAddr, remotePort, 0, &addr, addrLen);
+    if (status != ER_OK) {
+        return status;
+    }
+
+#if defined(QCC_OS_LINUX)
+    struct mmsghdr msgs[SOCKET_MAX_DATAGRAMS];
+    memset(msgs, 0, count * sizeof(struct mmsghdr));
+    for (size_t i = 0; i < count; ++i) {
+        /* IOVec matches struct iovec so it can be passed directly */
+        msgs[i].msg_hdr.msg_name = &addr;
+        msgs[i].msg_hdr.msg_namelen = addrLen;
+        msgs[i].msg_hdr.msg_iov = reinterpret_cast<struct iovec*>(dgrams[i].iov);
+        msgs[i].msg_hdr.msg_iovlen = dgrams[i].iovLen;
+    }
+
+    int ret = sendmmsg(static_cast<int>(sockfd), msgs, static_cast<unsigned int>(count), (int)flags | MSG_NOSIGNAL);
+    if (ret == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            status = ER_WOULDBLOCK;
+        } else {
+            status = ER_OS_ERROR;
+            QCC_DbgHLPrintf(("SendToBatch (sockfd = %u, addr = %s, port = %u): %d - %s",
+                             sockfd, remoteAddr.ToString().c_str(), remotePort, errno, strerror(errno)));
+        }
+    } else {
+        sentCount = static_cast<size_t>(ret);
+        for (size_t i = 0; i < sentCount; ++i) {
+            dgrams[i].len = msgs[i].msg_len;
+        }
+    }
+#else
+    for (; sentCount < count; ++sentCount) {
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &addr;
+        msg.msg_namelen = addrLen;
+        msg.msg_iov = reinterpret_cast<struct iovec*>(dgrams[sentCount].iov);
+        msg.msg_iovlen = dgrams[sentCount].iovLen;
+
+        ssize_t ret = sendmsg(static_cast<int>(sockfd), &msg, (int)flags | MSG_NOSIGNAL);
+        if (ret == -1) {
+            if (sentCount == 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    status = ER_WOULDBLOCK;
+                } else {
+                    status = ER_OS_ERROR;
+                    QCC_DbgHLPrintf(("SendToBatch (sockfd = %u, addr = %s, port = %u): %d - %s",
+                                     sockfd, remoteAddr.ToString().c_str(), remotePort, errno, strerror(errno)));
+                }
+            }
+            break;
+        }
+        dgrams[sentCount].len = static_cast<size_t>(ret);
+    }
+#endif
+    QCC_DbgPrintf(("Sent %u datagrams", sentCount));
+    return status;
+}
+
+QStatus RecvFromBatch(SocketFd sockfd, Datagram* dgrams, size_t count, size_t& recvCount)
+{
+    QStatus status = ER_OK;
+    struct sockaddr_storage addrs[SOCKET_MAX_DATAGRAMS];
+
+    QCC_DbgTrace(("RecvFromBatch(sockfd = %d, *dgrams = <>, count = %lu, recvCount = <>)", sockfd, count));
+    IncrementPerfCounter(PERF_COUNTER_SOCKET_RECV_FROM);
+    QCC_ASSERT(dgrams != NULL);
+
+    recvCount = 0;
+    count = (std::min)(count, SOCKET_MAX_DATAGRAMS);
+
+#if defined(QCC_OS_LINUX)
+    struct mmsghdr msgs[SOCKET_MAX_DATAGRAMS];
+    memset(msgs, 0, count * sizeof(struct mmsghdr));
+    for (size_t i = 0; i < count; ++i) {
+        msgs[i].msg_hdr.msg_name = &addrs[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        msgs[i].msg_hdr.msg_iov = reinterpret_cast<struct iovec*>(dgrams[i].iov);
+        msgs[i].msg_hdr.msg_iovlen = dgrams[i].iovLen;
+    }
+
+    /* MSG_WAITFORONE: once one datagram has arrived do not wait for the rest */
+    int ret = recvmmsg(static_cast<int>(sockfd), msgs, static_cast<unsigned int>(count), MSG_WAITFORONE, NULL);
+    if (ret == -1) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            status = ER_WOULDBLOCK;
+        } else {
+            status = ER_OS_ERROR;
+            QCC_DbgHLPrintf(("RecvFromBatch (sockfd = %u): %d - %s", sockfd, errno, strerror(errno)));
+        }
+    } else {
+        recvCount = static_cast<size_t>(ret);
+        for (size_t i = 0; i < recvCount; ++i) {
+            dgrams[i].len = msgs[i].msg_len;
+            /* A burst usually comes from a single peer; skip the address conversion for repeats */
+            if ((i > 0) && (msgs[i].msg_hdr.msg_namelen == msgs[i - 1].msg_hdr.msg_namelen) &&
+                (memcmp(&addrs[i], &addrs[i - 1], msgs[i].msg_hdr.msg_namelen) == 0)) {
+                dgrams[i].addr = dgrams[i - 1].addr;
+                dgrams[i].port = dgrams[i - 1].port;
+            } else {
+                GetSockAddr(&addrs[i], msgs[i].msg_hdr.msg_namelen, dgrams[i].addr, dgrams[i].port);
+            }
+        }
+    }
+#else
+    for (; recvCount < count; ++recvCount) {
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = &addrs[recvCount];
+        msg.msg_namelen = sizeof(addrs[recvCount]);
+        msg.msg_iov = reinterpret_cast<struct iovec*>(dgrams[recvCount].iov);
+        msg.msg_iovlen = dgrams[recvCount].iovLen;
+
+        ssize_t ret = recvmsg(static_cast<int>(sockfd), &msg, (recvCount == 0) ? 0 : MSG_DONTWAIT);
+        if (ret == -1) {
+            if (recvCount == 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    status = ER_WOULDBLOCK;
+                } else {
+                    status = ER_OS_ERROR;
+                    QCC_DbgHLPrintf(("RecvFromBatch (sockfd = %u): %d - %s", sockfd, errno, strerror(errno)));
+                }
+            }
+            break;
+        }
+        dgrams[recvCount].len = static_cast<size_t>(ret);
+        GetSockAddr(&addrs[recvCount], msg.msg_namelen, dgrams[recvCount].addr, dgrams[recvCount].port);
+    }
+#endif
+    QCC_DbgPrintf(("Received %u datagrams", recvCount));
+    return status;
+}
+
 QStatus SocketPair(SocketFd(&sockets)[2])
 {
     QStatus status = ER_OK;
@@ -815,6 +815,120 @@ QStatus SendWithFds(SocketFd sockfd, const void* buf, size_t len, size_t& sent,
     return status;
 }
 
+QStatus SendV(SocketFd sockfd, const IOVec* iov, size_t iovLen, size_t& sent)
+{
+    QStatus status = ER_OK;
+
+    QCC_DbgTrace(("SendV(sockfd = %d, *iov = <>, iovLen = %lu, sent = <>)", sockfd, iovLen));
+    IncrementPerfCounter(PERF_COUNTER_SOCKET_SEND);
+    QCC_ASSERT(iov != NULL);
+
+    /* IOVec matches WSABUF so it can be passed directly */
+    WSABUF* bufs = reinterpret_cast<WSABUF*>(const_cast<IOVec*>(iov));
+    iovLen = std::min(iovLen, SOCKET_MAX_IOVECS);
+
+    DWORD ret = 0;
+    if (WSASend(static_cast<SOCKET>(sockfd), bufs, static_cast<DWORD>(iovLen), &ret, 0, NULL, NULL) == SOCKET_ERROR) {
+        if (WSAGetLastError() == WSAEWOULDBLOCK) {
+            sent = 0;
+            status = ER_WOULDBLOCK;
+        } else {
+            status = ER_OS_ERROR;
+            QCC_DbgHLPrintf(("SendV: %s", GetLastErrorString().c_str()));
+        }
+    } else {
+        sent = static_cast<size_t>(ret);
+        QCC_DbgPrintf(("Sent %u bytes", sent));
+    }
+    return status;
+}
+
+QStatus SendToBatch(SocketFd sockfd, IPAddress& remoteAddr, uint16_t remotePort,
+                    Datagram* dgrams, size_t count, size_t& sentCount, SendMsgFlags flags)
+{
+    QStatus status = ER_OK;
+    SOCKADDR_STORAGE addr;
+    socklen_t addrLen = sizeof(addr);
+
+    QCC_DbgTrace(("SendToBatch(sockfd = %d, remoteAddr = %s, remotePort = %u, *dgrams = <>, count = %lu, sentCount = <>, flags = 0x%x)",
+                  sockfd, remoteAddr.ToString().c_str(), remotePort, count, (int)flags));
+    IncrementPerfCounter(PERF_COUNTER_SOCKET_SENDTO);
+    QCC_ASSERT(dgrams != NULL);
+
+    sentCount = 0;
+    count = std::min(count, SOCKET_MAX_DATAGRAMS);
+    MakeSockAddr(remoteAddr, remotePort, &addr, addrLen);
+
+    /* Windows has no multi-datagram send so this is one WSASendTo() per datagram */
+    for (; sentCount < count; ++sentCount) {
+        /* IOVec matches WSABUF so it can be passed directly */
+        WSABUF* bufs = reinterpret_cast<WSABUF*>(dgrams[sentCount].iov);
+        DWORD ret = 0;
+        if (WSASendTo(static_cast<SOCKET>(sockfd), bufs, static_cast<DWORD>(dgrams[sentCount].iovLen), &ret, (int)flags,
+                      reinterpret_cast<struct sockaddr*>(&addr), addrLen, NULL, NULL) == SOCKET_ERROR) {
+            if (sentCount == 0) {
+                if (WSAGetLastError() == WSAEWOULDBLOCK) {
+                    status = ER_WOULDBLOCK;
+                } else {
+                    status = ER_OS_ERROR;
+                    QCC_DbgHLPrintf(("SendToBatch: %s", GetLastErrorString().c_str()));
+                }
+            }
+            break;
+        }
+        dgrams[sentCount].len = static_cast<size_t>(ret);
+    }
+    QCC_DbgPrintf(("Sent %u datagrams", sentCount));
+    return status;
+}
+
+QStatus RecvFromBatch(SocketFd sockfd, Datagram* dgrams, size_t count, size_t& recvCount)
+{
+    QStatus status = ER_OK;
+
+    QCC_DbgTrace(("RecvFromBatch(sockfd = %d, *dgrams = <>, count = %lu, recvCount = <>)", sockfd, count));
+    IncrementPerfCounter(PERF_COUNTER_SOCKET_RECV_FROM);
+    QCC_ASSERT(dgrams != NULL);
+
+    recvCount = 0;
+    count = std::min(count, SOCKET_MAX_DATAGRAMS);
+
+    /*
+     * Windows has no multi-datagram receive so this is one WSARecvFrom() per
+     * datagram.  Only the first may block; after that stop as soon as the
+     * socket has nothing pending.
+     */
+    for (; recvCount < count; ++recvCount) {
+        if (recvCount > 0) {
+            u_long pending = 0;
+            if ((ioctlsocket(static_cast<SOCKET>(sockfd), FIONREAD, &pending) == SOCKET_ERROR) || (pending == 0)) {
+                break;
+            }
+        }
+        SOCKADDR_STORAGE fromAddr;
+        INT addrLen = sizeof(fromAddr);
+        WSABUF* bufs = reinterpret_cast<WSABUF*>(dgrams[recvCount].iov);
+        DWORD ret = 0;
+        DWORD recvFlags = 0;
+        if (WSARecvFrom(static_cast<SOCKET>(sockfd), bufs, static_cast<DWORD>(dgrams[recvCount].iovLen), &ret, &recvFlags,
+                        reinterpret_cast<struct sockaddr*>(&fromAddr), &addrLen, NULL, NULL) == SOCKET_ERROR) {
+            if (recvCount == 0) {
+                if (WSAGetLastError() == WSAEWOULDBLOCK) {
+                    status = ER_WOULDBLOCK;
+                } else {
+                    status = ER_OS_ERROR;
+                    QCC_DbgHLPrintf(("RecvFromBatch: %s", GetLastErrorString().c_str()));
+                }
+            }
+            break;
+        }
+        dgrams[recvCount].len = static_cast<size_t>(ret);
+        GetSockAddr(&fromAddr, addrLen, dgrams[recvCount].addr, dgrams[recvCount].port);
+    }
+    QCC_DbgPrintf(("Received %u datagrams", recvCount));
+    return status;
+}
+
 QStatus SocketPair(SocketFd(&sockets)[2])
 {
     QStatus status = ER_OK;
@@ -0,0 +1,325 @@
+/**
+ * @file CertificateCache.cc
+ *
+ * Process-wide cache of decoded and verified certificates
+ */
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#include <qcc/platform.h>
+#include <qcc/CertificateCache.h>
+#include <qcc/Crypto.h>
+#include <qcc/Mutex.h>
+#include <qcc/LockLevel.h>
+#include <qcc/Util.h>
+
+#include <list>
+#include <map>
+#include <new>
+#include <vector>
+
+#include <Status.h>
+
+#define QCC_MODULE "CRYPTO"
+
+using namespace std;
+
+namespace qcc {
+
+class CertificateCacheImpl {
+  public:
+
+    struct Verification {
+        ECCPublicKey issuerKey;
+        QStatus status;
+    };
+
+    struct Entry {
+        qcc::String digest;
+        bool decoded;
+        CertificateX509::CertificateType presetType;
+        CertificateX509 cert;
+        vector<Verification> verifications;
+
+        Entry(const qcc::String& digest) : digest(digest), decoded(false), presetType(CertificateX509::UNRESTRICTED_CERTIFICATE)
+        {
+        }
+    };
+
+    typedef list<Entry> EntryList;
+    typedef map<qcc::String, EntryList::iterator> EntryIndex;
+
+    CertificateCacheImpl() : capacity(CertificateCache::DEFAULT_CAPACITY), lock(LOCK_LEVEL_CERTIFICATECACHE_LOCK)
+    {
+    }
+
+    /**
+     * Find an entry and mark it as the most recently used.  The lock must be
+     * held.
+     */
+    Entry* Find(const qcc::String& digest)
+    {
+        EntryIndex::iterator it = index.find(digest);
+        if (it == index.end()) {
+            return nullptr;
+        }
+        entries.splice(entries.begin(), entries, it->second);
+        return &entries.front();
+    }
+
+    /**
+     * Find an entry or add an empty one, evicting the least recently used
+     * entries to stay within the capacity.  The lock must be held.
+     */
+    Entry* FindOrAdd(const qcc::String& digest)
+    {
+        Entry* entry = Find(digest);
+        if (entry || (capacity == 0)) {
+            return entry;
+        }
+        Trim(capacity - 1);
+        entries.push_front(Entry(digest));
+        index[digest] = entries.begin();
+        return &entries.front();
+    }
+
+    /**
+     * Evict the least recently used entries until at most maxEntries are
+     * left.  The lock must be held.
+     */
+    void Trim(size_t maxEntries)
+    {
+        while (entries.size() > maxEntries) {
+            index.erase(entries.back().digest);
+            entries.pop_back();
+        }
+    }
+
+    EntryList entries;
+    EntryIndex index;
+    size_t capacity;
+    Mutex lock;
+};
+
+/**
+ * The one and only certificate cache instance.
+ */
+static uint64_t _certificateCache[RequiredArrayLength(sizeof(CertificateCacheImpl), uint64_t)];
+static volatile bool initialized = false;
+
+static CertificateCacheImpl& certificateCache = (CertificateCacheImpl&)_certificateCache;
+
+void CertificateCache::Init()
+{
+    if (!initialized) {
+        new (&certificateCache)CertificateCacheImpl();
+        initialized = true;
+    }
+}
+
+void CertificateCache::Shutdown()
+{
+    if (initialized) {
+        initialized = false;
+        certificateCache.~CertificateCacheImpl();
+    }
+}
+
+static QStatus ComputeDigest(const qcc::String& der, qcc::String& digest)
+{
+    uint8_t buf[Crypto_SHA256::DIGEST_SIZE];
+    Crypto_SHA256 hash;
+    QStatus status = hash.Init();
+    if (ER_OK != status) {
+        return status;
+    }
+    status = hash.Update((const uint8_t*) der.data(), der.size());
+    if (ER_OK != status) {
+        return status;
+    }
+    status = hash.GetDigest(buf);
+    if (ER_OK != status) {
+        return status;
+    }
+    digest.assign_std((const char*) buf, sizeof(buf));
+    return ER_OK;
+}
+
+QStatus AJ_CALL CertificateCache::GetCertificateDigest(const CertificateX509& cert, uint8_t* digest)
+{
+    qcc::String der;
+    QStatus status = cert.EncodeCertificateDER(der);
+    if (ER_OK != status) {
+        return status;
+    }
+    qcc::String str;
+    status = ComputeDigest(der, str);
+    if (ER_OK != status) {
+        return status;
+    }
+    memcpy(digest, str.data(), str.size());
+    return ER_OK;
+}
+
+QStatus AJ_CALL CertificateCache::DecodeCertificateDER(const qcc::String& der, CertificateX509& cert)
+{
+    qcc::String digest;
+    if (!initialized || (ER_OK != ComputeDigest(der, digest))) {
+        return cert.DecodeCertificateDER(der);
+    }
+    /*
+     * A certificate without an EKU keeps the type it was constructed with,
+     * so only reuse a copy decoded from the same starting point.
+     */
+    CertificateX509::CertificateType presetType = cert.GetType();
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    CertificateCacheImpl::Entry* entry = certificateCache.Find(digest);
+    if (entry && entry->decoded && (entry->presetType == presetType)) {
+        cert = entry->cert;
+        certificateCache.lock.Unlock(MUTEX_CONTEXT);
+        return ER_OK;
+    }
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+
+    CertificateX509 decoded(presetType);
+    QStatus status = decoded.DecodeCertificateDER(der);
+    if (ER_OK != status) {
+        return status;
+    }
+    cert = decoded;
+
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    entry = certificateCache.FindOrAdd(digest);
+    if (entry) {
+        entry->cert = decoded;
+        entry->decoded = true;
+        entry->presetType = presetType;
+    }
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+    return ER_OK;
+}
+
+bool AJ_CALL CertificateCache::LookupVerification(const uint8_t* digest, const ECCPublicKey* issuerKey, QStatus& status)
+{
+    if (!initialized) {
+        return false;
+    }
+    bool found = false;
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    CertificateCacheImpl::Entry* entry = certificateCache.Find(qcc::String((const char*) digest, Crypto_SHA256::DIGEST_SIZE));
+    if (entry) {
+        for (size_t i = 0; i < entry->verifications.size(); i++) {
+            if (entry->verifications[i].issuerKey == *issuerKey) {
+                status = entry->verifications[i].status;
+                found = true;
+                break;
+            }
+        }
+    }
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+    return found;
+}
+
+void AJ_CALL CertificateCache::StoreVerification(const uint8_t* digest, const ECCPublicKey* issuerKey, QStatus status)
+{
+    if (!initialized) {
+        return;
+    }
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    CertificateCacheImpl::Entry* entry = certificateCache.FindOrAdd(qcc::String((const char*) digest, Crypto_SHA256::DIGEST_SIZE));
+    if (entry) {
+        vector<CertificateCacheImpl::Verification>& verifications = entry->verifications;
+        size_t i = 0;
+        while ((i < verifications.size()) && !(verifications[i].issuerKey == *issuerKey)) {
+            i++;
+        }
+        if (i == verifications.size()) {
+            if (verifications.size() == MAX_ISSUERS_PER_ENTRY) {
+                verifications.erase(verifications.begin());
+            }
+            verifications.push_back(CertificateCacheImpl::Verification());
+            i = verifications.size() - 1;
+            verifications[i].issuerKey = *issuerKey;
+        }
+        verifications[i].status = status;
+    }
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+}
+
+QStatus AJ_CALL CertificateCache::Verify(const CertificateX509& cert, const ECCPublicKey* issuerKey)
+{
+    if (issuerKey->empty()) {
+        return ER_FAIL;
+    }
+    uint8_t digest[Crypto_SHA256::DIGEST_SIZE];
+    if (!initialized || (ER_OK != GetCertificateDigest(cert, digest))) {
+        return cert.Verify(issuerKey);
+    }
+    QStatus status;
+    if (LookupVerification(digest, issuerKey, status)) {
+        return status;
+    }
+    status = cert.Verify(issuerKey);
+    StoreVerification(digest, issuerKey, status);
+    return status;
+}
+
+void AJ_CALL CertificateCache::Clear()
+{
+    if (!initialized) {
+        return;
+    }
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    certificateCache.Trim(0);
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+}
+
+void AJ_CALL CertificateCache::SetCapacity(size_t capacity)
+{
+    if (!initialized) {
+        return;
+    }
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    certificateCache.capacity = capacity;
+    certificateCache.Trim(capacity);
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+}
+
+size_t AJ_CALL CertificateCache::GetSize()
+{
+    if (!initialized) {
+        return 0;
+    }
+    certificateCache.lock.Lock(MUTEX_CONTEXT);
+    size_t size = certificateCache.entries.size();
+    certificateCache.lock.Unlock(MUTEX_CONTEXT);
+    return size;
+}
+
+}
@@ -1185,6 +1185,20 @@ QStatus CertificateX509::Verify(const ECCPublicKey* key) const
     return ecc.DSAVerify((const uint8_t*) tbs.data(), tbs.size(), &signature);
 }
 
+QStatus CertificateX509::GetTBSDigest(uint8_t* digest) const
+{
+    Crypto_SHA256 hash;
+    QStatus status = hash.Init();
+    if (ER_OK != status) {
+        return status;
+    }
+    status = hash.Update((const uint8_t*) tbs.data(), tbs.size());
+    if (ER_OK != status) {
+        return status;
+    }
+    return hash.GetDigest(digest);
+}
+
 QStatus CertificateX509::Verify(const KeyInfoNISTP256& ta) const
 {
     QStatus status;
@@ -34,10 +34,13 @@
 
 #include <qcc/platform.h>
 #include <qcc/Crypto.h>
+#include <qcc/CertificateCache.h>
+#include <qcc/CertificateECC.h>
 #include <qcc/CertificateHelper.h>
 #include <qcc/String.h>
 #include <qcc/StringUtil.h>
 #include <qcc/Util.h>
+#include <vector>
 
 #include <Status.h>
 
@@ -79,4 +82,62 @@ QStatus AJ_CALL CertificateHelper::GetCertCount(const String& encoded, size_t* c
                                        "-----BEGIN CERTIFICATE-----", "-----END CERTIFICATE-----", count);
 }
 
+QStatus AJ_CALL CertificateHelper::VerifyCertChainSignatures(const CertificateX509* certs, size_t count)
+{
+    if (count < 2) {
+        return ER_OK;
+    }
+
+    /*
+     * Links verified before are answered from the certificate cache; the
+     * rest are verified in one batch and their results remembered.
+     */
+    std::vector<uint8_t> certDigests((count - 1) * Crypto_SHA256::DIGEST_SIZE);
+    std::vector<uint8_t> digests((count - 1) * Crypto_SHA256::DIGEST_SIZE);
+    std::vector<Crypto_ECC::DSAVerifyEntry> entries;
+    std::vector<size_t> links;
+    entries.reserve(count - 1);
+    links.reserve(count - 1);
+    for (size_t cnt = 0; cnt < (count - 1); cnt++) {
+        const ECCPublicKey* issuerKey = certs[cnt + 1].GetSubjectPublicKey();
+        if (issuerKey->empty()) {
+            return ER_FAIL;
+        }
+        uint8_t* certDigest = &certDigests[cnt * Crypto_SHA256::DIGEST_SIZE];
+        QStatus status = CertificateCache::GetCertificateDigest(certs[cnt], certDigest);
+        if (ER_OK != status) {
+            return status;
+        }
+        QStatus cached;
+        if (CertificateCache::LookupVerification(certDigest, issuerKey, cached)) {
+            if (ER_OK != cached) {
+                return cached;
+            }
+            continue;
+        }
+        uint8_t* digest = &digests[cnt * Crypto_SHA256::DIGEST_SIZE];
+        status = certs[cnt].GetTBSDigest(digest);
+        if (ER_OK != status) {
+            return status;
+        }
+        Crypto_ECC::DSAVerifyEntry entry;
+        entry.publicKey = issuerKey;
+        entry.digest = digest;
+        entry.len = Crypto_SHA256::DIGEST_SIZE;
+        entry.sig = certs[cnt].GetSignature();
+        entry.status = ER_OK;
+        entries.push_back(entry);
+        links.push_back(cnt);
+    }
+    if (entries.empty()) {
+        return ER_OK;
+    }
+
+    QStatus status = Crypto_ECC::DSAVerifyDigestBatch(&entries[0], entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        CertificateCache::StoreVerification(&certDigests[links[i] * Crypto_SHA256::DIGEST_SIZE], entries[i].publicKey, entries[i].status);
+    }
+    return status;
+}
+
 }
@@ -0,0 +1,1396 @@
+/**
+ * @file
+ * Fixed-base scalar multiplication k*G on NIST P-256 using a precomputed table.
+ */
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <qcc/Util.h>
+#include <qcc/CryptoECC.h>
+#include <qcc/CryptoECCp256.h>
+
+namespace qcc {
+
+#ifndef QCC_ECC_NO_FIXEDBASE_TABLE
+
+#define W_FIXEDBASE 5   /* Window size of the fixed-base table.  The table holds FIXEDBASE_ROWS * 2^(W_FIXEDBASE-2) affine points (~33 KB for w=5). */
+
+/* Number of digits in the fixed window representation of a 256-bit scalar. */
+#define FIXEDBASE_ROWS (((sizeof(digit256_t) * 8) + W_FIXEDBASE - 2) / (W_FIXEDBASE - 1) + 1)
+
+/* Number of points per table row. */
+#define FIXEDBASE_COLS (1 << (W_FIXEDBASE - 2))
+
+/*
+ * Rows from this index on may hit exceptional cases of the mixed addition (the
+ * running sum can reach the size of the group order), so they are added with
+ * the complete addition instead.
+ */
+#define FIXEDBASE_FIRST_COMPLETE_ROW ((256 - 1) / (W_FIXEDBASE - 1) - 1)
+
+/*
+ * Precomputed table for the generator of P-256.  Row i, column j holds the
+ * affine point (2j+1) * 2^((W_FIXEDBASE-1)*i) * G, so that the digits produced by
+ * fixed_window_recode() select one point per row and no doublings are needed.
+ */
+static const ecpoint_t P256_FIXEDBASE_TABLE[FIXEDBASE_ROWS][FIXEDBASE_COLS] = {
+    {   /* 0: (2j+1)*2^0*G */
+        { { 0xF4A13945D898C296ULL, 0x77037D812DEB33A0ULL, 0xF8BCE6E563A440F2ULL, 0x6B17D1F2E12C4247ULL },
+          { 0xCBB6406837BF51F5ULL, 0x2BCE33576B315ECEULL, 0x8EE7EB4A7C0F9E16ULL, 0x4FE342E2FE1A7F9BULL } },
+        { { 0xFB41661BC6E7FD6CULL, 0xE6C6B721EFADA985ULL, 0xC8F7EF951D4BF165ULL, 0x5ECBE4D1A6330A44ULL },
+          { 0x9A79B127A27D5032ULL, 0xD82AB036384FB83DULL, 0x374B06CE1A64A2ECULL, 0x8734640C4998FF7EULL } },
+        { { 0x21554A0DC3D033EDULL, 0xEF8C82FD1F5BE524ULL, 0xD784C85608668FDFULL, 0x51590B7A515140D2ULL },
+          { 0xD1D0BB44FDA16DA4ULL, 0x0D012F00D4D80888ULL, 0x8AE1BF36BF8A7926ULL, 0xE0C17DA8904A727DULL } },
+        { { 0x300628703187B2A3ULL, 0x7EF9F8B8A80FEF5BULL, 0x25BB30667C01FB60ULL, 0x8E533B6FA0BF7B46ULL },
+          { 0xC55E1A86C1F400B4ULL, 0x53C73633CB041B21ULL, 0x6D069F83A6F59000ULL, 0x73EB1DBDE0331836ULL } },
+        { { 0xD79E8A4B90949EE0ULL, 0x9E0ACB8C2C6DF8B3ULL, 0x878938D51D71F872ULL, 0xEA68D7B6FEDF0B71ULL },
+          { 0xE85A224A4DD048FAULL, 0x4D714FEAA4DE823FULL, 0x87014A964A8EA0C8ULL, 0x2A2744C972C9FCE7ULL } },
+        { { 0x433391D374BC21D1ULL, 0x16742ED0255048BFULL, 0x0638379DB0C21CDAULL, 0x3ED113B7883B4C59ULL },
+          { 0xE2F8EEFCE82A3740ULL, 0x090D04DA5E9889DAULL, 0x24C843AFA4F4C68AULL, 0x9099209ACCC4C8A2ULL } },
+        { { 0x98E15D9D46072C01ULL, 0x792E284B65EAD58AULL, 0x61805DF2D85EE2FCULL, 0x177C837AE0AC495AULL },
+          { 0x9C43BBE2EFC7BFD8ULL, 0x26EE14C3A1FB4DF3ULL, 0xA24091ADB40F4E72ULL, 0x63BB58CD4EBEA558ULL } },
+        { { 0x63668C63E59B9D5FULL, 0xAE03AF92DE3A0EF1ULL, 0xADFB378999888265ULL, 0xF0454DC6971ABAE7ULL },
+          { 0x47E59CDE0D034F36ULL, 0x2A3B21CE75B5FA3FULL, 0x4E6594E51F9643E6ULL, 0xB5B93EE3592E2D1FULL } }
+    },
+    {   /* 1: (2j+1)*2^4*G */
+        { { 0xA5EB4787E1277C6EULL, 0xCD28392EFF6CA038ULL, 0x8B821C629836315FULL, 0x76A94D138A6B4185ULL },
+          { 0x0E9DDD724B8C5110ULL, 0x8599A0040FC78BAAULL, 0x6CB0A1B5E11E8720ULL, 0xA985FE61341F260EULL } },
+        { { 0xABFB9DC69E4536CAULL, 0x1C2E92960A201A61ULL, 0x8CCE745BE070CDA1ULL, 0x9482FB0E492539ECULL },
+          { 0x1FAD863BF58CC1C8ULL, 0xF63D5E295707BFBBULL, 0x1A5D638CA7534E63ULL, 0x351D9CA745F157F9ULL } },
+        { { 0x49B1DAE295ECFF13ULL, 0x63764A1CDBD0633CULL, 0x5B835A5153081EEBULL, 0xB2E1B7C17AE93119ULL },
+          { 0xA3BA4989B2187D44ULL, 0x87DA1A9817DEA2E6ULL, 0xF233A1A2AAD758C3ULL, 0xE6C0441313A3EBCCULL } },
+        { { 0x38BBB334EEF87286ULL, 0x0703E87DFC2309E4ULL, 0xCB34177DCBC6EE34ULL, 0xB433462E7F1B6BC2ULL },
+          { 0x7AC047F6841496D9ULL, 0x9DCE20806A2CEA4BULL, 0x383F4E72C1692E6FULL, 0xA0DA54526ED2B5FEULL } },
+        { { 0x1B986B5B19794381ULL, 0x189158875EB0C760ULL, 0xC186E905B5567B19ULL, 0xA47420CE4D3DA24CULL },
+          { 0x696CE3A7E2769C52ULL, 0xF3A5C08DB9F6AC78ULL, 0xE73DF93619967AFFULL, 0x2EBBFFDF7BE1BFE0ULL } },
+        { { 0xEC74466489A5185AULL, 0x5B870AC89F5E6F2BULL, 0x5FECD4012B0DA319ULL, 0x05BA7A19B9D09148ULL },
+          { 0x1543C88E01DE3A4EULL, 0x7606220BC905AE00ULL, 0xE467823E24E3D48EULL, 0x30E0D2B5E82C1896ULL } },
+        { { 0x5AA398B5F99B85FEULL, 0x9C0EFE9AAE3A5DFDULL, 0x69798D918083E0B7ULL, 0xB29F74C9D0DFE2FDULL },
+          { 0xDBA642976DA604DCULL, 0x2DEF63D30BF59E80ULL, 0xD5D0712E96D7C6D9ULL, 0xA3CE5BC3A6C29785ULL } },
+        { { 0x2767456E87E030EFULL, 0x576B2B057CD50E96ULL, 0x076CBF03F2482B08ULL, 0x99299BAA8B91BCF5ULL },
+          { 0x4D8E6B7DD8D9AA9AULL, 0x57C12C499F400844ULL, 0xBF338101A6CEAA79ULL, 0x5CC2E3D3333F8E18ULL } }
+    },
+    {   /* 2: (2j+1)*2^8*G */
+        { { 0x2DB2E35F12D0441BULL, 0x190D0B710D6A564CULL, 0x87FFD1528603ED61ULL, 0x34A2D4A3B0091659ULL },
+          { 0xB424E7845E93B146ULL, 0xE7D766B9DEDDD81DULL, 0x2BCA71046E777FC0ULL, 0xBEAAED6A53A1E3C2ULL } },
+        { { 0xDCE4AE33BDA08424ULL, 0x3ABFB7AB74F644A9ULL, 0x1B58C5FFA95D23EDULL, 0xA98B0A07ADC359AAULL },
+          { 0x361287A0E831800CULL, 0x752BE80BA0DF582DULL, 0xE5319E8C8E1D1320ULL, 0x4754C64722499B66ULL } },
+        { { 0xB52D7E5E883C2D6AULL, 0xD22F918D81BD29B3ULL, 0xD21B6B78C85A696DULL, 0xA034F009C88DAAC5ULL },
+          { 0xF4336EF2C2C30E72ULL, 0xBE06035F16267E7CULL, 0xB0CDB8545CECEB06ULL, 0xFE1B0036CA899C1FULL } },
+        { { 0x716A51DD28BE8C78ULL, 0x4A096CF82B793E4DULL, 0xA076E2B40962E9A1ULL, 0xB52226FF319D4401ULL },
+          { 0x203367CA51686903ULL, 0x819F7FC8E5B58FF3ULL, 0xCA1B36697E92851AULL, 0x701EE0C9F539F540ULL } },
+        { { 0x7040FE40A058B5A4ULL, 0xDE4464F87931979BULL, 0xD968CECCFCCC4713ULL, 0xA3E38861868E05B3ULL },
+          { 0x8F306D90E7113AEFULL, 0x3CEE845BB771A294ULL, 0x3848E6B3AE97E68FULL, 0xCFD457887DF0D12CULL } },
+        { { 0xA05F5EC904A08314ULL, 0x82FE36DB2DC7DFF7ULL, 0x333CCAB9A221197AULL, 0x2099544A131FA539ULL },
+          { 0xE7F8C9C5E7573CCCULL, 0xD406E5A736FCFE96ULL, 0x90FBA8E5CB9048DFULL, 0xA5CF3DFD2AA33B18ULL } },
+        { { 0x502FF94AE9078C18ULL, 0x99E0C3CAEEEDE929ULL, 0x308F6E72AADFD39BULL, 0x751D6513ACC0EC70ULL },
+          { 0x998D6E95CECE0D67ULL, 0xF00948C1CBE05AC7ULL, 0x85354BAF6A2A2A4EULL, 0xBA9C3FFDCA4A4158ULL } },
+        { { 0x92CFCD5C9E86D900ULL, 0x405EE09D17A3DB44ULL, 0x17B48308A03A3B36ULL, 0x5BE0F5225C478011ULL },
+          { 0xC4CDD69BF58A5755ULL, 0xF921725241B34F5AULL, 0xD347E3A4E7B5423DULL, 0x83D1D9E6DFF2C422ULL } }
+    },
+    {   /* 3: (2j+1)*2^12*G */
+        { { 0xF077E8DAA245573FULL, 0x508676F2F4FD0A64ULL, 0x997789672E6D6BD2ULL, 0xE716AED2CF069E4DULL },
+          { 0x505FC26B469218D1ULL, 0xD13D0DF2FA07C9B3ULL, 0x5912B06687B9A851ULL, 0x353663E694FC72ABULL } },
+        { { 0x7F987930657008ACULL, 0x19CE1ECEE329EDFBULL, 0x64E5558A4C1DA22DULL, 0xD2BF898D6F507CE8ULL },
+          { 0x8111534A727BEB55ULL, 0x679CE10AB5FF0798ULL, 0x3F8195DB3FA90C56ULL, 0x69C0B1CB5A6B77AAULL } },
+        { { 0xFD0D7CA9782F1580ULL, 0xB0E4DDEE24203EB7ULL, 0x87FA57391F3064F8ULL, 0x4D88304EE583CE60ULL },
+          { 0x0C0FB16D5616EDD7ULL, 0xAAFCA3BD68EB1E11ULL, 0xE8D6800898FD6518ULL, 0x28A94E709AB0636CULL } },
+        { { 0x5F84C3DAE0C38E11ULL, 0x7156421BEA6E26BAULL, 0x3267399202E5AF9EULL, 0x17C72727C8FC0EEBULL },
+          { 0xCD8366BBAE90DECDULL, 0x7E539945A60CDAE3ULL, 0x40602FCCE901802EULL, 0x95C5A4F4FE664B3CULL } },
+        { { 0xD955FD8AE32F36EAULL, 0xCD4F46A7293541C3ULL, 0x8463B1CFC84CB8B3ULL, 0x7E03FDAAC47450A8ULL },
+          { 0x8ACC23FC8A68B8AFULL, 0x419E979A4C5009D6ULL, 0x668E6B170184AF99ULL, 0xDCF6D5F1201228DAULL } },
+        { { 0xD43E52A6D953BAA9ULL, 0x2615AE8649E18DE8ULL, 0x61637AC1DCA0B214ULL, 0x8CE6DA684B1BCF07ULL },
+          { 0x78E75C28F52689E5ULL, 0x07F3986BB6A9341DULL, 0xE69B3BC90061B568ULL, 0x3D9F4FB8FA93120BULL } },
+        { { 0x4AB8D853AF22A96AULL, 0x08B1BA9D9C6AB8F9ULL, 0x20A5354975BAE2B0ULL, 0xB570E73040DC054AULL },
+          { 0xCB33F661C85D1B00ULL, 0xA7C9BB7A5855CC9CULL, 0x028C3769B5C0CFBDULL, 0xDCD8A2638F71E77FULL } },
+        { { 0x9E40EB94589A7509ULL, 0xE1270B9641FA8054ULL, 0x04A11A3E75C7F20DULL, 0x44D94323CBAB943BULL },
+          { 0xE20A2B9B60437234ULL, 0x6F93E1FDF14DD126ULL, 0x03423BCD277B9358ULL, 0xB2C5B38008401F0AULL } }
+    },
+    {   /* 4: (2j+1)*2^16*G */
+        { { 0x03E8465C6EADE3C4ULL, 0x714AB749C9052A05ULL, 0x8E5C643340E586B4ULL, 0xA018366F4E91E90DULL },
+          { 0xF45C42026B26E8D0ULL, 0xD5F7284E44614F37ULL, 0x7C6CE578349D8369ULL, 0xE2BBEC1714110B16ULL } },
+        { { 0x6E1CDEAC59E0AF06ULL, 0x92F398A562ED958DULL, 0x50BD3B5A6D45055CULL, 0x9CDF1F00B88D8964ULL },
+          { 0x8D7A32DB6216ADE7ULL, 0x828522DC197CA546ULL, 0x4D958BBCDC8D94B0ULL, 0x916D25FED3F2AD66ULL } },
+        { { 0x81372B939305097EULL, 0x38D6170E843BA519ULL, 0xAB6B1B2D05404483ULL, 0x45BFD9D5D1A663EDULL },
+          { 0x54BA058E908DDC04ULL, 0x683B9D33BFD2C159ULL, 0xBAD88305470CE908ULL, 0x09D1DC12855AFD2BULL } },
+        { { 0xCD31F1A0B63BD6DFULL, 0xD1FC23C2DD66AEC3ULL, 0x671E9F9C02895E6FULL, 0xB599AD156476693BULL },
+          { 0x8EA1CEA38EFA09ACULL, 0x6A40C4F691134B45ULL, 0x4637360B8B23C416ULL, 0x6979D1DEC4FAB332ULL } },
+        { { 0xAF8613F327142D62ULL, 0x1D9A6A35F83BC26DULL, 0x92662B1227E854C1ULL, 0xF4DCA1F16732AC0EULL },
+          { 0xAC9ECCC07A618FC9ULL, 0xBB979ACEFDCD3D7FULL, 0xD49F381B91ABC659ULL, 0x551167E5B4B4CD46ULL } },
+        { { 0x1ECB1FF4615FAE61ULL, 0x7F15C7DC4F395F82ULL, 0xD9C4E240E716BB5AULL, 0xF07278A0E6E09B66ULL },
+          { 0xF7D0CB74896376F9ULL, 0x2C270715B837EABCULL, 0xF7D7A0821898F7D4ULL, 0x1A681B2B14A71EA5ULL } },
+        { { 0x0C4E04152466591FULL, 0xBE172EA8FFC68D6AULL, 0xF143AB533BA858CCULL, 0x1FC52457AF0A0DB0ULL },
+          { 0x44EFEF57396F8CDBULL, 0x29F8CAC232EC7822ULL, 0xE9EC76FE5B434E16ULL, 0x489C1838089EBC11ULL } },
+        { { 0x125D0B8C322A8EBCULL, 0xA291CDB718F96715ULL, 0xFD7F0B5B30CA56D5ULL, 0xFA2501B31A48C5F4ULL },
+          { 0x80D927B5AA8A775BULL, 0xEA58E08E6CBC8331ULL, 0x33851E661A6FA8CBULL, 0x71C932B14F858962ULL } }
+    },
+    {   /* 5: (2j+1)*2^20*G */
+        { { 0x8F7DCECB7D96DFF1ULL, 0x30E431C1AAD5FCFEULL, 0xFEF6A0B570CD98D5ULL, 0x0EC73885141FE54FULL },
+          { 0x9EC841AC7C7B552CULL, 0x1D5264CE87ED78AAULL, 0x91ACC4EF58065251ULL, 0xD6224F4E87AE875DULL } },
+        { { 0x51C324AB088D58E9ULL, 0xE94A5C1C64E31838ULL, 0xE992A46A7C42A7B6ULL, 0x96DAC3FDC7064A86ULL },
+          { 0x80349312AEBEBC5EULL, 0x685BE89B9487E6E3ULL, 0x856CC4949382C439ULL, 0xCB1FAFF3AD46C1ADULL } },
+        { { 0x8952AD132DB29F92ULL, 0x1D21D271B947B2C5ULL, 0xA105DC378AEB8F81ULL, 0xE297B23CEB14F312ULL },
+          { 0x60F294C8A5E58DDBULL, 0x1223CEBB85ED4141ULL, 0xB480DBABB8CD9149ULL, 0xE1372520F8CB70B4ULL } },
+        { { 0xFD943B7B8AD88C33ULL, 0xD91AE394D9746BCAULL, 0x6B06BC920D24DA97ULL, 0x1CD22338FB2B94B6ULL },
+          { 0x628EA784248FB1B2ULL, 0x13FE51315ECA1E49ULL, 0x96C8640AB136BC27ULL, 0xFC3ACDF838AB48B0ULL } },
+        { { 0xF53AC89C3B26AA73ULL, 0xCDF7E11B0C63A0E0ULL, 0xCB1CAD30DFFB1EE0ULL, 0xF462D7ADB9E9FBBFULL },
+          { 0x245EAC1778479E73ULL, 0x49E8E0A300502CCAULL, 0x0D53BA4A68733C7AULL, 0x406A0D1A78345314ULL } },
+        { { 0x3EE1E02ABCD015E3ULL, 0xAF90E9597E650227ULL, 0x75BDBEB3CA895168ULL, 0xE0F68925D3F70CAFULL },
+          { 0xDAA24D42D2157CCEULL, 0x55B8B5391E2936BBULL, 0x5362696C7274C77CULL, 0x08531E310E483AA9ULL } },
+        { { 0x1E6C43114BB76B12ULL, 0xEA8E76773E192769ULL, 0xC1D82B312AF75A00ULL, 0x28E4ADC1552BF57FULL },
+          { 0x57E453A7EC4747BDULL, 0x03A0A60F171628FFULL, 0xF4E4B65B6B9EA3F7ULL, 0x14D74C4EFD9A01B3ULL } },
+        { { 0x8BF5801FE76FF697ULL, 0x369B688652076462ULL, 0xD271EDABB3A097C6ULL, 0x85A0BA2794BA805EULL },
+          { 0x309ED4DA52142721ULL, 0x1DE97FFA790A58B9ULL, 0x554790D3DCEDAA55ULL, 0xADF32E61EAC3E24AULL } }
+    },
+    {   /* 6: (2j+1)*2^24*G */
+        { { 0x3725C5DCE392D805ULL, 0xA87A8069875405D4ULL, 0xA4A54DAAFAA3449AULL, 0xF8F5DCCF4C6A93D7ULL },
+          { 0x026619516CDA02FAULL, 0x51F3DA64A52143BAULL, 0x389D3E3364613273ULL, 0xE58176CF66D63054ULL } },
+        { { 0x19D4B3167FA046F7ULL, 0x17110F390207309DULL, 0x4E084AC8946E2D45ULL, 0xE12C8E4A865883A9ULL },
+          { 0x53A55A28A12646ADULL, 0xDD0C04E113311934ULL, 0x433B3ED5393126F6ULL, 0x7CEC04610FD9A2F3ULL } },
+        { { 0xB9B127E8C2853C43ULL, 0x48166C57AE22E466ULL, 0x3D08E2EFE3D13236ULL, 0x394BD47417969209ULL },
+          { 0xB17828CCA064469DULL, 0xD52F6712D90FCF0CULL, 0x207E3FC2F1D60767ULL, 0x2B4D6D52151DC6B9ULL } },
+        { { 0xEC2DD739FC722E94ULL, 0x4ED810396D058961ULL, 0x445C6656C5940433ULL, 0xCA8538DF38DE82E9ULL },
+          { 0x3A0A62DF1049A527ULL, 0xF20953A8A48B26A4ULL, 0x11E73126A1FB9F12ULL, 0x3B27FC42EB9E05C3ULL } },
+        { { 0x87174629DCAD6309ULL, 0xD31A1FC2F239FF48ULL, 0xA1BB74624CA67B3DULL, 0x663E1A59F2357B75ULL },
+          { 0x53286BA389981F28ULL, 0xB907D44402EB52BDULL, 0xC102C183CB1CF918ULL, 0x292FB73B8066A8C3ULL } },
+        { { 0x9275B24522C23D03ULL, 0x3BA1B04D8FC7FF24ULL, 0x96C36C23707BEEABULL, 0xA2D9EFE730636670ULL },
+          { 0x102E4C04F085DB74ULL, 0xEA09A7E95839DF45ULL, 0x15530436C7101B92ULL, 0x1CC85228CC841B8FULL } },
+        { { 0x1755F96707D4C6D1ULL, 0xF662CD519AD9FFFBULL, 0xE0B910B5273F35D0ULL, 0x5657E12B48B1A9EFULL },
+          { 0x88303F298106BDECULL, 0xBFF9A35A1452C141ULL, 0xACFB390F33AE6A0AULL, 0x72B5BEF4B8DD49F9ULL } },
+        { { 0xF8654DD55933564AULL, 0x7A68B4FAEDE3AF44ULL, 0x0864EDC6676D8D2BULL, 0x5B686215D40AE001ULL },
+          { 0x3B5F04588204EF63ULL, 0x392AEE228878869FULL, 0x52D30C54D19D95DEULL, 0x76B5EA69CF3A2645ULL } }
+    },
+    {   /* 7: (2j+1)*2^28*G */
+        { { 0x984A23176F922DBDULL, 0x1CA631161F99218FULL, 0x3F85EAAD8E4D71B9ULL, 0x6D28B6BFFD4DAF31ULL },
+          { 0x44ABFF02A0EF3CFFULL, 0x4C24E9F0B84DA299ULL, 0x40FBE1A61CCB4A1CULL, 0xAF39D905141DD2FAULL } },
+        { { 0xB590DFF99B168B64ULL, 0xA153D02AC586C840ULL, 0xD3DF0905FC14467EULL, 0x7CD3157A7FBFE3DDULL },
+          { 0x856C0D2B5ABBB16BULL, 0x13AC4D9B72E02E35ULL, 0x20568E78BCDBFAFBULL, 0x9CA08D2117292C62ULL } },
+        { { 0xB2B1C6FA06EF29E8ULL, 0x64DC554B09D9AEE3ULL, 0x56B243199D453562ULL, 0xED860BDB5F2DF8C4ULL },
+          { 0x501A1C49B9B90F8FULL, 0xE7630F5C2D8DAA33ULL, 0x7C6BF6B340417BB1ULL, 0xB837E74375D5A7FDULL } },
+        { { 0x9DF918B3F636E617ULL, 0x47DCD03BC1F1CF59ULL, 0x735E1C2E7E272C9DULL, 0x6868CC8FD1D21243ULL },
+          { 0x1C8DDCF3FCBB3D27ULL, 0x60FE30C8A4384CD7ULL, 0xB3C5903879313F0AULL, 0xEED008A5B91BF9E6ULL } },
+        { { 0xC79DA2A6113E2A34ULL, 0x291D2E65CE3A11E2ULL, 0x2C5CB49F10AFD318ULL, 0xEC03B360EAC8FE20ULL },
+          { 0xA42243EEB84566D6ULL, 0x8AA8156E65A136B7ULL, 0x7BEFDE2101212272ULL, 0x86020FFB60A05843ULL } },
+        { { 0x5EAE0CE5C87C1B18ULL, 0x101E2CB5484991A2ULL, 0xE6A3035A591056FAULL, 0xA79464A39E78B90DULL },
+          { 0xBEB585097B94809AULL, 0x0D98DE9C71562821ULL, 0x249A57879E9A89F6ULL, 0x1361F4E3F72858CCULL } },
+        { { 0x594E28C6DED10D26ULL, 0x5A9ABEF829E595F6ULL, 0x90E91FB694F30CCCULL, 0x544EF280AA8FBCC7ULL },
+          { 0x2FC24F7276DAFCC2ULL, 0x683D6F976E2C06AEULL, 0x9D6B1DFE8D8D70D3ULL, 0x95B91C9DC45AC2CEULL } },
+        { { 0x249479F8B7AD18E6ULL, 0x57AD3E798D3CAD5EULL, 0x4DE53C846B4AFF9BULL, 0xE2C26C885F34C621ULL },
+          { 0xADAFE51AA554CFADULL, 0x3BC515CA71981DE4ULL, 0x51CE266EA117BA11ULL, 0xB2121B284F488188ULL } }
+    },
+    {   /* 8: (2j+1)*2^32*G */
+        { { 0x3A5A9E22185A5943ULL, 0x1AB919365C65DFB6ULL, 0x21656B32262C71DAULL, 0x7FE36B40AF22AF89ULL },
+          { 0xD50D152C699CA101ULL, 0x74B3D5867B8AF212ULL, 0x9F09F40407DCA6F1ULL, 0xE697D45825B63624ULL } },
+        { { 0x76A78091DF0922A8ULL, 0x8E90E9D2545CF8D9ULL, 0x80924E56022F8B80ULL, 0x4B656A405B4E2D73ULL },
+          { 0x4DADCAC5999A80BBULL, 0xD473B9E2B9850F69ULL, 0x20D04CC255D8C4D6ULL, 0xEE1EA31D12E77839ULL } },
+        { { 0xB504F88869D07E9EULL, 0xA09E7CA1F6A60C36ULL, 0x93DB2BE0FB3D8E5EULL, 0x9D78956EBD65E13DULL },
+          { 0xF4DD615AC3D8C8EEULL, 0x7460A2DA3B94C7B2ULL, 0x6542A89C1D3210CEULL, 0xD5149E6EF48EA8CDULL } },
+        { { 0x667750867DC4950FULL, 0x5741B2ADBD394207ULL, 0x57236846E4DB6316ULL, 0x4ACB1272E1353FA9ULL },
+          { 0x66C6E44463D8B4DFULL, 0xDF9E4280B5866AC5ULL, 0x8CF298F6CC71E29FULL, 0x726CD20FB743CDADULL } },
+        { { 0xF40C7A7BED7E8CBDULL, 0x2A667F8AF007D816ULL, 0x234453550C81464AULL, 0x640C5EBF1A6B17B4ULL },
+          { 0x06E2903CBEC5A5DBULL, 0xBA069FB18CFF9B02ULL, 0x2AE9C6EB701EAB9EULL, 0xD6AE88FD829CFD2FULL } },
+        { { 0xF70A04B07E86BDDCULL, 0xF1D26B97975CE3D5ULL, 0x451562C90DDB6B9BULL, 0x8BBA04B1B4284B32ULL },
+          { 0x5223C5A1E9E349C4ULL, 0xC6ACFDE4F4196E5FULL, 0x659BF9216699437AULL, 0xC34099C09C208EBFULL } },
+        { { 0xD170E7804257F582ULL, 0x1F9909EADEC3A258ULL, 0x10A6943F7C5A5FE4ULL, 0x8B0A5744FECD37E2ULL },
+          { 0x4817FEDF37372D4BULL, 0x56DB46BA7B160766ULL, 0x662A15A137E37D46ULL, 0x9E57A44EC0D6C739ULL } },
+        { { 0x3F1449F9985E797EULL, 0xF06E224F2E3C3168ULL, 0x1F856F493D9678A6ULL, 0x0A13FF97C2647897ULL },
+          { 0x8327AB9F539D666FULL, 0xF27F6F0A7580C392ULL, 0x917D818E8FA1DC3FULL, 0xEB1A964B225C83D5ULL } }
+    },
+    {   /* 9: (2j+1)*2^36*G */
+        { { 0x7AFF4FE1FDDE3445ULL, 0x76BBA9DDA2AEA781ULL, 0x85371FE7FF26519EULL, 0x6965B6384D7061E6ULL },
+          { 0x7CC4389E18855113ULL, 0xF47CE6051A5F99D9ULL, 0x325E496638732DBEULL, 0xD1BCDAE39C482511ULL } },
+        { { 0xF5E40F96888ACFC5ULL, 0xB1EF589B36689789ULL, 0x027E7DDBD4091A71ULL, 0xE1CBC51DDE75C7DAULL },
+          { 0x3BC5FED5A249A225ULL, 0xE7D3292BEEBFBA52ULL, 0xB312764FFDB9E23CULL, 0xEC678397CDE7DAEDULL } },
+        { { 0x758EA53FE107CCC6ULL, 0x1D3897E1543C8228ULL, 0x731E9D2845A90048ULL, 0x9C3F267971138AA1ULL },
+          { 0x840794CD3DEA9152ULL, 0x51A8FD4E95F9B186ULL, 0x8BE375F4BF3E6ECAULL, 0xDAEE0C1B64B51D9CULL } },
+        { { 0x21C5EB4395A449E7ULL, 0x2FA2A034E53C2BE4ULL, 0x796FAC17B140922BULL, 0x5C30D9577C6B2D72ULL },
+          { 0x770EA481AE2677D0ULL, 0xB75E4053C3CE790EULL, 0x164B65F799C592D0ULL, 0x8025E3B5B08E1B92ULL } },
+        { { 0xFA558C028B8CEB07ULL, 0x5379252BFFEE271CULL, 0xAFE4E2B07EA8D995ULL, 0xAA3BBF230C8E9682ULL },
+          { 0x99A8462E9FD83984ULL, 0x3B71B2BC7AB3F9EBULL, 0x44DCB0FE4C9162ECULL, 0xE6320CB09C1EC268ULL } },
+        { { 0xE40EA55583BFD1F1ULL, 0x3A36DC3515D65732ULL, 0x79E60FC991400194ULL, 0xAB4A325113334181ULL },
+          { 0x21139610C8E1C233ULL, 0xA57D9324279E98CFULL, 0xB4EB3BD0412FE057ULL, 0xEA6C64BB036C8668ULL } },
+        { { 0x08406D780B1D6D3FULL, 0x5F37668A4EEEBB89ULL, 0xF7337F5CD8A5A810ULL, 0xDBA9B259DDED5D77ULL },
+          { 0xC42E928289CD8133ULL, 0x48BD9BC4512BD93CULL, 0x5ACA994F4FEB8714ULL, 0xB3862D3F57535B7BULL } },
+        { { 0x679A038031FA2A6AULL, 0x34FC1D585B0E4B25ULL, 0x07ADD742B1A3CDFEULL, 0x1998F4C42E982745ULL },
+          { 0x607EDB4BC6415142ULL, 0x4C6C02387B7258B5ULL, 0x9700F8008B78A1E9ULL, 0x2EBB416D190AFA10ULL } }
+    },
+    {   /* 10: (2j+1)*2^40*G */
+        { { 0x258FCA6C4D9AEFBDULL, 0x1EFE47B273B95775ULL, 0x32CA9F0D41BC43DCULL, 0x0FBC341C8C669D76ULL },
+          { 0xED3B6EA9D3E71CA0ULL, 0x950B069E200A9FF1ULL, 0xE4014B1D4957D3D3ULL, 0xBD8022632F360E3FULL } },
+        { { 0x8796DFFEE9434837ULL, 0xADB3140B8620C1BBULL, 0xB1341C6FFB4FB06DULL, 0xD76D18ABC4A87AEDULL },
+          { 0x4FAA04F9BB215B4CULL, 0x90A458E775B7CCC2ULL, 0xDE0E4214F7AB9332ULL, 0xF6BC4DA32ED96644ULL } },
+        { { 0x02E89F219C07F222ULL, 0xC5E21C63AC60FE7DULL, 0x4F481D1A1F1753D1ULL, 0xD5C0C6506167FF60ULL },
+          { 0xE2EF691E0C6FFD57ULL, 0xBAF3F51A78813A86ULL, 0x0CDE0C77F49F75B9ULL, 0x15A30B860817B885ULL } },
+        { { 0x4A4716A24E93BFA6ULL, 0xD39D295A09A1362AULL, 0xE549CBA66B4C9FE0ULL, 0x734C364E4A46F62CULL },
+          { 0xFC6FA79998D10774ULL, 0xECA13620890297C4ULL, 0x9DE981E3520C5F48ULL, 0x09951503AAA79D04ULL } },
+        { { 0xF0EB517F5FA194AEULL, 0x0640291D9A054AECULL, 0x01175D9D2A9EB149ULL, 0x79A3D9DA07B66A89ULL },
+          { 0x4FC65E9C9FCF634BULL, 0x6BD425F32F79BC4DULL, 0x4B3671B858AF03D8ULL, 0x84E1DBCA7254B1B3ULL } },
+        { { 0x6AC9060021E8B7FEULL, 0x5DD0E2E17785B26AULL, 0x8A3E4CAADCFC98E0ULL, 0x3393FD094D5B0582ULL },
+          { 0x0C142442023C6821ULL, 0x8E56B30A8A9B94B7ULL, 0x2EAFEAED9C5A668DULL, 0x130437BEC867BEB8ULL } },
+        { { 0xA09579D561528CF6ULL, 0xE6A0250AF650694EULL, 0x5E1B4586EE5B0A52ULL, 0xA16B2886134627E1ULL },
+          { 0x80B920F9FCE93F3BULL, 0x3493FBC813CC8013ULL, 0x913CED79D81150F4ULL, 0xF40598AE8537AD99ULL } },
+        { { 0x3510A66B8C8DB2E0ULL, 0x473CBDC15F0D7358ULL, 0xBF6C89ABA95A74F6ULL, 0xD317CE2018E3474CULL },
+          { 0xA5B34A2B274BC9A9ULL, 0xCAA274D022B860F3ULL, 0x99C2C3E8E3979136ULL, 0xD61A210A9093844BULL } }
+    },
+    {   /* 11: (2j+1)*2^44*G */
+        { { 0xC6E3197AA3FE67B2ULL, 0x34A8BFE70A2E3338ULL, 0xBC666B9BA97323B2ULL, 0x6608C243773C85DCULL },
+          { 0x1923FE5CE5B47A28ULL, 0xC22B159F40C54308ULL, 0x846F640DA746E03FULL, 0xA1A916BEC521C168ULL } },
+        { { 0x13E6EAAD2BC73E02ULL, 0x8496614EEB65312CULL, 0x206A98117D578631ULL, 0xF0956AE2A6C5DC23ULL },
+          { 0x2D2CF6998611219DULL, 0x672D048DBBAE9457ULL, 0x76E2058AF2839356ULL, 0x433FE6601144E03CULL } },
+        { { 0x7DE22DE51C5FE45CULL, 0x88B281A8387C0F59ULL, 0xA52F249D7CF72834ULL, 0xDB98EBEA3CA2A60CULL },
+          { 0x44A701C43EF45A22ULL, 0xE983204FAA480E1CULL, 0xDE15129DD8912C8CULL, 0xE0C0F30B75BD85A2ULL } },
+        { { 0xAF59E60DE2128EACULL, 0x0C4758D5CCAF1CCBULL, 0x21BA6B3B7D6A5169ULL, 0x0A73C0160ADDA5F4ULL },
+          { 0x3859291D64F1180DULL, 0x793759F17755D9CAULL, 0xA55CB6DD94F50A7CULL, 0x443FDA56044E838CULL } },
+        { { 0xC65A933163CCBC30ULL, 0x9EDFE5D21D349618ULL, 0x70ED37667A099724ULL, 0x378720C347CB4F23ULL },
+          { 0x6A20327F1315729EULL, 0x16BCF955D1348F84ULL, 0x93118AC0AAA79B6DULL, 0x8F1BDDB9CF72538CULL } },
+        { { 0xA64A8DE543BB1B6BULL, 0x575FEF32F47C2BFAULL, 0x9D98118C1055A621ULL, 0xFE8FD21DB78B1A61ULL },
+          { 0x97B5D9BA30EAAF93ULL, 0x0F14DDCFF0ABF889ULL, 0x69E28E95F5AD13C0ULL, 0x791E22AEC3256E37ULL } },
+        { { 0xE805599CB44B7CEAULL, 0x47446940916CF87DULL, 0xE820402278B3DCCAULL, 0x2C331FD579FB7E2EULL },
+          { 0x7FC2B46AD5D1C9C2ULL, 0x6192511FF1309407ULL, 0xFCF3F3D8C3BDD650ULL, 0x20567B1CCE061E76ULL } },
+        { { 0x8F929B378112278CULL, 0xDD01649D0A8D9A15ULL, 0xA348B4C87F844B66ULL, 0x509BC06C4651A320ULL },
+          { 0xEC875C988E178F66ULL, 0x0F65FE86E735F945ULL, 0x1760F4F17B8F6457ULL, 0xB4B168C2B72246ECULL } }
+    },
+    {   /* 12: (2j+1)*2^48*G */
+        { { 0xC2EBAF8017E55104ULL, 0xF73A835FBB8E9C71ULL, 0x63DE93C34D8B561CULL, 0xD8DE765227B78737ULL },
+          { 0x2A02EF80E52E08CDULL, 0xC2F73FCE1940DB1BULL, 0x5C4C628AD1DCF924ULL, 0x2FD29465BE13F2D1ULL } },
+        { { 0x6939C2C7E987BFD3ULL, 0x87C5472FF4C4284CULL, 0x551DFBEAFADDD191ULL, 0xE3A5786FBD518E33ULL },
+          { 0x7ED31B6C8CC23E7DULL, 0xA3DCF2ECD928E081ULL, 0x8477B9FF4AD8210CULL, 0xF74BAD09535840E6ULL } },
+        { { 0xB67951D222D5056EULL, 0x0EDCB5A7E247A07CULL, 0x11525FFCE96E5E48ULL, 0x42A97041ECA520D4ULL },
+          { 0x48414DC8B0F7DB11ULL, 0xB64E483D6E9FD1FDULL, 0x6EC36DD26B563B26ULL, 0xF2FC7F66CF008706ULL } },
+        { { 0xC6745F91D3DAFD3BULL, 0x6FB899F02DCB3956ULL, 0xFE232C2ED65379D6ULL, 0x0D6CA71B1C27964CULL },
+          { 0xD6ADF1421A6FE6E8ULL, 0xA02248ABEE88771AULL, 0x9FE494A02707DE58ULL, 0xA85130B38FDE293DULL } },
+        { { 0xF6BF9C7FF1131F8BULL, 0x69646960CFA20D4DULL, 0x7D4C22DF9C431FB4ULL, 0x05EDCA7AD865A3D9ULL },
+          { 0x0ECF0B19BA6F779FULL, 0x33525005F0E89D49ULL, 0x01C9D71B5F0271BEULL, 0x9E58881E48E886BCULL } },
+        { { 0x9C8F9F41EB597E4DULL, 0x4974F325E77D1A31ULL, 0x121B45A33B771C11ULL, 0x5A13C0560BC7A0A4ULL },
+          { 0xAF7E4869E41856E0ULL, 0x7BDE87AB59136664ULL, 0x51FD18A0F22D73CEULL, 0xC9E73C13890F97FFULL } },
+        { { 0xDAA789614260FAF0ULL, 0xA2BBD34597E95935ULL, 0x43144E1A680F272EULL, 0x96B25656017B6E75ULL },
+          { 0xC0E42520E366D412ULL, 0x890BBF98707D4F5AULL, 0x00AD8E5733BF99E1ULL, 0xDCF8A6A001B37CACULL } },
+        { { 0xA49A1BE4AAD13276ULL, 0xCA6350EAE9C043C7ULL, 0x26F12B2B387771A3ULL, 0x0B971910C41CDE24ULL },
+          { 0xB338F3420A84DADBULL, 0x593D79298270FAE3ULL, 0xD4E2E45B3BF6811FULL, 0xAC28486EF006EEFBULL } }
+    },
+    {   /* 13: (2j+1)*2^52*G */
+        { { 0xEEA6BC92071E5C83ULL, 0x8BD27F198542A0BEULL, 0x20A845B72A58E5B1ULL, 0x54CCC9415026D73FULL },
+          { 0xCFD08EF7140916A1ULL, 0x929E0BCC5D8EE496ULL, 0x3A8F8715DAD2BF22ULL, 0x1C433F45B4514532ULL } },
+        { { 0x4C5E3622AF76167CULL, 0x2F2F422CC4746739ULL, 0x39C22C692DCCD9F2ULL, 0x87582EDCB73EFF95ULL },
+          { 0x6C6FBB616F4D7FF6ULL, 0x88028F0677197BE8ULL, 0xFDE102C3C37236A8ULL, 0x075B94350AD64A7BULL } },
+        { { 0x46723EE874DE6611ULL, 0x33F657394B821FB0ULL, 0x1C25B7363566F11EULL, 0x4A107ACA1F2736DBULL },
+          { 0x0358EBEE58A805FEULL, 0x075D547A5C2132ACULL, 0x34CE64E8F700052EULL, 0x809B26510063EF39ULL } },
+        { { 0xFCBA4ED06DCFECB0ULL, 0xE983FD1D30A8D846ULL, 0x654A0E0D49BF49F6ULL, 0xFD402EB372AADFC9ULL },
+          { 0x10593F3DEDA08DE8ULL, 0x1A4B4C24BDE65E79ULL, 0xE9A626389BABA86BULL, 0xD6B34030DDA63A22ULL } },
+        { { 0x5B4DD60F554659EDULL, 0x7FAE3D22195D966EULL, 0x5DFB8E07FEC9D0A0ULL, 0x467BB34646187515ULL },
+          { 0x9B207D0B2800CF83ULL, 0x701BC10DCD013E00ULL, 0xA1F2CD586DB82CD3ULL, 0xD01EFFD05AA978E8ULL } },
+        { { 0xEE64984ADC97E515ULL, 0x6914D6C339885A5FULL, 0x6C879B630E9EC7E5ULL, 0xCF66B98F8CDDC0E4ULL },
+          { 0x958214EA806C8A51ULL, 0x33F07458D990033AULL, 0x1C25B41034EC6A7BULL, 0x0A70717B90446121ULL } },
+        { { 0x3BA52A10186154E5ULL, 0x86402A669AAFA0DDULL, 0x751C8953AD486770ULL, 0x3D9252C60FBFAA34ULL },
+          { 0x77FC93F69603A8A2ULL, 0xAEA1FB7D7C7DD707ULL, 0xC4493342896B4CF3ULL, 0x3D0D01DCD2FA9D7FULL } },
+        { { 0xD3B63B62AA4A8DAAULL, 0xE510600EF28A5CA3ULL, 0x760EB5B48F4A968CULL, 0x2BBE38B26889769CULL },
+          { 0x7E08774E9236E49BULL, 0x9902B3A4E3EB6E7DULL, 0x5E2CFEF91F960850ULL, 0xF85707F600D3B36FULL } }
+    },
+    {   /* 14: (2j+1)*2^56*G */
+        { { 0xC30FB77122D32936ULL, 0xE40CD02E32847F01ULL, 0x9F6CC7D1513D7F38ULL, 0xC5440C597814A47DULL },
+          { 0x9A42FA3747CABFD4ULL, 0xD8A6D28631E41E5DULL, 0x2EDC1E1D23ECF4ACULL, 0xD27EE9BA383E1FA7ULL } },
+        { { 0x7D8501EC7989A8E1ULL, 0x7C1D96F374EE4BDDULL, 0x7500E0479B9CFE0AULL, 0x3E4D03C45CDFA79BULL },
+          { 0x98791388441C240AULL, 0xFFAF18D5F3BD6740ULL, 0xAAC117CAD7CAA719ULL, 0x12F744D0815A6475ULL } },
+        { { 0x6939A8D0D9BB7902ULL, 0xD8C26C7286B7C73FULL, 0x9A9A249E94485E9FULL, 0x01B68449B3D61035ULL },
+          { 0xCD7F44B1E03EE653ULL, 0xFCEB260471836682ULL, 0x0BF198E5C36D1581ULL, 0xE59063A1E9379C3EULL } },
+        { { 0xC29B56D4C371D9FEULL, 0xF04B356C1999D6BBULL, 0x335955A7C3AB3A4CULL, 0x952C3CB1ACCC9CA2ULL },
+          { 0xD76CE6D24189A13FULL, 0x664464F11808C75EULL, 0xA7DF9136F6ECE5D0ULL, 0x59B98546F7D62F06ULL } },
+        { { 0x847FFC768BC2C885ULL, 0x1551EE775264E57CULL, 0x858980450B97CDE5ULL, 0xDFCB4EE15B166EACULL },
+          { 0x75D4A6431345D92EULL, 0x1C7738947BABE975ULL, 0x53C4FC26C82C0F41ULL, 0x536A2395550613A1ULL } },
+        { { 0x738B852BF510208EULL, 0xDB8CCE2D84D79438ULL, 0x8A87AF3A047C97BBULL, 0x157966C09BE6500CULL },
+          { 0xD60EEE250D207357ULL, 0x008FC64432DA43DFULL, 0xABDFF7B7BB8CBE07ULL, 0x40446D5AB712264EULL } },
+        { { 0x1C9FCCBE8B96FE13ULL, 0xE4924AD3B4852EA8ULL, 0xD6E1A8FF813F6E23ULL, 0xC6B21E3C4B1E990AULL },
+          { 0xA006B96AF7BB1417ULL, 0xFF65509179E6D2D6ULL, 0xE54B781E34EB28A2ULL, 0x335BCDD8C3334D48ULL } },
+        { { 0xC365819AC3936565ULL, 0x97A7B36D977FA4C7ULL, 0x0B4BCA9D539522D9ULL, 0xA231E4C478C7296FULL },
+          { 0x8AE56A0635EC5F19ULL, 0x2BA56E0096F15426ULL, 0xC0D94EC68803CF94ULL, 0x80E0C98BEC7FBE91ULL } }
+    },
+    {   /* 15: (2j+1)*2^60*G */
+        { { 0xBF9F4172B066FD48ULL, 0x1C37101CB8971583ULL, 0x06C79B97A6BADCA6ULL, 0x241C567A4227F1C5ULL },
+          { 0x7F7D2C6792857B08ULL, 0x8EA87138AEA36605ULL, 0x9363817C043203A4ULL, 0x40A62D93D4302D4BULL } },
+        { { 0x861F7DB90DF9591DULL, 0xDCEC3AC242B4C82AULL, 0xCBA0D3C4AB327218ULL, 0xDE2FD23B826978E9ULL },
+          { 0xB4E1973D0457AD84ULL, 0xDA9A8A1F88C036A4ULL, 0x05ECB7EC84B92EBBULL, 0x400D71133B6243F3ULL } },
+        { { 0x2EA8254AF562282CULL, 0xF02F3AF938FBC377ULL, 0x993948B024E11340ULL, 0x8DF889B0304CCBDDULL },
+          { 0x7256ABD961D195CDULL, 0x247F7044CEF9BB15ULL, 0x6C741E63188AF35EULL, 0x74525B673205CEEDULL } },
+        { { 0xF9D528950DDDB2DDULL, 0x078864CDCC2C0DA6ULL, 0x001FB80CF152F245ULL, 0xA0FD758CD98B80F8ULL },
+          { 0x7FD94FF873EDE6B2ULL, 0x1C8CE96F89409A7CULL, 0xF8691FD313B08F31ULL, 0x53E5D835C13368D5ULL } },
+        { { 0xE08CBAA04F542E36ULL, 0x4E22FFAFA13415C2ULL, 0x7DE59267946335D8ULL, 0x3170C58472D1A0F6ULL },
+          { 0xC6C475AEF63288B5ULL, 0x006F75695999BE1BULL, 0x37515093FEB9773DULL, 0xB2083612FC3A7FE2ULL } },
+        { { 0x799B23A5DC7548E9ULL, 0xD8DDA8070892D54CULL, 0x9DB481694F063FE5ULL, 0x92FAB0A90A2D3E02ULL },
+          { 0x8C712CD04917758FULL, 0xC8A0DC68EF2D0848ULL, 0xF431714E0C2679FFULL, 0x55E7B4680CB246BCULL } },
+        { { 0xE0D8050B9498F7F8ULL, 0xC4DF67D326411622ULL, 0x9D0BE11B192C8712ULL, 0x91B065BE18035517ULL },
+          { 0x3C740D9E3F23195BULL, 0xDF2C7B425789639EULL, 0xFF9FF3490017E264ULL, 0x035B6F77FB671620ULL } },
+        { { 0x51DCBEE24060E322ULL, 0x3ECDC737A9C4D14BULL, 0x9C390697489AB992ULL, 0x8E4A1F4CCAC9CB3AULL },
+          { 0x4E2183CD904619D7ULL, 0xFB00A98D954FBFE0ULL, 0x2FB05ED2406E7BC4ULL, 0x4936B75EB328D775ULL } }
+    },
+    {   /* 16: (2j+1)*2^64*G */
+        { { 0x90E75CB48E14DB63ULL, 0x29493BAAAD651F7EULL, 0x8492592E326E25DEULL, 0x0FA822BC2811AAA5ULL },
+          { 0xE41124545F462EE7ULL, 0x34B1A65050FE82F5ULL, 0x6F4AD4BCB3DF188BULL, 0xBFF44AE8F5DBA80DULL } },
+        { { 0x752C453F7DB3CDECULL, 0xDBEF3A12B228EBF5ULL, 0xE596645E7BEA4BC8ULL, 0x85B2C064FF912F5CULL },
+          { 0x8F4D08204A03F81FULL, 0xDC980B34E64CF8E0ULL, 0x63C7FA2D2FCC6D00ULL, 0xF64B278F39D11536ULL } },
+        { { 0x288A5AE48607B030ULL, 0x24DAFF63E584D673ULL, 0x7851FBACEC16F29CULL, 0x110B0376C4021467ULL },
+          { 0xF43AA112B3617C3AULL, 0x87BE1556FB298749ULL, 0x4C6EB89F8461C70CULL, 0x84432B85318EE673ULL } },
+        { { 0x54EDD81C75A76F08ULL, 0x3295F2538BBBED4EULL, 0x14F6E1242B1CAAF8ULL, 0x18784E449F6471D7ULL },
+          { 0x0B39605D6B824993ULL, 0xFC9D74A7A60A2532ULL, 0x1777A8FDAC71E671ULL, 0x8D76ED7F4A1E1AE7ULL } },
+        { { 0xCE8E33C9FA6FAD81ULL, 0x9C3365748C0CB03EULL, 0xAEF56DD7703A037DULL, 0x58A2F9E07D05E6B9ULL },
+          { 0x5400615E3B109594ULL, 0x798BB2D32D300B82ULL, 0xC1B682F8717FA6BDULL, 0x06AB64C5AC5560E0ULL } },
+        { { 0xFB22F11F9EB52583ULL, 0xEA8A99CEC10CC13AULL, 0x40EE6DBB278F676FULL, 0x1EF020DCCE7EBBA2ULL },
+          { 0x55B278197A3F17AEULL, 0x6AC300F97012D4CBULL, 0x097F6C0F4B969530ULL, 0x594476B25A7A14B0ULL } },
+        { { 0xB5C23EC1F0A1958FULL, 0x4F39B5246FB56643ULL, 0x95DD144CFABFA32CULL, 0x4E4A8163C1D6A213ULL },
+          { 0xA43B3F5148636F8AULL, 0x4004085FB2C43D66ULL, 0x033F4A3EE29C6FA8ULL, 0x2574A45B79E8C8D1ULL } },
+        { { 0xE8275A8464935DB5ULL, 0x281798261C6BDB0EULL, 0xE3327E0ED594519EULL, 0xF6966A16ADD61104ULL },
+          { 0x3A34836C1D166838ULL, 0x2D7453A34401BF01ULL, 0xC1A5EE572C3C755EULL, 0xBA0DE307A9031DB2ULL } }
+    },
+    {   /* 17: (2j+1)*2^68*G */
+        { { 0x68F41305B76A6987ULL, 0x2B481AB443DA43FFULL, 0x7DDC6988D7EE1B3FULL, 0x54BC18D7A9989954ULL },
+          { 0xFE457CD05B9AAE49ULL, 0x52EB8ED4BB73B119ULL, 0x7391B851BA73E2FDULL, 0x4B2C8C1211E6EAF3ULL } },
+        { { 0x38BF47F5FD1FD820ULL, 0x7887854648767500ULL, 0xA863502262B1271BULL, 0xBAFBBCF680C1C52AULL },
+          { 0xEAEDAD521BF074F0ULL, 0xE81C34A1231FCAD6ULL, 0x2CE7BF5AC89BC0FDULL, 0x1487997C9DB4DD81ULL } },
+        { { 0xE917081294299B7EULL, 0x24E79F2D0986E0D0ULL, 0x2A3C3BFC75C220ECULL, 0x9B1938F7103389FEULL },
+          { 0xC57B2857447B84DEULL, 0x0ACDE851F86B8232ULL, 0x3140E98E1CAA3EC9ULL, 0xFB12AA6EF1710283ULL } },
+        { { 0xFD410740D10CC4C4ULL, 0xB71D35A2C4A53DA0ULL, 0x7C381FDC06761B2CULL, 0xA6771985CC017590ULL },
+          { 0xC20F3B237C976570ULL, 0xBC745773A6FF3094ULL, 0xF29BD6601E5D9C3DULL, 0x85506185F750DD98ULL } },
+        { { 0x5410802D54242A28ULL, 0x455BCB21253CA771ULL, 0x09E8AF784B774ECAULL, 0x88B7ED536B0EAFC1ULL },
+          { 0xFB9681EC794ED8CEULL, 0x4E366A1C8F83E347ULL, 0x47FBF9DD3587BD93ULL, 0x22B053206245345EULL } },
+        { { 0x016144EC9BC1A94CULL, 0x51671D2B3E71DAF8ULL, 0x052D72B0225E8757ULL, 0x037114012A86B3D2ULL },
+          { 0x8C0C0B6CEFC2073CULL, 0xC8518C362AC42483ULL, 0xEF8C21A54AD05335ULL, 0x4D1D693D51DD7390ULL } },
+        { { 0xEFBD1E09877F88BAULL, 0x50980779EE9BED36ULL, 0x34B5A32E84EA2CC3ULL, 0xCC98214C8984293EULL },
+          { 0x0A462EFC87885278ULL, 0xEFF60E7EEF354C4EULL, 0x114C4A64677D63ABULL, 0x04EBB4E8E525AFA9ULL } },
+        { { 0x1573194DFD70187CULL, 0x751AC8629B640C7FULL, 0x9814E5E0290F5BF8ULL, 0x0AD3AE029A42A10FULL },
+          { 0x7DFFCF4B3FC775A7ULL, 0xD034FB081662A0F6ULL, 0x785C55F05FABB33DULL, 0x2AF040D4758846E3ULL } }
+    },
+    {   /* 18: (2j+1)*2^72*G */
+        { { 0x60AAFAD170AAE231ULL, 0x5194B85279F96B7CULL, 0x85F248239267756FULL, 0x1D35C9699761E3F2ULL },
+          { 0x5867063ACCD6AC71ULL, 0xEDF58AA4729A66F1ULL, 0x1D660AB622EBF810ULL, 0xC7226CB62DF60823ULL } },
+        { { 0xCE0D3FE18CFA3FACULL, 0x23AD869FC32B8193ULL, 0xE2CEBB45D60D8030ULL, 0xDF3D4047A6D2234CULL },
+          { 0xF4626D938FC7D419ULL, 0xAFD63CE496882975ULL, 0x24AA21F29C0F9DBFULL, 0x48FA6F5229FD40DBULL } },
+        { { 0xAED925AE1F1322D4ULL, 0xCB0A69404ACCDCBBULL, 0xEA1E6C4CA311F822ULL, 0xDBB2AF6AB1F96144ULL },
+          { 0xAA492B4F4A8C5311ULL, 0x9A9FC9787B7E3A5FULL, 0xA1B60D1ED6433F9DULL, 0xEBAE75B92F13561AULL } },
+        { { 0xF069A33CA1138F7BULL, 0xC4C1C93E2DF2E8F2ULL, 0xCAFA8A267F9B5F0BULL, 0x1DBA7B597F261FD4ULL },
+          { 0xDC82D8C7A39BF268ULL, 0x8136E6B7998232C0ULL, 0x3AE19006BB8007F5ULL, 0x6AAF7D3E5DE7EFC6ULL } },
+        { { 0x8DA87770179A70AFULL, 0xEC9D429A9B64DF28ULL, 0x31BBE82D5F5305C6ULL, 0x348A2E442626919DULL },
+          { 0xCA84861487B66E82ULL, 0xB2A7C2C5B7E13E5AULL, 0x8C747BCE00230105ULL, 0xA1B9FA79F55A3E80ULL } },
+        { { 0xC7476D76C4D3A201ULL, 0x36E926A4FD9B9EEFULL, 0xA86A4FBF931ADF5FULL, 0x3A4EC851999C9E1CULL },
+          { 0xDD8596F768635F89ULL, 0x27D31E5AF73CD55BULL, 0x69E03C11A4774A8BULL, 0xC99A2EF82F6262DEULL } },
+        { { 0x1EFAE72FDC978567ULL, 0xE15DA68840DC1F98ULL, 0x84E935D62FF1F60BULL, 0xB1BA52D88334D457ULL },
+          { 0x77FA482A362DC291ULL, 0xD9A46CB0BAFCD40AULL, 0x7C5F7CF713DBB78FULL, 0xA46BAEC7A86943A7ULL } },
+        { { 0xD228EEA512350DA1ULL, 0x19414C77C175F043ULL, 0x2718B7B969612C2FULL, 0x0AE6EB3D8EF2AAFDULL },
+          { 0xC73E09F370A14BC3ULL, 0x66D468F0ED43DA4BULL, 0x2DD034F7FC4189B5ULL, 0x99CDEE9FB6006CAEULL } }
+    },
+    {   /* 19: (2j+1)*2^76*G */
+        { { 0x5572AEA8750E4F5FULL, 0xCBF5CA9AA567E0E6ULL, 0x388FF0F7AA02F29AULL, 0x55D9A959844B5AEFULL },
+          { 0xC858EB76BCA97DB0ULL, 0x4C9810C633AD1B15ULL, 0x766D574FBCC8EC52ULL, 0x69CB7F9AA5DAD203ULL } },
+        { { 0xC06A9887FEB142E9ULL, 0xC176EB064607FCFBULL, 0x794D86838FAED480ULL, 0x4B0043EBE46F3E11ULL },
+          { 0x04B2C52D62C68552ULL, 0x0F23290F3A125888ULL, 0xDB17884636222D87ULL, 0x173CCF23A30DAC1AULL } },
+        { { 0xF6DD4AE717F1AA96ULL, 0x13D7A5F734FF6481ULL, 0x32728DCBB73463C5ULL, 0x79EAD27992AD6FC2ULL },
+          { 0x80BA71CE4B0A3FB7ULL, 0xDE84D71111B3955AULL, 0x1A6E439356256542ULL, 0xA95DE9CFFBAADABFULL } },
+        { { 0xC805CA72F93A9AE6ULL, 0x8EE0AA059C77F8ADULL, 0xB5279E3631AD743FULL, 0x318E0050F24DA1CEULL },
+          { 0x184B5694DC447D79ULL, 0x94536FDBAED3A8EEULL, 0xF4D17CA51E504BD0ULL, 0x2792EE1119CE9299ULL } },
+        { { 0x137945B4DD30585AULL, 0x95FF8A1AA3501495ULL, 0xB88032F490C0A4B4ULL, 0x6BBC5471D2F1E43BULL },
+          { 0x6AF97EEF348B05F3ULL, 0x09F0428102F9EAD9ULL, 0x4A9EE2B15F2226BEULL, 0x467B189B0C1529F0ULL } },
+        { { 0x2624F808C0136275ULL, 0xA647C00173877535ULL, 0x89B51A90F7760D78ULL, 0x940148C610C1FD11ULL },
+          { 0x5D63A1115997AA47ULL, 0x5D4B3AE5604E1A42ULL, 0x7AA24C4AB505D669ULL, 0x6967F95F1367A4F7ULL } },
+        { { 0xC3A13DD39F0FE850ULL, 0x864D230BE511A7BDULL, 0x91B56C928DA5F98EULL, 0xC41833926039B49CULL },
+          { 0x1358F446BD38666DULL, 0x065A7EC9E01A0AF0ULL, 0xEB8095D426AFD558ULL, 0x3537FEC9C8D40F7AULL } },
+        { { 0xCFE4413774937FBEULL, 0xC0B04DDDF051BA6EULL, 0xE0C14001AF96F546ULL, 0x2BABA3F627C67D70ULL },
+          { 0x9390E557573A1DF4ULL, 0xEC2DC4B190AC8110ULL, 0xD783B0CD924EABC9ULL, 0x77E5C765B2208B88ULL } }
+    },
+    {   /* 20: (2j+1)*2^80*G */
+        { { 0xD4D3D2DE4351964CULL, 0x346924376F5412C1ULL, 0xAE5ABCA185755C08ULL, 0x6E29F959BE28C47FULL },
+          { 0x118824BD563FD88FULL, 0xEF640C527A0BFB63ULL, 0x5052EC6CC184246DULL, 0x34565D9F500F32F6ULL } },
+        { { 0x3F9501038C0E49CCULL, 0x41232DA85BC5400DULL, 0xDD8288DECBB740EDULL, 0xD691D4A978970F6EULL },
+          { 0xDD0BB4C1D00F4152ULL, 0xAC5BE1D02AD043F2ULL, 0xF7FBBDB5763E0C52ULL, 0x7A79E7874B78F397ULL } },
+        { { 0x3D876B9F2B9B930AULL, 0xDEB1352A4530F58FULL, 0xDEE5B7DF7A7BBC49ULL, 0x2A5D6846A2E0D7C5ULL },
+          { 0x86FF345F3B2CAECAULL, 0xEA5B73435E271685ULL, 0xE5CCF03903C4AB58ULL, 0xDC3D7C096876476DULL } },
+        { { 0xFA7DCBD2816959EFULL, 0x7679D056741DB59AULL, 0x2F0431412E275DF8ULL, 0x8764496A389BB526ULL },
+          { 0x660311CBE0CD5010ULL, 0x2856AD4172F9E3F1ULL, 0x9E0B412796ED961FULL, 0x599B69D61D002FFDULL } },
+        { { 0x639409CE3AEF0F84ULL, 0xB0BB506A871C75B9ULL, 0x33DE3FAC17ADB8CAULL, 0x94D393BC812471B1ULL },
+          { 0x85AE61B9378BA7C1ULL, 0xDD3F402650ACF12AULL, 0x1E1CBC386B239A07ULL, 0x5A826AB4EB4B63F2ULL } },
+        { { 0xED455784EFFED1B7ULL, 0xE2DBD126564AA3B4ULL, 0xD17509702D34BD2EULL, 0x4A72B5A0889E4E2DULL },
+          { 0xB5F29FD89601DC5FULL, 0x85E64B8EC74D9845ULL, 0xC8C33FC047C8EA96ULL, 0x3531E6EA4A1D20E2ULL } },
+        { { 0x02043F25D0467317ULL, 0x9141DC41D8D9186AULL, 0xA78666F2FADE7900ULL, 0xD7F01CFC5A371E15ULL },
+          { 0x5CB957D5CF7D014EULL, 0x28A01743697FBD89ULL, 0xEC7361406C15EF57ULL, 0x888DBBD987726C26ULL } },
+        { { 0x3BD7590A7DEA02C1ULL, 0xE4FBB9B7C774087CULL, 0xBE80BF9D91E31206ULL, 0x7E50A0B9F77C371BULL },
+          { 0x33C946DFED45C201ULL, 0x7423934F158E1B28ULL, 0x616C6F1DDB8B9517ULL, 0xC3405D3C4E0FE29CULL } }
+    },
+    {   /* 21: (2j+1)*2^84*G */
+        { { 0x28A7D4110CB71280ULL, 0xC141C259A8456311ULL, 0xC00F2EF0796F458EULL, 0xFF046A9EB2BFEED9ULL },
+          { 0x7EC3271F5EC33919ULL, 0x012B6E6EBD28487AULL, 0x0A01EDDBDD4CFCC9ULL, 0x432F55ACC0953A17ULL } },
+        { { 0x5F2782AA33CA3CE3ULL, 0xEF2B1865AB6A77E2ULL, 0x1A95BC1F5312231FULL, 0xF717C45D14D3DCD3ULL },
+          { 0x6894CCDB50ED88E9ULL, 0xAF53E2BDDC176DF0ULL, 0xCA9B54ED0AADEE55ULL, 0x422C40768C99512DULL } },
+        { { 0xC368430D5B28CD88ULL, 0x738E097502A9BD9AULL, 0xC2FEB5627F91B32CULL, 0x60E269B4F3370B20ULL },
+          { 0xE29BA8A42BE2066CULL, 0x02456138C6C846B0ULL, 0x609211889728DF76ULL, 0xFE00175A6579F0A9ULL } },
+        { { 0x153B1932861CC594ULL, 0x964BDD1704D0536BULL, 0x0AA5BA05FCB46855ULL, 0x799297A1E6739949ULL },
+          { 0x9E9110920F8D309EULL, 0x27DA86AE0BAC6E90ULL, 0xE1069118789FE501ULL, 0x132FF18CD523C9B0ULL } },
+        { { 0xDC8C47A2572D0ABAULL, 0xD8D190ADC77E1B16ULL, 0x79EE0EEB5501241DULL, 0x2D9BE94EFE428070ULL },
+          { 0xF8F731FB31FA0876ULL, 0xBAD1C67988B710E6ULL, 0x295EF934B619D91BULL, 0xA9708DB5E9E898A2ULL } },
+        { { 0xE0C07B48355E8732ULL, 0xCFA62EDE506D1E31ULL, 0x60CBC6531492C243ULL, 0x2127039EC8824216ULL },
+          { 0xD59235F460CACC07ULL, 0xD693F3F3BAD7BD68ULL, 0x0194B9DBBB7F0A5CULL, 0x85219C6F23AE35AAULL } },
+        { { 0x6091340CF2083347ULL, 0x9E1AE3E6771A5322ULL, 0x97AD0F5ABA02B42BULL, 0xFAB5B54B2BD8E0EBULL },
+          { 0x9CCC9CD83D38FD2FULL, 0xC05E37A616A69AFAULL, 0x3C87AAF2260A3EAFULL, 0x5758D116186D4150ULL } },
+        { { 0x3F672614FF572554ULL, 0xF3842E4718F4DAB7ULL, 0x579096770B7EA56FULL, 0x685D275727971FCAULL },
+          { 0xB71AF6D0A0979E03ULL, 0xC58AAA2AC0F4CCA4ULL, 0x06E39C8041E0377CULL, 0xA82F89C220AB45FCULL } }
+    },
+    {   /* 22: (2j+1)*2^88*G */
+        { { 0xC7D0B24CC5852E50ULL, 0x8B2C7E63CF570CC5ULL, 0xC1F9AA2349EE7EFFULL, 0xE486C7DFFEABB058ULL },
+          { 0x66BA3CADAECF107DULL, 0x694463D63392EBD8ULL, 0x9EE88A5C9F51E05AULL, 0x51FD75ED5606A12EULL } },
+        { { 0xC66AA6455C881907ULL, 0x142C86735B00B1DAULL, 0x964105CC66AE0415ULL, 0x4ACF44BB8E2FFB7CULL },
+          { 0x2926B456F63CDAFCULL, 0x99352B2F7CD84B25ULL, 0x3544285AD10A5457ULL, 0xAD99A8FE0FFD587BULL } },
+        { { 0x82BAE0697439383FULL, 0x34FFA562B601A2AAULL, 0xDD7AA292C8234EECULL, 0x4DDF22834188A649ULL },
+          { 0x632FA81823D52337ULL, 0x3DD5D045131F8269ULL, 0x74ABAE97D38C0C6BULL, 0xE71C627B0D91883DULL } },
+        { { 0x26DC88155822B4F4ULL, 0xA5353AFCF865DF8FULL, 0x1334E9E0797BF39BULL, 0x58B065791379879EULL },
+          { 0x6607A8210C60FBCAULL, 0x1CA4A076FC4E5259ULL, 0x027CA55F0262836CULL, 0x55A98AA4145A2C37ULL } },
+        { { 0x4B2BD10C34FE39B0ULL, 0x8A3173CD74B4DED1ULL, 0x763A441C23381F35ULL, 0xA345E058A64B3529ULL },
+          { 0x3709480BABAF79DCULL, 0xCE8C6A75AB369DF5ULL, 0x91F0855B28F9D949ULL, 0x7C6DD5A6D5CAA70FULL } },
+        { { 0x3FBE07B9926695FBULL, 0xAFD0BB9FE43ADEE1ULL, 0x201ACB8746D6CCB6ULL, 0x3A10BF830190A2C8ULL },
+          { 0x755C72B2A4EB7E47ULL, 0xF28FEA6C43D45288ULL, 0x76203848688A65C5ULL, 0xB5D585B3EC1A2715ULL } },
+        { { 0x241A8E967D2C8614ULL, 0xA7B0960A60584596ULL, 0xCA5CF5AC30912876ULL, 0x12FBDDFAC9010433ULL },
+          { 0xF077BC1D58B0B174ULL, 0x4D4258239C19F495ULL, 0x33FD91428CD2CFB5ULL, 0xA5FF20D290278068ULL } },
+        { { 0x53F764302D9AEEAFULL, 0x05D0794CA05AFC86ULL, 0x7B8AE3A1FAF99A30ULL, 0x8BECE859A2B97877ULL },
+          { 0x55A0DA3C85F9EB5EULL, 0xBB22038F6F8980F7ULL, 0xFBB8910B0EFFC368ULL, 0x35F933C4C50651FCULL } }
+    },
+    {   /* 23: (2j+1)*2^92*G */
+        { { 0x84B6B8EC2B519178ULL, 0xB63B9998A43D1FC5ULL, 0xCFE08CF8B5E2EE0AULL, 0xF41D7F4BB5E50430ULL },
+          { 0xA7A1665DCA6A3551ULL, 0xAB49ACC36919E1F9ULL, 0xF1046DE3FAA82347ULL, 0xE6A669BEBD9AF8D6ULL } },
+        { { 0x1A71313E1E3501D9ULL, 0x1BE82CE1BB61FC8BULL, 0x3332D691D62D3E61ULL, 0xD65F827ED62D4E7FULL },
+          { 0xAB9446C6EB55759EULL, 0x61C13AAD5D730BE1ULL, 0x537B7CA5166B87FCULL, 0xF24B60FCF09A90FEULL } },
+        { { 0xCB62FE240F2ED84EULL, 0xE7994DF35FE2EA12ULL, 0x5EE6C8B5782CC0ADULL, 0x55A9B5B6DEB05C38ULL },
+          { 0x579DC550546495A3ULL, 0xE8FFB4D712A0D8F0ULL, 0x29174D190ED7F43AULL, 0xC4F22196AC9F19ABULL } },
+        { { 0x9BD2CF87075495A2ULL, 0x9FDE1EB648BC00B2ULL, 0x1F7ED60A62548BC4ULL, 0x79DE576DC7DB71DAULL },
+          { 0x802C8C6AAAEC6FB8ULL, 0x8314F5096493A746ULL, 0x785E6DAE47DC79C6ULL, 0x3B2D3D0E6B186A02ULL } },
+        { { 0xEEE92ACC82D1E7BBULL, 0x24C3FF903511964CULL, 0xE264B3695957E555ULL, 0x8FE04E32162404B6ULL },
+          { 0xDA759AD0DA62E84FULL, 0x5B9164646F046A8CULL, 0xE5D6CEA57A8DB34EULL, 0x3987DB5022F6358FULL } },
+        { { 0x101A4AEC69F7C360ULL, 0x4EFCD577E48085C2ULL, 0x50A94A6368D224E2ULL, 0x3AF4990957EDF8F1ULL },
+          { 0xD39DC2AA687D7A7BULL, 0x48554DD62760895CULL, 0x531F86482E733C33ULL, 0xD1706030D3B1D91DULL } },
+        { { 0x39A523AE770373BEULL, 0x213D06221263D3B5ULL, 0xC1A582F3FE227C4EULL, 0x31A7E05C623C8076ULL },
+          { 0x8ED78790E90950A8ULL, 0x8CE82B9951A25430ULL, 0x021B0AAE3423DB1EULL, 0xC23D2EF3F8D1DE67ULL } },
+        { { 0xB42610EDCB923B45ULL, 0xA33A9FBFF13E24BDULL, 0xD15513462DD98458ULL, 0x740A66481356D23EULL },
+          { 0xA8C13E3851ECAA5FULL, 0xA897993907C8480BULL, 0x2F4E4788A75606CFULL, 0x7F6D048C25CD523FULL } }
+    },
+    {   /* 24: (2j+1)*2^96*G */
+        { { 0xA84AA9397512218EULL, 0xE9A521B074CA0141ULL, 0x57880B3A18A2E902ULL, 0x4A5B506612A677A6ULL },
+          { 0x0BEADA7A4C4F3840ULL, 0x626DB15419E26D9DULL, 0xC42604FBE1627D40ULL, 0xEB13461CEAC089F1ULL } },
+        { { 0x52EF40E2518473FDULL, 0xBBB9026BC6973391ULL, 0x85292AB99728A9E3ULL, 0x1064063233318BA0ULL },
+          { 0xAFA6162E785CF805ULL, 0xCFBE190D0C21D039ULL, 0xC8E7829E6585883CULL, 0x9C6832823B8BA2D8ULL } },
+        { { 0x3567EEC8653F30F3ULL, 0x2B423ED2EDA238DDULL, 0x5EDA410D54083F21ULL, 0x38C8AD8FF05F27BFULL },
+          { 0xA060E749EBE9217BULL, 0x6583FA982959DF37ULL, 0xF3909654DDBD641FULL, 0x83C2617876DCB116ULL } },
+        { { 0x543E6911B6EF1584ULL, 0x77A9A2A38F920CBFULL, 0x5858FBE3FD351842ULL, 0x6FCB8CBCE860BB09ULL },
+          { 0xC3C9F7C21D3110F2ULL, 0x5992F6D6928A4325ULL, 0xD54C0823AC30459DULL, 0xA8F1A83D8B721D76ULL } },
+        { { 0xE8F51340462255EFULL, 0x50D71D346764078CULL, 0x73515C90DE45B0EEULL, 0x7811D0B93F76E2BDULL },
+          { 0xA58BEF9B1BE3252EULL, 0xF51ED0513AD43768ULL, 0x54C02E9401B85132ULL, 0x99BB76370BB5AC7AULL } },
+        { { 0x93E110F1353D2EA7ULL, 0x9EED0823A3FA8650ULL, 0x0C7B729D5F816F2AULL, 0xC3583D944A8B50CEULL },
+          { 0x2B183E9E0B667BBDULL, 0xD6C925A6515F1C43ULL, 0x5964627EF89FCCCDULL, 0x53967AC09391E90FULL } },
+        { { 0x8EDDF0E0502E3099ULL, 0x53F213A662840165ULL, 0xF3A0F018BB7AD00DULL, 0xD591CF283CDEE501ULL },
+          { 0x33BC2765455AC5AFULL, 0x5CF2EFF88B116FD6ULL, 0x4E51330D350BC582ULL, 0x87EBE5CFC478E6E4ULL } },
+        { { 0x2B26564632A940A5ULL, 0x4A435EB5A414E6B1ULL, 0xC01241E1A4F9E871ULL, 0xA0AA0D612F3235C4ULL },
+          { 0x93F882A68B950422ULL, 0x6C691CDDA7D1BF93ULL, 0x19B34CF9A0181F3EULL, 0x22340EBA76F76428ULL } }
+    },
+    {   /* 25: (2j+1)*2^100*G */
+        { { 0x6628D837008E2DF0ULL, 0x32C3B2574328E5F7ULL, 0x012C29DF8BBE0F50ULL, 0x2EB3910BDE2AB995ULL },
+          { 0x0910CC4ED274EAAEULL, 0x9540D120ECF65F49ULL, 0x77D37D348DA4999FULL, 0x3F29C02337474B3AULL } },
+        { { 0xBF02B84B682867F0ULL, 0xA21426E21B190A39ULL, 0x2AABD16A780900F0ULL, 0xF6E9DB88E64C7CE2ULL },
+          { 0x475B3AF10F1861EAULL, 0x27041BA5F970B623ULL, 0x81D93B76E8C0D5B1ULL, 0x53CA790B7AD2AB74ULL } },
+        { { 0x9ADD0438F20D6102ULL, 0xF06D5378A3453940ULL, 0x785C15B9B6199A5EULL, 0xFD1DDB38760E449DULL },
+          { 0xDA0A6491AE003B7CULL, 0x163E191211513983ULL, 0xEDAA1F1F7883B700ULL, 0xCB54B8739050638AULL } },
+        { { 0xF3F7341DC2C77CB7ULL, 0xEF6D940902DC15B6ULL, 0x9FE4A73E65EE698FULL, 0x61A273C22599901DULL },
+          { 0x854611F81DDB25EDULL, 0xC5C5AD9A70AE1F74ULL, 0xF4EA219F5EEB0CC9ULL, 0x5BBACD334D3AD3D3ULL } },
+        { { 0xB998D56E377D8976ULL, 0x5E173A38E30F292DULL, 0x4CB02C98229D04B5ULL, 0xCD2E8E65EF7601B6ULL },
+          { 0x11696F41C867BC22ULL, 0xF60EDE0F35428C05ULL, 0xFC31CE8F2D46FF68ULL, 0xF58EAD362342A31FULL } },
+        { { 0x609B306C2C67C998ULL, 0x9A9B07EAA3CF1B86ULL, 0x40225EA8A4304C25ULL, 0x9BD61F9C38223EFBULL },
+          { 0xC340AF9C28199514ULL, 0x927D9C1E90424B18ULL, 0x5C8F2096969450FAULL, 0x77B20409916C6F5CULL } },
+        { { 0x6A45E17BEAAFA568ULL, 0xB4CD7A97701E2276ULL, 0x12AE27A41117A016ULL, 0x7AFAEB4F79707775ULL },
+          { 0x3ED53A2F81C1F2DFULL, 0x972E694329D39023ULL, 0x895D14135041365AULL, 0xC6EFE61933FBD27DULL } },
+        { { 0xB7E703E50E59DDEBULL, 0x483E629CAD1E98A8ULL, 0x061D94C1496B0C3BULL, 0xD9A002227E2412F9ULL },
+          { 0x5F393FF80F0AF5A4ULL, 0x8562A8BCAB5F18CEULL, 0x43C60F8A43670581ULL, 0x975EB2F93B7A022CULL } }
+    },
+    {   /* 26: (2j+1)*2^104*G */
+        { { 0xC739A5EA3ECCA7E0ULL, 0xA7D2C98F6743333EULL, 0x0FEF6335224D9428ULL, 0x7EF2EE3C5C792A0CULL },
+          { 0x302B22DD552AC094ULL, 0x81B21450DFBD3D20ULL, 0xA4F67F51D5E609DBULL, 0xAFB6862730ACC011ULL } },
+        { { 0x72F3583DA33F0FFAULL, 0xCAE4CAC611807A41ULL, 0x7624A576C9D9C641ULL, 0x3704572716887ACDULL },
+          { 0x5FED3FC660FA35ACULL, 0x57BA3EB7AA8BF2FCULL, 0x841BB4BB8895FF4CULL, 0x5C6408C61A71E74FULL } },
+        { { 0x3C6F986532603513ULL, 0xF6C64DC6814A0095ULL, 0x2D1EAA42C08BB697ULL, 0xC2A979E54298DB72ULL },
+          { 0x95755B2C3C3505B9ULL, 0x8CC666DF48151449ULL, 0x54278081935BCE7EULL, 0xEF9DD74A1E6EB5C8ULL } },
+        { { 0xE646FFB1D9FDEE3EULL, 0x681F97716C302E01ULL, 0x172BB15CDB17AFB9ULL, 0xC9F4186AB1FC59E1ULL },
+          { 0x51E66CC5CCED22E7ULL, 0x44E1531C7B58DF4FULL, 0x0DF73142B8832143ULL, 0x09420A7F3CB3A341ULL } },
+        { { 0xF0CB3E674814F217ULL, 0xA9DA3F7B8756CFFAULL, 0xB08A0024F83BB6A4ULL, 0x27DCF55B80480256ULL },
+          { 0x14C94B588CF2ED4CULL, 0x0A4E8FAB191FC3BFULL, 0x0BC8BAB094A02A38ULL, 0xBE18F54F548D5DEEULL } },
+        { { 0x75A2A4FD5B9E310CULL, 0x313CE5B9B84CFD4AULL, 0x9C8D24AC33959187ULL, 0x3B8B0203B256EA4BULL },
+          { 0x99416605AD19FC9BULL, 0xA8FF804B82B30583ULL, 0xD6176E377C4117A6ULL, 0x91117C4EB033615BULL } },
+        { { 0x8F1E1E2BA7615B36ULL, 0x2A4FF1E8C7F3C15FULL, 0x105C2406F914C337ULL, 0xA5E7398C5BCC103AULL },
+          { 0x4D982E3949136D80ULL, 0x47FFC19370B613C0ULL, 0x46438DEF2A15F8C5ULL, 0x1F3FF58DC974E4CEULL } },
+        { { 0xBB7B0432ED3E10DBULL, 0x47732E1AC8B87159ULL, 0xDEE0443FF4EB61FAULL, 0xAAD218355AC9532BULL },
+          { 0x63535ABD6FA05FB3ULL, 0x72032772B31CBA27ULL, 0x3A7DDE28FD5F8B4AULL, 0x793B1EEEBAF82E3BULL } }
+    },
+    {   /* 27: (2j+1)*2^108*G */
+        { { 0x6701F090EC49E853ULL, 0xA9CB53529975E04AULL, 0x57802554EB5FA77AULL, 0x0E51416421640AEBULL },
+          { 0x336E3D1376405CB2ULL, 0xF568394190C9EE36ULL, 0x278EB4A53A91030DULL, 0xCF331CEA65905469ULL } },
+        { { 0xC4A23F1C1DC6AFADULL, 0x1BD3D92295F80F46ULL, 0xDE8ED25F64C0C677ULL, 0x977BA06765CACF25ULL },
+          { 0x4D62CDC51D7FAA09ULL, 0x2F75A1241DDA1A15ULL, 0x8833FAA0D081D999ULL, 0x1BC3BC43AEDB8FA2ULL } },
+        { { 0x65F745D7DD81983BULL, 0x10220FD02F8EAB78ULL, 0x4C3CB60771FFFACCULL, 0x3BC328612A123ABEULL },
+          { 0xBD99F28511A637B6ULL, 0x4334885A8FBB848DULL, 0x250B305CAAF00A7FULL, 0xA6B5826DED0C8A20ULL } },
+        { { 0x75F76C1FF7C8537BULL, 0xCA8CACB7441F8061ULL, 0x51BAEFE1CAF96C21ULL, 0x67CBA4E8E9EC04ACULL },
+          { 0x1CEB5057385726DAULL, 0x7BDF043ED0403F6EULL, 0xA1E1C61F2FB1CC04ULL, 0x5B65EDEDEA1C8984ULL } },
+        { { 0x368228CE4B6A1226ULL, 0x2AF9E9C8AB546539ULL, 0x1A073D686468F392ULL, 0xC5958EA6D5749993ULL },
+          { 0x1C100688C66961D4ULL, 0x96876DBEBA2108B9ULL, 0xECBE19719D45BD82ULL, 0xA031A882F70F7DD7ULL } },
+        { { 0xE4DE3F85B3713A52ULL, 0x25C75B8C683C5417ULL, 0xC1FCC0C3C74A5FA0ULL, 0x83F07BF82E425CA7ULL },
+          { 0xA111273F9FB0FFB6ULL, 0xCAB5B760E1FB45D2ULL, 0x049794C912C7D3CFULL, 0xF2EC4F10A25B8BB9ULL } },
+        { { 0x9AD9A09121BA21B0ULL, 0xD855D8D200C26553ULL, 0xE6F680686EAE0076ULL, 0x938DBA4F9B5A42D4ULL },
+          { 0x374D995E4D5B4325ULL, 0xCBF1BBEE3F2B697CULL, 0x6E9AADBDD136B90BULL, 0x48AFC0A89AF75656ULL } },
+        { { 0xB53E49A63F2B24F1ULL, 0xCFAEC64F5FE76BCFULL, 0x3A81DAACF3B49779ULL, 0x7EFA89B76CA031E7ULL },
+          { 0xD65DC5D4AF8E4B83ULL, 0x1DBADF3AC554A455ULL, 0x78CED222FC16AB21ULL, 0xA99FF3EC61F4AEFFULL } }
+    },
+    {   /* 28: (2j+1)*2^112*G */
+        { { 0xF0699BF9E2F2B734ULL, 0x79C3BB5B5501D267ULL, 0x0634A786F1164457ULL, 0x224A02299EECC99AULL },
+          { 0x840F585491EC7FDFULL, 0x07B704B673C7AFD0ULL, 0x149A08AD871D7FFFULL, 0xFA41A8D29B6D22B4ULL } },
+        { { 0xC9E92F475D254033ULL, 0x78368280C2A4707AULL, 0xFCDADFA688B6F240ULL, 0xE63502EE153CEC59ULL },
+          { 0x7E8AA88968F05E3FULL, 0x2C915A0C4BFCF360ULL, 0xAD74E80F0709CE48ULL, 0xA7C5837B1F621E11ULL } },
+        { { 0x2B9609AFE1E08F33ULL, 0xB1FD631DCB982CCAULL, 0x12AB45C533F000E2ULL, 0x5648DEC272EB9687ULL },
+          { 0x26EED9AC4269F1C9ULL, 0x3E72BBF2E0117951ULL, 0xF478F5C64D77A269ULL, 0x95FDDC70708F7043ULL } },
+        { { 0xE3B8200BFAB98C43ULL, 0xC5BA57757E3E8AA4ULL, 0x95152F8ECBEC8F03ULL, 0x1941C19F3380ED26ULL },
+          { 0x8FA210DA22ABE217ULL, 0xD8F62D3DB8DF5639ULL, 0xE2B6DB2A48FB8C53ULL, 0x8E66B834595DB2B6ULL } },
+        { { 0xE6670D1042D8C2F4ULL, 0xD73321B9F79C0189ULL, 0x7FA73BDE364D8A0BULL, 0xFC586431D10B4BD6ULL },
+          { 0x0118C88FFCFD274AULL, 0x29E2CB05EBC338B4ULL, 0x4A33C279E6BDB4ABULL, 0x99FADE52CE8AD956ULL } },
+        { { 0x12B077F1D1FF0F18ULL, 0x07E0BCE70549A42DULL, 0xA9BFBACF9AF2D6C2ULL, 0xEE993BA6B0C4F1DEULL },
+          { 0x8013876CA50782ADULL, 0xB435C80DF70F2CB1ULL, 0x1F6C5D58CE85BCFEULL, 0xD87FD4D94578DB2CULL } },
+        { { 0xE47A7F754FDDE3FCULL, 0xE5A8889E05628CC9ULL, 0x8DA0DC41A52F31FBULL, 0xBA49517AAE9FE242ULL },
+          { 0xA3EFD232EFCB7D01ULL, 0xDFDE1C81E3292CAAULL, 0x0B4EE4376013359AULL, 0xA88FB6E1CA945595ULL } },
+        { { 0x78892A2F7D14DA68ULL, 0x4A64C1F84DD20173ULL, 0x4DE2CF82737612B5ULL, 0xD3398F17422AF1BAULL },
+          { 0x3F07631B55A90E3DULL, 0xAFC7A7922D41453AULL, 0xEB7252D1E8A2B020ULL, 0xA34AD4D4D1FD3D60ULL } }
+    },
+    {   /* 29: (2j+1)*2^116*G */
+        { { 0xEA6065AD7789B84DULL, 0x167D5EE4D1041CE2ULL, 0xCDB5D111B56493FEULL, 0x4A89A61457374B4CULL },
+          { 0xEF9B7D7F018E3EA8ULL, 0xA72E280634711999ULL, 0x08C2EA979FE677E6ULL, 0x45B04E87ED480D5CULL } },
+        { { 0x6E76B23742E14C34ULL, 0x834C5EBE07327593ULL, 0xA2A9B30E781377C9ULL, 0xCC9F9648A870EF92ULL },
+          { 0x8892157A94BE556BULL, 0x299917F1828C7E05ULL, 0x43116633DBE689DBULL, 0x829BFF2CB5F8C96FULL } },
+        { { 0x87DE6C8595DE4837ULL, 0x8D4286C82DE5E74EULL, 0xF4F58C1D0AD98A75ULL, 0x5C618DA1FAAD041AULL },
+          { 0xC0B8583B634A7DEEULL, 0xECD36649642278CAULL, 0x88B80E3849FD9671ULL, 0x4C719117BCF3A19DULL } },
+        { { 0x2589342656635396ULL, 0xF2CAE15A368A6C0CULL, 0xE585E2DDE671C11EULL, 0xAB8A886A915A06A2ULL },
+          { 0x7E38FA6A3FC92C23ULL, 0xB9360583F7D2D6ADULL, 0x5668FF8248BCD5ABULL, 0xE773CF7C7DA84319ULL } },
+        { { 0xAC243E5881DF49C3ULL, 0xA9E890866D069A35ULL, 0xDEC664B8B695604AULL, 0x62B7C8514241838CULL },
+          { 0x9BE3680FF6341C21ULL, 0x8FB53B61387CB550ULL, 0x594896AE8D4922DBULL, 0xA71ED62152AE0335ULL } },
+        { { 0x3AF146E2E44F47D0ULL, 0x1B59F5DE949F002FULL, 0xF9751F0869DFC979ULL, 0x4897BDBFA45C89C5ULL },
+          { 0x81E501AACE1320BFULL, 0x526DA001A8F01195ULL, 0x34E8ECA9417B093FULL, 0xE77DC20F7AFC138CULL } },
+        { { 0xE61BCE9B71581BD3ULL, 0xCBFA318DF6190786ULL, 0xC451E07BDA722F2EULL, 0xEB1CFCB556486576ULL },
+          { 0x5BCE8D985CD98A09ULL, 0xB39CF319C5BD1A64ULL, 0x5044005EBE4D6E3CULL, 0xFD47CE7571F94D20ULL } },
+        { { 0x90122BDB673A3111ULL, 0x18B82E417B4C818FULL, 0xC0D54AC2E72576A0ULL, 0xA1FD8BBBE48E1E09ULL },
+          { 0xB887E650B8C704EFULL, 0xC7EC4945BFD51169ULL, 0x9BD77E07BC0916C0ULL, 0xAD215D8A34A30856ULL } }
+    },
+    {   /* 30: (2j+1)*2^120*G */
+        { { 0x3438C84A72BD05A0ULL, 0xBA82337D0B1FC80DULL, 0xEDC2F995F36D1F90ULL, 0xE5E892363A31885CULL },
+          { 0xC936DE2BE1A69F5DULL, 0xCA73995B9CD099AEULL, 0x1301EB01E79B5C3EULL, 0x77439DE4DA1B87D2ULL } },
+        { { 0x4F09528101467D6BULL, 0x357D712952A24B51ULL, 0xD1018611642CF1D8ULL, 0x5D2393DF9435CCF5ULL },
+          { 0x07C673C6B1BC5458ULL, 0x72A707A7510473A8ULL, 0x7ACBD85B2D5AF46DULL, 0xE66E63F263FD0F7DULL } },
+        { { 0xF0B1E93C9D159F7AULL, 0xECF93A9CF242E590ULL, 0x3ADCFB2BD2FF873FULL, 0x453657A53AAB893FULL },
+          { 0x99C22B708A02FB78ULL, 0x6F949BD4E81DDA5DULL, 0xDA2EF0913A01C728ULL, 0xBFB5AEFF88023DC5ULL } },
+        { { 0x31EDEDF3D46CB42AULL, 0xBC052853A7239093ULL, 0x4D14ADEAA13D73E7ULL, 0x435B54CB07B04C46ULL },
+          { 0xB7E24DEDDAF72DD0ULL, 0x5EDC4C79433949A6ULL, 0x49F4A54CC1E0585DULL, 0xD726C031E4718A1AULL } },
+        { { 0xA97D941B1D2FC263ULL, 0x89CF813E5B65D57BULL, 0x19FBC47C4E13DA0EULL, 0x1805B819E14EDD7EULL },
+          { 0x266470B4F0870EC7ULL, 0x9C8C1AF8E551ECAFULL, 0x5858DAA86BCB3148ULL, 0x101F642809438171ULL } },
+        { { 0x9A2B1B70C076D1DFULL, 0xF41E2081427FA1B3ULL, 0x40617A8A2A775F45ULL, 0xC73AAF4366D3194FULL },
+          { 0xD279D516E5AD6605ULL, 0xF75B57A51D893720ULL, 0xF9CE01BE3BBCDCFEULL, 0x9201EC69ECCF916EULL } },
+        { { 0xD3683F7985A745C7ULL, 0xBC8A2738C17EAC07ULL, 0x77189B6AF61D52C1ULL, 0xE3DDEE8F7D5C36D2ULL },
+          { 0xA39F0940778EFCC2ULL, 0x7C28C2F17BD027B1ULL, 0x1BE51B86AA7BD8F4ULL, 0x487199D391932B87ULL } },
+        { { 0xF4C733E84D4170B3ULL, 0x40144156FC3A3587ULL, 0xAF68AA1186C0A1D5ULL, 0x45C78DDC2035F1E5ULL },
+          { 0x16EFA3ED511FAA1DULL, 0x2CB046606420CC73ULL, 0xB0E1A9D144FB3A51ULL, 0x11AF9946238D5C0CULL } }
+    },
+    {   /* 31: (2j+1)*2^124*G */
+        { { 0x21579992FAB5C2CFULL, 0x5312F0C21FB084DEULL, 0x71E7474104FA90A4ULL, 0xE4107E431E221F50ULL },
+          { 0xD028403F2B955C2BULL, 0x3C7892DCFF7B2410ULL, 0x3948C668741C2B32ULL, 0x1E5F11E6CF701C9AULL } },
+        { { 0x5BB5B63C09B67B7EULL, 0x766B7B2B911C3D48ULL, 0xAACF9701DEBC1142ULL, 0x85DF9A65EE179F7DULL },
+          { 0x88B3869E830A36E3ULL, 0x86FA949D1FBC6EA5ULL, 0xBB6B7D5EFF0E2973ULL, 0xA6B4B7AA39AF6308ULL } },
+        { { 0x127CFDE60B3510D3ULL, 0x85D3166704A1D6E4ULL, 0xA8D8A1865C2D2928ULL, 0x23C493FE7F9FCD08ULL },
+          { 0x13462EC43AE89A47ULL, 0xF799E35E26B9DBD7ULL, 0x0C275D9E4EFFE6D8ULL, 0xADF456A9E4341423ULL } },
+        { { 0xACC691808B49A71FULL, 0xAC36EB6C64227C39ULL, 0xDE5993EBAAF235DDULL, 0x94406D0B314DD0EDULL },
+          { 0x471C1944D0B249A9ULL, 0xD0E27261CA63CF94ULL, 0xCD207C90906FE897ULL, 0x61AAE77E864DF179ULL } },
+        { { 0xE5CDE33C60E50C32ULL, 0x77F10972E8C6873FULL, 0x337136DF5BEE8D38ULL, 0x3C2EBF43DE886C14ULL },
+          { 0x9E2F8917CA93C124ULL, 0xBE2D08C39AE8C998ULL, 0x6525B93D202E28E7ULL, 0xA703D9A6C5E8399CULL } },
+        { { 0x7083D9DEC3A2355AULL, 0x99651BF35C604990ULL, 0xF391E5B89EC55F12ULL, 0x987536D727940EB9ULL },
+          { 0xF0C75C4C1BD05276ULL, 0xB85F6C7C683ADCCDULL, 0x43E0B1C149E57B48ULL, 0x12F19AD674F11172ULL } },
+        { { 0xB0F0547C52F3EC22ULL, 0xD1F86DCF71A8F8A6ULL, 0xF19D38B17EF2DDDDULL, 0xD515AC409A4C4468ULL },
+          { 0xCA1462EB25A2863BULL, 0x4CD57DF0031B806EULL, 0x1EA5E4840052BD46ULL, 0x51C0481422449B2EULL } },
+        { { 0xA59A1E9A5971C857ULL, 0xDEC99E6DABE6093FULL, 0xE2453CC38B61CF3DULL, 0x070B9D4985E5B0BAULL },
+          { 0xFF9CB63DCAC8DFC1ULL, 0x33A83DA1EC5461AAULL, 0x86B810AE46373CFBULL, 0xED80461BFF4B6250ULL } }
+    },
+    {   /* 32: (2j+1)*2^128*G */
+        { { 0x57C84FC9D789BD85ULL, 0xFC35FF7DC297EAC3ULL, 0xFB982FD588C6766EULL, 0x447D739BEEDB5E67ULL },
+          { 0x0C7E33C972E25B32ULL, 0x3D349B95A7FAE500ULL, 0xE12E9D953A4AAFF7ULL, 0x2D4825AB834131EEULL } },
+        { { 0x73E1998EDEA6DB68ULL, 0xDDFAD856082632C2ULL, 0x58B14DF965DEF4F6ULL, 0xF8B6533E03CA017FULL },
+          { 0x69BD25B0AE760DA9ULL, 0x6BBD70DD9C5CA0EDULL, 0x2F046DDA50AA3EC6ULL, 0xC30F4EF5EC445486ULL } },
+        { { 0x66D5D4EBF924E753ULL, 0x5F0173072CF8727CULL, 0x548EF18729EDFB75ULL, 0xF35289D35582847CULL },
+          { 0xAA45B5C2EB13A20CULL, 0xC562FC57292D0F04ULL, 0x93DF08A1B50E1BD8ULL, 0x75C1781EC5EC13FBULL } },
+        { { 0x2395CB673018017EULL, 0xAF141FFFD6DF23D7ULL, 0x4834185FB6734E01ULL, 0xCFD06B74DA441716ULL },
+          { 0xA0AE7BE4CE0DFF50ULL, 0x003030786B779777ULL, 0x8103B39587DA7950ULL, 0xB647B7A9B72BA913ULL } },
+        { { 0x04C81905792DB860ULL, 0x81089288329A247BULL, 0x1512D6D08F15DBE9ULL, 0x0755E74C4AD5DCD1ULL },
+          { 0x7D6600DBA0D09849ULL, 0xB2937464CFC2777AULL, 0xD249B2D823815BC2ULL, 0xFE16AFA753AD9E4DULL } },
+        { { 0xA9EF6955EA26BA6BULL, 0xDD2CA2A496DA12C3ULL, 0x68A10C0D7EB0BBDEULL, 0x88FBA84CC372C969ULL },
+          { 0x80414781E44972F8ULL, 0x484A9E28E00CFDCEULL, 0xD266DA45B514788DULL, 0x512AEF649D39BE0FULL } },
+        { { 0x39C48A4294720CABULL, 0x1A1EA5D41739B17EULL, 0x8E50F6E7555C6F2CULL, 0xE1A0ACCBEC055BEBULL },
+          { 0xA6D453F574B185C9ULL, 0x084A2A71D080254EULL, 0x1836F83077EEBCBFULL, 0xE07968FB7E98C854ULL } },
+        { { 0x2A828FDFEC26C42AULL, 0x249BFB7E46B11BB6ULL, 0x50DB358931E7E6A0ULL, 0x0AE93B86E6A73C7EULL },
+          { 0x91063343B9F808CAULL, 0x278A39EEF5AADB64ULL, 0xA942E3EDC1E20B37ULL, 0x7028F6DD14787E13ULL } }
+    },
+    {   /* 33: (2j+1)*2^132*G */
+        { { 0x1EBD8BAC137DE736ULL, 0xA2F8D5618688CE24ULL, 0x8937542B8CDEC18EULL, 0x9022E314949CCF3EULL },
+          { 0xF4EF5C0844C42ECCULL, 0x7F49366C44EA7657ULL, 0x66D0BB045226CE08ULL, 0x2FAE5E4F2904A394ULL } },
+        { { 0x91706CB8D09B01F5ULL, 0xF73F35183273C051ULL, 0xFB0F2D3F1AF7857AULL, 0x6E5872E3076FE945ULL },
+          { 0xC30758D9ABCD5FDEULL, 0xC13179D4E09A85A7ULL, 0x80CC1D4AF3BEF0EBULL, 0x4213C02EC8D77171ULL } },
+        { { 0xB539B747EFE45B1FULL, 0x7BD155FB2E6168C2ULL, 0x4AFD1E344C17DF82ULL, 0x292220B1A5DA3F50ULL },
+          { 0x5FE40B8B534BB026ULL, 0xF7C344304CDD4104ULL, 0xE37C795FFAE98D7FULL, 0xE316A0532BF175AEULL } },
+        { { 0x3E850662A3ABD540ULL, 0x0E8040654B166DE4ULL, 0xC3224F8721093A34ULL, 0x3644E14807A44F0AULL },
+          { 0xE1C6FE1CD55DA631ULL, 0x00177CEDA66FA14DULL, 0x11C285309FA1E293ULL, 0xEC5A9150DBC27976ULL } },
+        { { 0x1A2FD21E89142CCBULL, 0x4C920A5AC687EDE3ULL, 0xE55B38F4993BB482ULL, 0xEDFE7DAE17FCD838ULL },
+          { 0xBB951D31AC593D75ULL, 0x1DA442B69D51142EULL, 0x61855D2B4F55BEB8ULL, 0xC88692122E0DAF21ULL } },
+        { { 0xF3DA71C64A41B208ULL, 0xE7F7475CDEE27000ULL, 0x98714026BCEA0DE8ULL, 0x5311968B4059A695ULL },
+          { 0x691E1F9E048E4B69ULL, 0x3B3C1DC02436877FULL, 0xA6C6581E33B3DA11ULL, 0xB78D732B3DC22978ULL } },
+        { { 0xB3D01B5C495DAAE7ULL, 0xAF46E6EC7C7033BCULL, 0xF7A22BF6F560E1D5ULL, 0xF65DD1F22FFBA594ULL },
+          { 0x8D4E5A99C2556738ULL, 0xEB06180F9EACD9B2ULL, 0x20E6FE637CFC4CD0ULL, 0x9D71B820CE1B66E8ULL } },
+        { { 0xABEFC15E3AFCF1EEULL, 0x0AFAA80472069A11ULL, 0xB41BF480AAA807C6ULL, 0xA6670E7EDCCAE248ULL },
+          { 0x378870ABE0C67FC8ULL, 0x1EF39891C93CF38AULL, 0xA395F72F4957AC13ULL, 0xA7FD14C93A51C2F3ULL } }
+    },
+    {   /* 34: (2j+1)*2^136*G */
+        { { 0x741145C144CD3397ULL, 0xDC34C10619515EB5ULL, 0x89386CF2B5156DEDULL, 0x73BAFF0419EDA723ULL },
+          { 0x41EF2A139ADCB8E4ULL, 0x779EF92CF8261349ULL, 0x6A00D1E8C18F825EULL, 0x1E97DE634977AC5FULL } },
+        { { 0x7EB0F952161FB913ULL, 0x3E10246156D31297ULL, 0x344388DE44BED04EULL, 0x45F8330C33E60A18ULL },
+          { 0x70D4817C0C15C3BCULL, 0xF06D0879F6FC3373ULL, 0xF80E8076D8BA7760ULL, 0xC212CF6DBFD6906EULL } },
+        { { 0x5AEF9691EE393654ULL, 0x965D4BE1F3EDD7C7ULL, 0x65F5A01C8BCD5991ULL, 0x5544DC49ACD7BDABULL },
+          { 0x23610BBF8F53206FULL, 0x241EFE9703D58E73ULL, 0xC04C05B5B8935192ULL, 0xED3E85895087FD4AULL } },
+        { { 0x13F3599428A15DFDULL, 0x741DBAC025FA9E55ULL, 0x4B3D2ED55AE2F695ULL, 0x2757B790619EE773ULL },
+          { 0xFC8E840CF042C341ULL, 0x1768978A3CA7156DULL, 0x5CC975213CD5500DULL, 0xDF46D2D554C2B12EULL } },
+        { { 0xEFEDF426BF840A5BULL, 0x148CADA5D3AD4984ULL, 0xD98421CCC1143CCDULL, 0xE872437DE50E2BC8ULL },
+          { 0xB84E58551377E86AULL, 0xAC3A346CF9396464ULL, 0x593BC91F66248BF5ULL, 0xF984BC8912729616ULL } },
+        { { 0x4956A9B8B36AFD6AULL, 0x9261FC50A1781E3DULL, 0x392EF6D5E6F3334AULL, 0xC56CDCABA4D775C0ULL },
+          { 0xE6086BEEF3F87C26ULL, 0x66F483B2568CC723ULL, 0xCD2EDEB17F594EF5ULL, 0xD16056E2F386B070ULL } },
+        { { 0x1DAD980D2CFD2CD0ULL, 0x23941334419C0C13ULL, 0x9CFD28583E48ABB1ULL, 0xD3D6E6738F3FF286ULL },
+          { 0x4C579C77794AE2DCULL, 0x001FA568C2F6F8F1ULL, 0x536DA8FF737DE59BULL, 0xFF448F5FCD159B68ULL } },
+        { { 0x09588855DAB7A64CULL, 0x56508D6A3A09AB7AULL, 0xB03132D72237D406ULL, 0x88F9778856E45C07ULL },
+          { 0xA05E98E11575F103ULL, 0x36C30092216D2673ULL, 0x34531AF257969E58ULL, 0x4A745CDD46B55C74ULL } }
+    },
+    {   /* 35: (2j+1)*2^140*G */
+        { { 0x0E2E5FB31FA4E33CULL, 0x2683BEC78B098CB3ULL, 0xC974446C2976FB98ULL, 0x9CF646B91A4C25BBULL },
+          { 0x19C45E060E0D4563ULL, 0x9E205827EBC16032ULL, 0x1E408E258B821F31ULL, 0x37B0624DC1F65A89ULL } },
+        { { 0xE98B618CC6BF1E67ULL, 0x4C566749FE5CAF63ULL, 0x9D7A653827764E0FULL, 0x83CB43DE151B6499ULL },
+          { 0xA27EE8B3099ACC97ULL, 0x2874422CBDD1169EULL, 0xEFB1806E624418F8ULL, 0xBCE28CA24B98F6F8ULL } },
+        { { 0x230AD748DC0F057EULL, 0x84E8628701D53DD8ULL, 0x03340FC15E250224ULL, 0x3FF3B3E560CEB08CULL },
+          { 0x2D41F7DAA817965EULL, 0xA010236EC4701762ULL, 0x6F7FD17057867843ULL, 0x7F17AD6F3BB6578FULL } },
+        { { 0x15114B40325E69F1ULL, 0x6367A8F2D422BCB5ULL, 0xDDA19DE173D6AF99ULL, 0x6E9EDB2DD8FFD83FULL },
+          { 0x720E17E3402B7E9BULL, 0x1C727454799F281BULL, 0xAB3556AB65F3BFF6ULL, 0xC0822216CEFF954EULL } },
+        { { 0xBF252F66A288F038ULL, 0xF0876894EB5FF820ULL, 0xEFABC19DE6EC2D32ULL, 0x5EE280E804C41C4BULL },
+          { 0x1C5AAB86B6F1EE6EULL, 0x11D7833A98E6C6F4ULL, 0x84C0586FECC9EEC0ULL, 0xBCD969F94677E392ULL } },
+        { { 0xA0BF3256C0C708C8ULL, 0x2C34304F2F70A86AULL, 0x6DFE365D91FE288CULL, 0xE1F0166E05C20573ULL },
+          { 0xE718D73B3896ED38ULL, 0xFB655F22EFB5A00AULL, 0x0444632BE8A33016ULL, 0xE647653E916C3B52ULL } },
+        { { 0x7E0F09CA476EDEFBULL, 0xDD58BD80100E7D5DULL, 0x7F121AB42979C7BAULL, 0x28089687ABF6345CULL },
+          { 0x2EF457229D1B0AE0ULL, 0x4DD31B07BE039212ULL, 0xA67E19EBD90541C4ULL, 0x5D071CF33D3B3191ULL } },
+        { { 0xD12D99BCF344897AULL, 0x7B9ED3075A4C269DULL, 0x70585E852425EDABULL, 0xEB15B0DE281904CBULL },
+          { 0xAD9DE83CE5BFE7EEULL, 0x814698B2F97D0B82ULL, 0x0898AAF8CD732F85ULL, 0x096CDD169C266071ULL } }
+    },
+    {   /* 36: (2j+1)*2^144*G */
+        { { 0x826FADC0523B716DULL, 0x0D238966F74E1A6BULL, 0xE8A5C7938D18DF9EULL, 0xF81F5BE38B8CA534ULL },
+          { 0x464002F512632401ULL, 0x660758503A878330ULL, 0x1D56D29D380E0328ULL, 0xDC7F49329C1F06DFULL } },
+        { { 0x84C5685039D19D8AULL, 0x3B41278951A55215ULL, 0x5AF6EC35C16D490AULL, 0xA6008450FB128638ULL },
+          { 0xFD95DBB3590D2C4FULL, 0xF0FE008FA726573DULL, 0xC8F6D45E7BE9CA84ULL, 0x7B4B79C067A37C72ULL } },
+        { { 0x26987B39496CAC9FULL, 0x59E38CEA5C44DE72ULL, 0xC64C09798FEB0E1CULL, 0xDE5382B1967DF354ULL },
+          { 0x7CE082FDAFA473D3ULL, 0xC2E3E29473D84115ULL, 0x62C3B00991CF9F2BULL, 0x9C47B678B69C9185ULL } },
+        { { 0x7CB2963786807A23ULL, 0x400020516A25FF3EULL, 0x5344B99D51194EC8ULL, 0xA7227B0807F2A908ULL },
+          { 0x1C471983D4115894ULL, 0xE7BF8157B728CDC9ULL, 0x45DA847920A075ABULL, 0xF5507525D45D39E8ULL } },
+        { { 0x5A797FC2044D14C0ULL, 0x005CAB5FA1A8F35EULL, 0x465ABE73A3661D39ULL, 0xCD2B2E8D42344596ULL },
+          { 0xA560ACF222496315ULL, 0xFDDB6F0CB9ACCECEULL, 0x4D505EEDDAC0F671ULL, 0xF13012DF9B0870A2ULL } },
+        { { 0x66F4EB12399A1566ULL, 0xF25C655AFF228F69ULL, 0x4CEFBC9B83DF9DD8ULL, 0x11B2E84C8F0DF7EBULL },
+          { 0x59A4B3C05C56BB73ULL, 0x824B55840CD80968ULL, 0xD042D698797405CCULL, 0x6103769DBCA23175ULL } },
+        { { 0x7D09EB28DBA6F34AULL, 0x31286A0FE245C6F8ULL, 0x759DA0A3EF991485ULL, 0xFB6D19295F2BA070ULL },
+          { 0x9B5F3C822BCF0452ULL, 0xECFCFA2DC9685B1FULL, 0x9E388FD4C4A791B9ULL, 0xF29B2D29D7BF46DDULL } },
+        { { 0x74CA2D2A0A435427ULL, 0xA690109827E4DB50ULL, 0x0AAF67650D906651ULL, 0xFF429FCC103C13C1ULL },
+          { 0x8E50450D39853824ULL, 0x205BEE534A3A0DA2ULL, 0x94D409C856186876ULL, 0x2ADDF9668A4ECDB0ULL } }
+    },
+    {   /* 37: (2j+1)*2^148*G */
+        { { 0x8ED9C7E787354B7AULL, 0x022ECA56C3915C97ULL, 0x2397F463E53CDE1DULL, 0x85685474D77E0848ULL },
+          { 0x8954402BD16E04C6ULL, 0x06A891DC1FD6FDBDULL, 0xEEBC913B2A6F7287ULL, 0x20B50EB50BF587B6ULL } },
+        { { 0xAF6CC7FA7B26165DULL, 0xA713A215F677137EULL, 0x49E9D2092FCC92DEULL, 0x617344C752B23E65ULL },
+          { 0xC49BFDCB86B2A286ULL, 0x9899AC16E37171A4ULL, 0x49B7D10BD18220B2ULL, 0xE9901617A437835AULL } },
+        { { 0x021BF76650442770ULL, 0x9018F7A6E101BAD1ULL, 0xDA04C1DA9E40FC2EULL, 0xF8AC03EE55FB6A22ULL },
+          { 0x3A2864F11B00C82DULL, 0xA97602BF95041D02ULL, 0xA436C751B34E6D17ULL, 0x5A358E65599D1E8EULL } },
+        { { 0xFBE06D86F65460DEULL, 0x0C73F8D0AABF77B8ULL, 0x6C6CBCBE30CC8EA6ULL, 0x8A731FB525BC95C6ULL },
+          { 0xE9859A1DFF8DC207ULL, 0x35867E3C52508EE3ULL, 0x8F52954BFFB04DC4ULL, 0x585855C5E2AB6319ULL } },
+        { { 0x642ABADFB51634A5ULL, 0x3CF90A7835ED524EULL, 0xBF0A6BA02CD7967FULL, 0xA20B606132A8F224ULL },
+          { 0x26C13795F226AFADULL, 0xC674757E3CD45EDFULL, 0xAD3D5FE8373B315BULL, 0x9C43CE9F697DB99DULL } },
+        { { 0x70432244B3BA54A8ULL, 0xB58B2635603AA970ULL, 0x91438EC34FC5CC0AULL, 0x016F1F93F1256709ULL },
+          { 0xED7C61FA664F2889ULL, 0xD93AF27546A3B4E6ULL, 0x6F29B11BE49CE658ULL, 0x08BCD34115895157ULL } },
+        { { 0xDEEE493CE7C16D94ULL, 0xE2581D0AA02845FDULL, 0x8C08FD67CCCEC31FULL, 0xE61586670BD03478ULL },
+          { 0xFB4ED19AB14810ABULL, 0x4E65CD1E47A443BBULL, 0x8C5B2B93F4B6F0EEULL, 0x65CA03AE9E7124BEULL } },
+        { { 0xCD6DCA6653CE728DULL, 0xF4CD907E2871CD0BULL, 0x555A08A216C85347ULL, 0xDCD37F0B38D56A26ULL },
+          { 0x8D7D136997CACBCBULL, 0xCAACD346D29DABEBULL, 0x72C37B62B3C6D6F3ULL, 0x6574DBD77CDA4C18ULL } }
+    },
+    {   /* 38: (2j+1)*2^152*G */
+        { { 0xDDC6DC1B12378C16ULL, 0x9E3607554615622AULL, 0xB319E52D6BF9597DULL, 0x1136B759C12B3B11ULL },
+          { 0x79F59BD0B3488127ULL, 0x9614AA28E751CCE3ULL, 0x09F0ABC60FE9ECB2ULL, 0x7DEC0FCF45168FDDULL } },
+        { { 0x970E6D827B299740ULL, 0xF40F467D713DB134ULL, 0xCC4AD13793FAAD48ULL, 0x53893EB71CDD4336ULL },
+          { 0x51EA6F1B3FFF7509ULL, 0xD8A132EF21FDE8CDULL, 0x3841CE28EA75DC8DULL, 0x27728A7E9485FBD8ULL } },
+        { { 0x30B3C956738000FCULL, 0x4E1E27707BF03BC1ULL, 0x57E376BAF1FAE560ULL, 0xDD64E9DD754CDA27ULL },
+          { 0xBFAA1C50DDF4AC12ULL, 0xBE45D022B91E48F8ULL, 0x6DF89E3E19CA79FFULL, 0x432193EB0C2932C9ULL } },
+        { { 0xEF82151733878C4AULL, 0xD883D03C8551C055ULL, 0xF2C69C60E4A91B21ULL, 0xFF9845A87EFFD516ULL },
+          { 0x6BA6847D7488DF68ULL, 0xF1F33746B65CFEBCULL, 0x8FD8A48EDFF5E8DDULL, 0x835B9AF4A4E2428FULL } },
+        { { 0x8CA9B88140F51524ULL, 0x5FAEB6A15BAF86FCULL, 0xE8767A30845293DEULL, 0x954E13E8BB91609CULL },
+          { 0xE9FDB3D945E30A69ULL, 0xA9EEA431141E7CBDULL, 0xD93C6243479ECBCFULL, 0xECC8363FF92A4041ULL } },
+        { { 0x1F798D53C4F77287ULL, 0x412953C36930D9E3ULL, 0xDFCD50C5C1D80497ULL, 0xB2217EF6FA41FB93ULL },
+          { 0x97A04A7724E7B5DAULL, 0xD709DC739C5E93CBULL, 0xB5DFBCF88D38C843ULL, 0xFB5153E0CE7CF3A2ULL } },
+        { { 0x8AF5396C85C723E9ULL, 0x1F973BAA9AA78171ULL, 0x122C6EAE915D5C35ULL, 0x3C3950B17B79BDADULL },
+          { 0x5E38775F76834763ULL, 0xB01DACB57C4906AEULL, 0xB494BB7EA186A8B0ULL, 0xB99B7362209110DBULL } },
+        { { 0x3717D6E23C18ABEBULL, 0xD59DCD190725D62AULL, 0xD1DED2F844BAA944ULL, 0x803C7A2CCF961CDAULL },
+          { 0x6A439BF0E29BFA78ULL, 0xED7C443C2A6721CDULL, 0x6B1ACF169C4B4409ULL, 0x83FB5040A796E928ULL } }
+    },
+    {   /* 39: (2j+1)*2^156*G */
+        { { 0x9C762EF1943E832AULL, 0x07E50AB01786DF70ULL, 0x90F573A82589F18EULL, 0x0D2BF28BA7C2A51AULL },
+          { 0x48263AF15B20D37CULL, 0x27EC9DB960551446ULL, 0x7087A10A94B4E7EDULL, 0x0CAC3F4313BD00ACULL } },
+        { { 0x61EAC4BC112C9666ULL, 0x1CF8C6C365FFCDF3ULL, 0xFD9BCC35B7D9531BULL, 0x34E5E85EB967F82CULL },
+          { 0xB5A1853C992A3666ULL, 0x0F47ED63C1E3A526ULL, 0x82846575CCBC4633ULL, 0xC0CE68313221A36BULL } },
+        { { 0xC1652BE351209502ULL, 0x5941720025D92665ULL, 0xA6C493EF0919E154ULL, 0x727362CC59F4D863ULL },
+          { 0xC677D1D3D7042B0DULL, 0xA18D37F9BB2760BBULL, 0x9F100B8C2CE91D20ULL, 0x17B0F4229BABAB58ULL } },
+        { { 0x455E7928A447F959ULL, 0xF947DABA8271D368ULL, 0x973A14C4BB49EEE9ULL, 0xA0C3F260054A6CECULL },
+          { 0xB039D248968B671FULL, 0xB1B5540258D272C9ULL, 0x382F8C10CB628208ULL, 0x508C73090E4B2C4FULL } },
+        { { 0x021F9F025B37E1D3ULL, 0x10761BE13CE4DE23ULL, 0x40CB433BE415FD04ULL, 0x7E81B231F795CA7AULL },
+          { 0x3F5FCA264155681AULL, 0x4EC84BF2B1C2E0E0ULL, 0x125E896CEE6C7C4EULL, 0xF3855A1B0E9BED13ULL } },
+        { { 0xC497715F56C051A0ULL, 0xDCDF29246F5B3E6DULL, 0x4A36D8E6DB0F2ABDULL, 0x8035E21C7D8026D8ULL },
+          { 0x601EBB2FB2D0DD12ULL, 0xB3E7DC63098B6235ULL, 0x375DBE6837BDD318ULL, 0x0B8810A44B7A2BEFULL } },
+        { { 0xCE00C309FF12C69EULL, 0xAFE5AEF589651963ULL, 0x06BAF0010204FCECULL, 0x196908DFD618A533ULL },
+          { 0x8D3319041D114831ULL, 0xB6B2E3371FFB886BULL, 0x0BEE1DEADD21054EULL, 0x3F65BF6B2F916E04ULL } },
+        { { 0xE498E01FCB89C5EDULL, 0x77B530CF797A78C7ULL, 0x46E6E1D210AD0F35ULL, 0xDB77FCEB8961A2AFULL },
+          { 0x59FF1C7EED25B46EULL, 0x1F16C7AB68899AFAULL, 0xECF339BE4C99AD41ULL, 0x7FD1DC3871CEE5CEULL } }
+    },
+    {   /* 40: (2j+1)*2^160*G */
+        { { 0xAEE9C75DF7F82F2AULL, 0x9E4C35874AFDF43AULL, 0xF5622DF437371326ULL, 0x8A535F566EC73617ULL },
+          { 0xC5F9A0AC223094B7ULL, 0xCDE533864C8C7669ULL, 0x37E02819085A92BFULL, 0x0455C08468B08BD7ULL } },
+        { { 0xFB14F217AB348FA0ULL, 0xE0FE2459051541DDULL, 0xC2A223236C24B4BCULL, 0x86EAC93DDDEB882DULL },
+          { 0x4EE380954DA51CEEULL, 0x6C26D96351CFEE8AULL, 0x5A436F9E8D6F4671ULL, 0x948F3853CBBC4D8DULL } },
+        { { 0x7AF41FFC99222C03ULL, 0x948CE77E87E5E103ULL, 0x3F5E7D784859F407ULL, 0x8BF09EBAF9FB3AAEULL },
+          { 0xA145F742EA72BB54ULL, 0x9C9EC0E1DE20E1D4ULL, 0x3B48B1DBE7E5BA30ULL, 0x509CBAAFE2E27A73ULL } },
+        { { 0xB453A2C1D1AE9300ULL, 0x5E1C470475C48280ULL, 0x19130BADA2F3735BULL, 0xE85E2DCBB7E70FC6ULL },
+          { 0x72A0DFDD1546E25EULL, 0xDEB7E185DF8C31BBULL, 0xC7BA7B5B823C2707ULL, 0x451AAFA6D51CE0BFULL } },
+        { { 0x2525D55605260CB8ULL, 0x836F4A80CEB2152FULL, 0xA3F027DA1BA7DBF6ULL, 0x3F5FB0F228C92F82ULL },
+          { 0x72FB4B441852C964ULL, 0xFA3E8751FC5EC332ULL, 0x0E38DE15366783F2ULL, 0xC55834DADA499987ULL } },
+        { { 0x4AA44442DA1CD60FULL, 0x9F9698A9CC3092EAULL, 0x57AED074B4DA002BULL, 0x33685622B18D9996ULL },
+          { 0x4BF737650FD57D67ULL, 0x5FEF5A4CBC50B8B2ULL, 0xBA858C00DEA7AF17ULL, 0xD42F509EF1247CD9ULL } },
+        { { 0xF053B6EBB7576342ULL, 0x5B2C88833999222AULL, 0xF7D0F9D8960979D9ULL, 0x4813EB5C08F00080ULL },
+          { 0x64C155EB97376316ULL, 0xCA2DC67D506A904FULL, 0xF66016848E33524AULL, 0x00043FD4233A4240ULL } },
+        { { 0x9F67171DFF69B2BEULL, 0xBA41F74EDC1111C0ULL, 0xF1322DBBAE386E56ULL, 0x80C3F1F9A5AE997AULL },
+          { 0x8904B97C4102D2F5ULL, 0xF14B74B35CB7A8BFULL, 0x2980E2765B1D5A9BULL, 0x0A932140A009DE85ULL } }
+    },
+    {   /* 41: (2j+1)*2^164*G */
+        { { 0x9C837F4FE476C81DULL, 0xB7A3030E99E53D5EULL, 0x9AF7CD273DA8A366ULL, 0xAD6090DFDCB41A01ULL },
+          { 0x818ABC84EE6705DDULL, 0x393FDC364F3048DFULL, 0xACCD75C2CC5BD8A8ULL, 0x77B5D1DD48F4C91EULL } },
+        { { 0x0A24737CE2725490ULL, 0x4AC3240623CB5990ULL, 0xA2ADAA533B09863CULL, 0xD90B45BB71AD697CULL },
+          { 0xB0F84F84AFEB1299ULL, 0x0CDC07BFF3C466CCULL, 0x09D8B5687378CBD8ULL, 0x3326928EC1BB350FULL } },
+        { { 0xA76B3A657E933668ULL, 0xFB02D84CF86BABF0ULL, 0xAC05393AFA1F06BEULL, 0xAC25921731213FC7ULL },
+          { 0x16E77F6732776FB5ULL, 0x6F864189C69E1E7AULL, 0x850EC13EEBD8ED7CULL, 0x6C79A03870DBA8BAULL } },
+        { { 0x9A617C12128DE7E3ULL, 0x86842AC3ABEA996DULL, 0x87320FBDA7B431BFULL, 0x7BC3374AE979F3A8ULL },
+          { 0x67A0B32EAE6E5E29ULL, 0x55F2DB39B4C0CCF0ULL, 0xE00C77AE6E4BACBDULL, 0xB431F02460854E5DULL } },
+        { { 0x4ACB2323835E057DULL, 0x29CF10DAF6D89A5BULL, 0x68BC872FC3411193ULL, 0xBF9C149453AE02B2ULL },
+          { 0x6F564B282DA20FEAULL, 0x440B9E181C5C479BULL, 0xF385313F05C7A542ULL, 0x92ACB89F25F23BE0ULL } },
+        { { 0xD2ACD7C2021D6584ULL, 0xF2705D6443B3D9E5ULL, 0x96E97DA35ADF014EULL, 0x55BF0839B5784F8AULL },
+          { 0x0D564F428ED744EAULL, 0x089E14202AE5A5A8ULL, 0x27ACBF6BA8BC7DCFULL, 0x3D980733E4B61CCFULL } },
+        { { 0xDD69DF6E41068C5EULL, 0x2A45EE6E4BE573D0ULL, 0x9F2AE14E7815D487ULL, 0xFCF24E1653378D51ULL },
+          { 0x761F453F27C19D75ULL, 0xE9176A4B2814855BULL, 0x5C675E21B592E7AEULL, 0x186BB0E5336FFFE3ULL } },
+        { { 0x8B7D95F0620DA860ULL, 0x843451AA4849D100ULL, 0xA1FDB65343D91F2FULL, 0x7BC280D02F5167ECULL },
+          { 0xBE29104107AAC76DULL, 0xF2E19A2FDCC1632EULL, 0xE2626BFA705EE6E0ULL, 0xB33F6D77BBBD31E5ULL } }
+    },
+    {   /* 42: (2j+1)*2^168*G */
+        { { 0xA52F2C3693C4A205ULL, 0xDE1ADF89F510A848ULL, 0xE466557075B929FCULL, 0xB6E06C516305BBC4ULL },
+          { 0x537F4D865DB36D05ULL, 0x63F99419A82A9F87ULL, 0xC5E1F126E79ED73BULL, 0xBDB4277C21B323F5ULL } },
+        { { 0x92F821F6F9E27907ULL, 0x771AD4B388D9E4D6ULL, 0x6B395D5D6FDFBD68ULL, 0x0ED9E43F84241C4EULL },
+          { 0xF13F4F506E78C4FBULL, 0xE9151CFEB8BA1905ULL, 0xF5BC0FD8EB120E0CULL, 0xB5AF874AFF6B2347ULL } },
+        { { 0x36D0572535B38F54ULL, 0x2E2A860E5CAF07CEULL, 0xC55268DB48FEE1F9ULL, 0x57A7E410076D8F7DULL },
+          { 0x5FA781E6245F2809ULL, 0xDFD76E39A907EBA7ULL, 0x194C8A23BC82DD21ULL, 0xFD7F0F03C8ECAD24ULL } },
+        { { 0x46FEBBF9A7A79593ULL, 0x347A7249D25C4979ULL, 0xF52D9B258CCA5CF3ULL, 0x24799AE2F3EF5DBEULL },
+          { 0xD6388D75D0920D55ULL, 0x9994361F9BEB1398ULL, 0x32C3D1A9D363E300ULL, 0x9436B5262EC87B7BULL } },
+        { { 0x60216EB50BF5ABDCULL, 0x456CD3AFBD0B6506ULL, 0xED3111CB080D5D60ULL, 0xF15017C6884C7026ULL },
+          { 0xB75DE2B8ADEF85B7ULL, 0xCBDC675C27B85584ULL, 0xECD8341E3FC5E232ULL, 0xDEA7EF1C2C5F02A8ULL } },
+        { { 0x69F252B1FE78E9B1ULL, 0x8978E6DC4EC141E8ULL, 0x6E0F831F7512DFCCULL, 0xE196E20F89B4BEAAULL },
+          { 0x4417561FCA77EED7ULL, 0x908D0112BEED35F4ULL, 0x2A6408BE76B2ED9AULL, 0xA5D66D85F81A85A6ULL } },
+        { { 0x76EE33E57B1CB64BULL, 0xD609E525618AC3D5ULL, 0xF397FCD71539ED14ULL, 0x7779F5DE6C1B0302ULL },
+          { 0xD8E18D1CBABA3AABULL, 0xE2A829423CAA9533ULL, 0xADFAB134A7A2E3FAULL, 0x09A8423F474C3EBEULL } },
+        { { 0x3ED8587691D1B492ULL, 0xDFA0618C2019A6F5ULL, 0x1E5F6D9AAEB28CE8ULL, 0x8605B94BE423A2F1ULL },
+          { 0x571D77BF78AC6598ULL, 0xEE23526D481E925CULL, 0xF3EF6E0C2143D1A8ULL, 0xA8E561287DE75758ULL } }
+    },
+    {   /* 43: (2j+1)*2^172*G */
+        { { 0x3CD5F4E4A9AA52DFULL, 0x18C452B1B42A627FULL, 0x6DBC4189D991ECE6ULL, 0x45A511C97F608BF7ULL },
+          { 0x7B52BD12125EC16CULL, 0x5A919B27D22955CEULL, 0x3FE3337FCB625AD2ULL, 0x73BE0EC773EA9B6DULL } },
+        { { 0x656753EFAE75BC7FULL, 0x95C7170DB6F7FB1FULL, 0x8EF40F1217CD4C7BULL, 0x0B57AC4FE72B9343ULL },
+          { 0x04F172DD0972E9A9ULL, 0xB1F96C0E4049FC62ULL, 0xF28C34CFA57E94FAULL, 0xCEEDBF8277A9F3B5ULL } },
+        { { 0x137433CF833125FFULL, 0x354557B05A5A8142ULL, 0xCF4682D9CA1CAE99ULL, 0x1178B3FB6E4BD148ULL },
+          { 0xE80F9709D8486ABDULL, 0x0DC8ADCD08E54D1BULL, 0x382DE637EA310ED1ULL, 0xDFD697EA9BABD95BULL } },
+        { { 0x3B3695CCF662D955ULL, 0x8444D685B48CE44FULL, 0xF8A83B7E8D275693ULL, 0x8AC7A0826F94E907ULL },
+          { 0xBC6A2DBE646B3DAEULL, 0xE3F481C5BD6C138DULL, 0xC9D7E5234CB59AD9ULL, 0xC80F40920F33231CULL } },
+        { { 0x7CD879ADE88803E5ULL, 0xCC1AB7CE0D3465CBULL, 0x1AB7FA8700569E02ULL, 0xC0F48B2859DDF211ULL },
+          { 0xA6932202876619EEULL, 0x932E4E070B828EDBULL, 0x9C9A64727E60D7D3ULL, 0x3D4326B6F883CA36ULL } },
+        { { 0xA96D67099E1F515CULL, 0xE2B48A32216539AFULL, 0xA019C8E10FF7B8C0ULL, 0x2CE8700F0351766DULL },
+          { 0x95193649852EED6EULL, 0xA7A9DCD3E2C3D52CULL, 0xBACB2F42F7EF5D2CULL, 0x73879F4F3B5EC4A7ULL } },
+        { { 0x45AA3775E4DCF274ULL, 0x807200682CACEA24ULL, 0x145E1BB0FD7CCA1DULL, 0xFAC44261DCB7C109ULL },
+          { 0x63698600F12F0472ULL, 0x732027C6274594B1ULL, 0x7CC723D5D4EE97BDULL, 0x9713FDC61566A8A8ULL } },
+        { { 0x2B5E4B6ABDC39D21ULL, 0x68373EBD409ADC68ULL, 0x46591E43A1992813ULL, 0xF891E6165B403E00ULL },
+          { 0xD5908E17C5CA579FULL, 0x73A97EC4F5460254ULL, 0x18AEB8A8E2DBC43BULL, 0x129F53B12BBDFCEDULL } }
+    },
+    {   /* 44: (2j+1)*2^176*G */
+        { { 0x28CF1AB99076F57BULL, 0x030B86E3CECAC607ULL, 0xB927E3501CF2A53FULL, 0x20E118564880C79CULL },
+          { 0x8583BEDBADA7AFE6ULL, 0x9FE0DC9B40E1B71EULL, 0x31BDC3E3FB6DE997ULL, 0xFF67B352AC437EF7ULL } },
+        { { 0x849E3AED4B661DA4ULL, 0x940A51AC64A84A5CULL, 0x8F7C7FD903061A21ULL, 0xFFCA2A5BB86606CEULL },
+          { 0x8984835EAF9B8A5AULL, 0x478F87ADE5687F6FULL, 0xA53CC9A148F46C8CULL, 0xCE1CB0E32B71CDC8ULL } },
+        { { 0x3CAC1E139C8CFD22ULL, 0x4E2B0671B636BE58ULL, 0x636535150DAD354AULL, 0xFF209CEDFFC116ABULL },
+          { 0x2389B14E93BC5535ULL, 0x0D4F4B92C9684B94ULL, 0x207D41D24CCFF1C8ULL, 0xAD79F397469D0F7EULL } },
+        { { 0xE807E5858F4E983EULL, 0x6D9E6EC87017F77CULL, 0x58604080D33B4B15ULL, 0x33D5F02D0B079BA9ULL },
+          { 0x6D70DB8791EA37A9ULL, 0x7A71AA9259630C95ULL, 0x73C3D61655BBA1EBULL, 0x01EB5A76D39C4784ULL } },
+        { { 0xB695A79F61E52A73ULL, 0xD0E3116C9705A1BCULL, 0xA9E974D9ADBB5E65ULL, 0x8F1BD23DA6261690ULL },
+          { 0x57DA1451EBEA8F2EULL, 0x590502E64B1850A8ULL, 0xB8769E430743EADEULL, 0x4C7A8F6393ADA8B8ULL } },
+        { { 0x5842FEC2FD2BC078ULL, 0xC4A0760529F3EF5AULL, 0xEE6298B7DAD880AEULL, 0x963BC9FEF7B637F3ULL },
+          { 0x7DDB231F5AFB8657ULL, 0xC5EC0428F443A3C2ULL, 0x80A3E5092980A4F1ULL, 0x7ED3383FCD1E7622ULL } },
+        { { 0x6871E76EAFB608ADULL, 0x74805654D88FD93AULL, 0xE631ADDCB7C8BC49ULL, 0x89FE6DAD861DA844ULL },
+          { 0x601406E7864D4DADULL, 0xAEA9D513E0F0A87BULL, 0x87B57DFFB725DF39ULL, 0x2898278231F4E8FCULL } },
+        { { 0x0718981B19AE4A29ULL, 0xDF2FDA6EA2232A0BULL, 0x510D7AC4E1166984ULL, 0xC348047F3BD79759ULL },
+          { 0x34959AC4CEB09235ULL, 0x8422E99F0549AEBFULL, 0x13DA8DD20E0DAE9AULL, 0x584781F2056A1C56ULL } }
+    },
+    {   /* 45: (2j+1)*2^180*G */
+        { { 0xDD1452E899273A8FULL, 0x3FDD478E694FD54AULL, 0x0318EC7FDFD7DAC9ULL, 0x5C9CC4F8723A027BULL },
+          { 0xADDACA695CE80D6EULL, 0x4F003675A11ACAB5ULL, 0xA827589D3708AF96ULL, 0x84EFE07A1DFED259ULL } },
+        { { 0x8C8C98544883E382ULL, 0xD0604FCEF55536F3ULL, 0x5BE2403952007431ULL, 0x5AC8E192BBDFD85CULL },
+          { 0x51373D9BDDFEAADCULL, 0xDE76ECA13D4D9D2EULL, 0x39C8FFF2F0963976ULL, 0xFCB7E5004C7A8C80ULL } },
+        { { 0xBCA43077EF01A3E8ULL, 0xC6EB65432E48094EULL, 0x2D515D44E0D67362ULL, 0x99DC0698B7912118ULL },
+          { 0x528645FE40F61114ULL, 0xB7A67034D7F8F294ULL, 0x697AC71171D80044ULL, 0x67C69CDD23B982BCULL } },
+        { { 0x383F7B004CD535ABULL, 0x7724D883E8764DC3ULL, 0x44024357CFCFB9F3ULL, 0xABE2F3618E040616ULL },
+          { 0x90711B34517B9C1AULL, 0x7FDE7A18C3AC8DD9ULL, 0xDE0DBF2B202DF795ULL, 0x4F02D64CB755B293ULL } },
+        { { 0xDB4B66B36909970CULL, 0x4518DBA599E6E4E0ULL, 0x37C6FB1F77E6099EULL, 0x227CD0D78C39E721ULL },
+          { 0x285A4AE31F809727ULL, 0xA210EC3F7EB99EC4ULL, 0x87D6C8741CFF5DEFULL, 0x2225E771C819391DULL } },
+        { { 0xCD9ADFC989E65B59ULL, 0x7A41022F7D44FF77ULL, 0x827EE930A8CD053BULL, 0x363146820AEDC5B6ULL },
+          { 0xC80A164269B4C2CFULL, 0xC143C903B5C5B6E9ULL, 0x8E8278F920227FC1ULL, 0x1D87DB6217897292ULL } },
+        { { 0x017B158BCD4C2506ULL, 0x5B6C5DC7F19E9FAFULL, 0xE74A68CE189D1FECULL, 0xF65ED6B6686B18A3ULL },
+          { 0xCC52DC253913DFACULL, 0x4128EFC34CD6542BULL, 0x5255DC2FD376E7BDULL, 0xD6D0BC68328BAAE8ULL } },
+        { { 0x81E4F9753B47A80BULL, 0xFF97C5A664249757ULL, 0x29DD9C276FABDBA8ULL, 0x66A0DEFA11F61357ULL },
+          { 0x0F7195F8FF795E8BULL, 0xC230A428526EDD20ULL, 0xCAD8DF2561AEF474ULL, 0x3E24AA6DE37ACA41ULL } }
+    },
+    {   /* 46: (2j+1)*2^184*G */
+        { { 0xE7DD9AB328523EB3ULL, 0x351A3A75556C6C4AULL, 0x46AC18444F3DCDE3ULL, 0xBAFFD4EBF8A8B5ABULL },
+          { 0x1978300CD5ACF387ULL, 0x24511CCFBF48B6EEULL, 0x003A8EB3795AC09CULL, 0x0FA93DC5DBC95E83ULL } },
+        { { 0xD0099B4EF4737641ULL, 0x1AFAC0C166C2E13AULL, 0x7778B51236563FB7ULL, 0x91B44522441C89EDULL },
+          { 0xF2512B29E101BBE0ULL, 0xC9D7DC666E077D03ULL, 0x2C13235AB02FB428ULL, 0x3F4463BD37FDA976ULL } },
+        { { 0xC6A2BAB826DD01DFULL, 0x743EFF76538FEFB9ULL, 0xA37EA6C7C8689165ULL, 0x296D135DE82DB07AULL },
+          { 0x4950D320AA3A0DC8ULL, 0xDFFAF618E5E66F60ULL, 0x2B87129776C777CAULL, 0x14054EDD92E145E4ULL } },
+        { { 0xC67E6F06D650F5DDULL, 0x54FFE1242191B2C8ULL, 0x8F13C2F1F19E4A96ULL, 0x4B0942F391367A31ULL },
+          { 0xC2EA5BCC7AEDDC6DULL, 0x023C6782E4E73A62ULL, 0xE055C1015613C25FULL, 0x7432AAA6366CABC0ULL } },
+        { { 0x7A375E8F04E4A96FULL, 0x188862B435655B14ULL, 0x833EDB8FC4D2E4AFULL, 0x036377A62FECC11AULL },
+          { 0x8BAFB7E051E08CDBULL, 0x84098C2143091326ULL, 0x8D930C5578546263ULL, 0xA1DE191D354FDF83ULL } },
+        { { 0x141FD3E1679B5A59ULL, 0xC621E89EB269E62AULL, 0xBCBBED5709D83251ULL, 0xA1041AF730F5E162ULL },
+          { 0xD8D2B4022C5514A3ULL, 0xFB30690E1EAC66D9ULL, 0x422650D873BC2AFBULL, 0xAD42176AA8F58B19ULL } },
+        { { 0xEAE8DB06CDDD597BULL, 0xD8893170CC85758DULL, 0x03371AD0F9E92007ULL, 0xDA2167AD0B1E5647ULL },
+          { 0x2681727E3DE7FA04ULL, 0xCDDE2A52144F9F46ULL, 0x1FF6700EA798EBF6ULL, 0xA21992B62546ED36ULL } },
+        { { 0x9934A222B3F7DBB0ULL, 0xF4EE23DC26BF29C0ULL, 0xBC863B872164F29DULL, 0x1C3FDBC237F6C678ULL },
+          { 0xD64CBDC972E16D32ULL, 0x1F0646380020F8ADULL, 0xF0AEA5394A4B18D4ULL, 0x39260F1037929813ULL } }
+    },
+    {   /* 47: (2j+1)*2^188*G */
+        { { 0x835208D8BA111101ULL, 0x479F0B1A76DB3C5FULL, 0xED22A34D257E4C96ULL, 0x06AD2A098FCED766ULL },
+          { 0xC1A7BA9D5FB37EF4ULL, 0xDE429D82B70E89AEULL, 0x59A4C01BB9EB62A0ULL, 0x2D5B8B1C58F85E35ULL } },
+        { { 0x76FC3847702BEF6FULL, 0xBBAE4F184531EE43ULL, 0x04F78BD66BD8D475ULL, 0xF1A2CA556C3BCD72ULL },
+          { 0x11B2D1FD8F6C1CA3ULL, 0xB0B47EA81FD52B40ULL, 0xDF455417DC020168ULL, 0xB39B59AF0488313EULL } },
+        { { 0x806028FCA0455367ULL, 0xE6C4F2C824D613E0ULL, 0xEE1901658EBF1851ULL, 0xE924AD49FE3B8030ULL },
+          { 0x5FD18CF828257E92ULL, 0x52DA31AA4FA6752BULL, 0x752085393D6FBB6FULL, 0xFCC97D979A143ED5ULL } },
+        { { 0xE91F093942F8F1E7ULL, 0x8DD4AA5D4DD1F9E2ULL, 0xA00B935105FB22F6ULL, 0xF49D9C7DC5F7026FULL },
+          { 0x92228AB1914D9972ULL, 0x01B0013C4E4D7A83ULL, 0x6AE5D3B3B994F679ULL, 0xF5585D4203E3ACAEULL } },
+        { { 0x7B3A9677FB219A79ULL, 0x5C4CD4417E9827A7ULL, 0xB0E3C355755189E6ULL, 0x28B04D03E46A9D48ULL },
+          { 0xF8BF7CD9102DBE24ULL, 0x86166CCF86004BE5ULL, 0x59CFE572183E206BULL, 0xF658DA9E5A14CF14ULL } },
+        { { 0xB2822D9C57774AF9ULL, 0x4C16BA6511460AD8ULL, 0xD6850392886AEFB5ULL, 0x3F4766BE7CC1FE93ULL },
+          { 0xF7CD7F64DD4DE990ULL, 0x1CA94CFDF9B7326FULL, 0x3AB178906E6E5F51ULL, 0xCC810DD6A7331CBAULL } },
+        { { 0x78419F1E48E57705ULL, 0x21CEB7FAC84D598EULL, 0x1F2ADAB41D6F3617ULL, 0xE3249E02C0F8EE79ULL },
+          { 0x094B19E838CAEC0CULL, 0x501945D716738422ULL, 0xDCB778C1F2486B5AULL, 0xA666658701369507ULL } },
+        { { 0xC78BCEAFB25B93ACULL, 0x17E202510587F8D2ULL, 0xBDF9E7693DFBB4E9ULL, 0xA689580BDFB7961CULL },
+          { 0xEA3D1C4D6F589AABULL, 0xFCF1F817D9C4FD3AULL, 0xAA7F2F015F059FF2ULL, 0x4657CA94B4F0783EULL } }
+    },
+    {   /* 48: (2j+1)*2^192*G */
+        { { 0x6CF20FFB313728BEULL, 0x96439591A3C6B94AULL, 0x2736FF8344315FC5ULL, 0xA6D39677A7849276ULL },
+          { 0xF2BAB833C357F5F4ULL, 0x824A920C2284059BULL, 0x66B8BABD2D27ECDFULL, 0x674F84749B0B8816ULL } },
+        { { 0xC054B569CF15D864ULL, 0x2406FDC6A1CC8D3CULL, 0xAFC8ECE7BE26CF35ULL, 0x07EF66D7C5DEDB0DULL },
+          { 0x54625427740907FEULL, 0x9F470E3B1CCE4A8BULL, 0x06D40C5221FD505EULL, 0x2DB3325DB89DE6A5ULL } },
+        { { 0xC695143C17C7C05EULL, 0xB283CB952CE5416AULL, 0x14F3A72F75F28C0BULL, 0x82DF4E5FC06DC460ULL },
+          { 0xB9613D02D8FFF26BULL, 0xCF15D946842DB300ULL, 0x275216211217CBD1ULL, 0xE4E188C98C96420AULL } },
+        { { 0x80AE1D41540368B0ULL, 0x1324C22F8FEE949DULL, 0x7D9E5B8D38E47A62ULL, 0x261EFC9BC12B0C6AULL },
+          { 0x13AD2559BDEB011FULL, 0x7E340BE1E39B5D30ULL, 0xFDC8852CD64FFF79ULL, 0x8A9D2ADBE386FCE9ULL } },
+        { { 0xF1033E9515EB8034ULL, 0xF30B335F56E8CA4AULL, 0x49AA7E59D9E7692DULL, 0x6D48DFD77A2C2791ULL },
+          { 0xE873087A5AB0CE30ULL, 0x080210EA2A3E8961ULL, 0x3D5E79649E054763ULL, 0x3CB47245165DD12FULL } },
+        { { 0xB5143DFC540535C8ULL, 0x65F0A5630C8DB13EULL, 0xA49123FB4FC54E6FULL, 0x93A5C01E7BB98923ULL },
+          { 0xC49574083D59B844ULL, 0x66A16204935BEDFFULL, 0xC16A84358E15A5C1ULL, 0x2D440E904980C2F4ULL } },
+        { { 0xA261A5669E2047BAULL, 0xE54704996BB0F652ULL, 0xB35DA0E017D67031ULL, 0x3FB0B929161272BBULL },
+          { 0x57FECD4EDDB24158ULL, 0x6C420AE7717009D3ULL, 0xCA72621C99666DC8ULL, 0x9D467AE68217DF94ULL } },
+        { { 0x00BDBDBAE2DF71C1ULL, 0x1C3186BEAFBB723AULL, 0xD0763BA9DE33E438ULL, 0xDAB09439E08E83D5ULL },
+          { 0xB873484124C3A1E3ULL, 0x6E96330CA4B44E3BULL, 0x385AE86F20D20B3DULL, 0x763CBC1E544E1CEFULL } }
+    },
+    {   /* 49: (2j+1)*2^196*G */
+        { { 0x6EEF62FF4514C6FDULL, 0xFD683B4D0DAB013EULL, 0x33D4DB5710FF5936ULL, 0xAC25DA80089CF4E0ULL },
+          { 0x60B5397705830541ULL, 0x810983E8243BF37AULL, 0x883DA9312A1B338CULL, 0xEBC69D985CB44C7BULL } },
+        { { 0x81941C7E32FD0E3DULL, 0xE631E4DC5427AD60ULL, 0xB4D748671E165547ULL, 0xEEA7E66C49BA3C8BULL },
+          { 0x10411F68D91D5868ULL, 0x5ACBADA23019E3CCULL, 0x28843F27BE9B7D98ULL, 0x83FED45B9F889261ULL } },
+        { { 0x119F14F26CCB63B3ULL, 0x7DDFFE6C44408E5DULL, 0xBAD194B35403C67BULL, 0x9A3DE2D3E93E21BDULL },
+          { 0x01C532977DF93FCFULL, 0x49C01D9FEF582260ULL, 0x809F2736EE813C4CULL, 0x2F809B90611112C8ULL } },
+        { { 0xE4ECA34DD63F1117ULL, 0x34896F70BA7F6D8BULL, 0x05100D30123FADAFULL, 0xA7C382F4B53B92DBULL },
+          { 0xC1220C5E1934CB9AULL, 0xAE4EB76ED3C4A68CULL, 0x0459F777705DCFB5ULL, 0x1B91E5116761BF88ULL } },
+        { { 0x50BC81C5A6774A96ULL, 0xE8231FD91838E3E8ULL, 0x87143BFC83A6F497ULL, 0x555AA998CD861213ULL },
+          { 0x9D40972D86DB0E34ULL, 0x9A0D5D4BC8E26FA6ULL, 0x99D441E71350BBB8ULL, 0xB0532868D207BC69ULL } },
+        { { 0x32F7EEF3AF7DAC7DULL, 0x16572B9211241212ULL, 0xB58CD78F8D77C369ULL, 0x01A42F5B348A7AD7ULL },
+          { 0x27894A318195E46EULL, 0x172AF29328CEA96BULL, 0x3497F954B8BF9216ULL, 0x957A9C3855207781ULL } },
+        { { 0xE02BA1D4202AFC36ULL, 0x134DEED5143071D3ULL, 0x3A5B09EF1B45D3A3ULL, 0x4B47F537EB05CE3DULL },
+          { 0x4E89F76A6F8133FFULL, 0x345ACBE9B25FBDA3ULL, 0x2DCB06FA0E8DF573ULL, 0xF2FC450399C85F0CULL } },
+        { { 0xAABF2E3C77D17F68ULL, 0x7915A1DFCB8BAD86ULL, 0xD56516F536AE418FULL, 0x6B3DEC9CC524E8CEULL },
+          { 0xCFAE7A20C9232402ULL, 0x47F2A96AA6DCCB68ULL, 0x050981B416CD5D47ULL, 0xB8653937FDEFD9EFULL } }
+    },
+    {   /* 50: (2j+1)*2^200*G */
+        { { 0x55D4E37A2FD20BAEULL, 0x26035672D5B4A811ULL, 0x027BBA12176D343AULL, 0x285250EDC3BCFCD9ULL },
+          { 0xF9DE455A54E0AB97ULL, 0x6E9B1A2CF1EFF323ULL, 0x3F7284AD1046C171ULL, 0x7866C086F4AD7EA8ULL } },
+        { { 0xCC8876ABA636A50BULL, 0x5D2EF616ABB75196ULL, 0x5836FA12FC78BAF6ULL, 0xF1E3C56545D5A75CULL },
+          { 0xDF77914EAB3128B6ULL, 0x6B7FA576D22D7A6EULL, 0x6C736A67F6A5F313ULL, 0x12B8847A6E1EFCE7ULL } },
+        { { 0x517F13214E583340ULL, 0xF45C1B6B5D34F3B2ULL, 0x6D87CDABFA9B228CULL, 0x584D729C81E134A7ULL },
+          { 0x72F6E5E974FB24B9ULL, 0x8F1770A66494C070ULL, 0xCD307C593030AFFAULL, 0x2FDD80A4560D80ABULL } },
+        { { 0x92C83EDE0235809BULL, 0x3C572DF0B5EB8173ULL, 0x1E2E028DC2383C45ULL, 0xBAAEAE00C837DF7DULL },
+          { 0xCD61D8A5C154FD62ULL, 0x835C3C42A1D2E7E5ULL, 0xB4A2307BCB49F299ULL, 0x325788833F324B80ULL } },
+        { { 0xF60042C40D612268ULL, 0x06CF59DF0A5ED016ULL, 0x65139EFA4394B8B9ULL, 0x06C7E46360C2131AULL },
+          { 0xBCB4B601260166A0ULL, 0x238D8A5A782E7098ULL, 0x747FC75CE2F453CAULL, 0xCB6AD55DF72DD8CDULL } },
+        { { 0xBD43A35B812FBDC8ULL, 0xB89E20CAA2C0E2A3ULL, 0x5BC2ECC7B711A36DULL, 0x064131DEABD6643EULL },
+          { 0x5D3FF309A9F99380ULL, 0x603AE268B1FB020AULL, 0xF2B380D934957598ULL, 0x882C7FAC32D67028ULL } },
+        { { 0x75EB00064BAC9F32ULL, 0x443821CC59689B06ULL, 0x8A16416FE19B6400ULL, 0x366BB7ACC275C237ULL },
+          { 0x42F0E5CFBC85D47DULL, 0x1FDCE50C07F0268AULL, 0x4F0783AB8D61CFC0ULL, 0x7D107B708785AF06ULL } },
+        { { 0x03CB525286DD27EBULL, 0xB98C55C37B3B5623ULL, 0x6B27D0E39BBE32ECULL, 0xB767DB257CC73C00ULL },
+          { 0x15521A47CF65DAC4ULL, 0x64B700B448600ED4ULL, 0x5CEACB816B99D85BULL, 0xDC1308C3261229CBULL } }
+    },
+    {   /* 51: (2j+1)*2^204*G */
+        { { 0x171F3A2A3E07E4F1ULL, 0x1FC5147DD0DC267CULL, 0x818DEBC07EF8890EULL, 0xC472C1062ED0366FULL },
+          { 0x571C683D86B0DAA9ULL, 0x85F3B7B1E22B5D8AULL, 0x6432AB5A84D667D8ULL, 0x41820E01945F70E9ULL } },
+        { { 0x4369534AA2F8ACB1ULL, 0xB39D6554613F053FULL, 0x85E1B7A4B8ECC31EULL, 0x86F88F399545E3D6ULL },
+          { 0x14B042D105098A19ULL, 0x4EEA62BEE9165271ULL, 0xB37C978FB591B121ULL, 0x2CCFDD69A68238D6ULL } },
+        { { 0xD88377B6FCADAB66ULL, 0xE1C6A33C3DD35602ULL, 0x7DF7669660D9F9A0ULL, 0xA2A3BE1FC9948E74ULL },
+          { 0xEF4A12484C1AEB12ULL, 0xFB2DE8A53480AD25ULL, 0x06507ED74D235EE1ULL, 0xA93BD8E6B524BE67ULL } },
+        { { 0xB89D2213207C25BFULL, 0x82FBC777BE2D8097ULL, 0x367E124677C080BEULL, 0x354E7CED56E78DB9ULL },
+          { 0x5123A3995A864211ULL, 0x5FD756CB05A0AA21ULL, 0xE6EBD824A5CFE558ULL, 0x629D62E9BB994070ULL } },
+        { { 0x4A7D82E075E1DAD8ULL, 0x8B80A78586C4BD2EULL, 0x79B5CF720C099F49ULL, 0xC751C9AAF5DE805BULL },
+          { 0xD136B3612E4AFC8BULL, 0xE6F8970A3A0A8C02ULL, 0xBEB4C1FD6DC9A4FFULL, 0xCB986437FC799DE2ULL } },
+        { { 0xD3121B21099D9BA2ULL, 0x0CF657D697AAA757ULL, 0x78AB5286B50F9CA8ULL, 0xAEE9CC41B9D1D021ULL },
+          { 0x78D60483BED2AD58ULL, 0x312E68E26A17490EULL, 0x7BE97BFB00C6B1F5ULL, 0xB72CF302DB52A36FULL } },
+        { { 0x63FF0824894D208DULL, 0xFB0DA8FF0FF391A4ULL, 0x6BFF60AF2B1FF0CEULL, 0x0D0D3F46A7912EC5ULL },
+          { 0xD62F53F79D45D1B1ULL, 0xB213C0D1A71DDABFULL, 0xB0474DA65F909FF0ULL, 0xDC371B80AE1F7169ULL } },
+        { { 0xC6E822C819CFD890ULL, 0xCB36C3737C071145ULL, 0xF47CD8387E5441E1ULL, 0x778D146B44137535ULL },
+          { 0xC9A87FA7D6F057F2ULL, 0x96CA45488ED20ACAULL, 0x2A52718D9786CD37ULL, 0x3C85BA133B011AF7ULL } }
+    },
+    {   /* 52: (2j+1)*2^208*G */
+        { { 0x320F09C3839BB85FULL, 0x0101FB06A050E62CULL, 0x557582C99AD53458ULL, 0x55D5398D1666432BULL },
+          { 0xF7F631184FED936FULL, 0xD90D6A7F1833D9E1ULL, 0x059C6A9E8EBAA72AULL, 0x576E229049FF8E2DULL } },
+        { { 0xC07E2B9212EA285AULL, 0x9F01C1E6F7B910D1ULL, 0x7858058DDDC0A7A3ULL, 0x1BB46408814F888BULL },
+          { 0xDC0C8A79907DC702ULL, 0x1E52A34B992FA94EULL, 0xA40FD9B892B4A4FCULL, 0x8A3016BFAFAE1125ULL } },
+        { { 0x45012900D539785AULL, 0x8C88D076B8297F01ULL, 0xE0973E2678627A54ULL, 0x04BC4E70E02FA14EULL },
+          { 0x53990475CA62E3BBULL, 0x877017727A3275C3ULL, 0xA5F5A1CF3F3DFB4FULL, 0x5729F224B8CB4CC3ULL } },
+        { { 0x112D4BB1E114CFB5ULL, 0xD136189AA3D5A6A3ULL, 0x587739E1B7DF0876ULL, 0xD3E492FDC1F88173ULL },
+          { 0xBCEB9AA5697F7045ULL, 0x9C88F06E46754EEFULL, 0x1FEE2676BF15FEA3ULL, 0x3604A70A73F8C48BULL } },
+        { { 0x1A2674BBAC55DDFFULL, 0x1DAD1B3F64D4B787ULL, 0x8A4E52310FCDC179ULL, 0xBEBFC25586284253ULL },
+          { 0x6D4DB0CA3EA2F303ULL, 0x3CCA822D650BAA70ULL, 0x8A3A11C4B776576CULL, 0x850DE265C09604CEULL } },
+        { { 0x91AF41E4C99EAD51ULL, 0x5DA3543A21D9224EULL, 0x2FB2931D16078471ULL, 0x36E984DC73D20D60ULL },
+          { 0xC6FB9D426E0E5E3EULL, 0x3BABBEC1704280AFULL, 0x4BFBDFC9ACE32B20ULL, 0x1437714721BF485FULL } },
+        { { 0x7A8B77BB23093DF0ULL, 0x785E24816776464DULL, 0xF315147954D793AFULL, 0x91B6750043F604AEULL },
+          { 0x5CDE8C37D2CC9F14ULL, 0x933685F8F9CAF67FULL, 0x477C7ADA96E21C5DULL, 0x07FEDB1E5824A00DULL } },
+        { { 0xA2367B86FB7B8DC4ULL, 0x5B3493028A9B3848ULL, 0x7C497E1A03602FACULL, 0xC5D9C3C7A1C4883EULL },
+          { 0xED64978D1B2DF0EAULL, 0xD0D8F72FD1FD4936ULL, 0x5808C38605C50AF3ULL, 0x3E59B9E25CFDB79EULL } }
+    },
+    {   /* 53: (2j+1)*2^212*G */
+        { { 0xC62DBC9C32513926ULL, 0xCC268940EFEC85ECULL, 0x94FEBAB24BFC3383ULL, 0x884286463CA08726ULL },
+          { 0x0EE4282AAFB8A54DULL, 0xCE0EB122EBDBC15AULL, 0x69660DB365D81207ULL, 0xF778429C01C2DD5AULL } },
+        { { 0xED2BAC196520F1F1ULL, 0xD7F1B49E647F7DA4ULL, 0xD5A5FD168CCF6F4AULL, 0x3BAD9D36F76F0819ULL },
+          { 0x6A1970725698DF4DULL, 0x499981A24EB67258ULL, 0xBCD9FA7D9DEC0E80ULL, 0x49F99DE33E24E659ULL } },
+        { { 0x0B1E44A8B185AE66ULL, 0xA6EC16DBEFA783DFULL, 0x67A7DF53D124118BULL, 0xA6B3A4B1ADB0C46DULL },
+          { 0x7BEB553F8BFBF21BULL, 0xBCBF0A5DF5B248DDULL, 0x1361A91CD969E8D8ULL, 0x0CB6E8D763889623ULL } },
+        { { 0xA9684CE4EC630E3AULL, 0xF61060C17FF3F1C2ULL, 0xE227E3A7D87F10C1ULL, 0x1F848F5A6C9114A4ULL },
+          { 0xAEED9FF686CA610AULL, 0x4BA3926BFE359724ULL, 0x8629C83D1A9DA426ULL, 0xA028552CCD06F963ULL } },
+        { { 0x4DFEF3CDC41BCD10ULL, 0x11B9557645B44E15ULL, 0x8B1A2677C6CA2EB2ULL, 0xCFD1E54BE949C358ULL },
+          { 0xAC015EB9AA62E732ULL, 0xACD9915D08553965ULL, 0x9C5751BD5B052FAFULL, 0xF4E31F5F600958BBULL } },
+        { { 0x4FA61D92228DA5FBULL, 0x90E4BF5E2A870E72ULL, 0x12C795E3E771291BULL, 0x4B3E730C046C9E55ULL },
+          { 0xBFF0A638BC169E48ULL, 0x65A3A11C9C23472BULL, 0xE80CBA07B8E0B48CULL, 0x8C40964DA23660E9ULL } },
+        { { 0xB8E91A589F894780ULL, 0x37E9CCA3589AEC5DULL, 0x1D54B8A54B42D8F7ULL, 0xAFE915DF74438FE7ULL },
+          { 0x2F969553D511D444ULL, 0x909E8BE73AC0AF45ULL, 0xA94B4342333F2E36ULL, 0x3CAEC3408D204686ULL } },
+        { { 0xF5A31FCBD182FA6EULL, 0xC0A632DD6981C8AFULL, 0x5866A3A36D35C9E7ULL, 0x0C05482810FFAC85ULL },
+          { 0x6EBCFEAB661CD145ULL, 0xF5E664584B76D01FULL, 0xD1AA8B89465D602BULL, 0x2F9CD2CAD0F1F533ULL } }
+    },
+    {   /* 54: (2j+1)*2^216*G */
+        { { 0x3E0B5D5AD4441FBBULL, 0x9EAA8520A5ED115EULL, 0x7FB60C55EDB92555ULL, 0xB4958C4E21DE21D4ULL },
+          { 0x4C7E3C9F4ADD7118ULL, 0x2DB9F6132D463841ULL, 0xE5C041FBC38CB7E1ULL, 0xFCD6E7BF996640EFULL } },
+        { { 0x5AED684C371F07F1ULL, 0x878CEDB730D70C4AULL, 0x232EA0B64606684BULL, 0xB3A43F5E7B20444DULL },
+          { 0x53CD22F4E01DFDA5ULL, 0xEC7877A0CDCB0ECCULL, 0x4183227369975EE7ULL, 0x34C64F5B248FD6B8ULL } },
+        { { 0xFF7C97A46B559D49ULL, 0x48E1B4690DDC9B44ULL, 0xC2662FFD84C008B1ULL, 0x452E9869A46BE14AULL },
+          { 0x747C6046DA0D6BA7ULL, 0x5982856C3B1EE425ULL, 0xF5C0057B6761EE52ULL, 0x8C5E8A8F195F80D0ULL } },
+        { { 0x537A67EB53CE94DAULL, 0x8BB24F4256829E60ULL, 0x51CDE0DC3AC474EEULL, 0x19A7F5D48C6D62BBULL },
+          { 0x730447163025E7BBULL, 0xFB625306AE25EB03ULL, 0x2F6A51D44200A2E8ULL, 0xA2504BA7A93075C3ULL } },
+        { { 0xB9696CC6D47DC697ULL, 0x17EE18AFB5E15B9BULL, 0x011EB0B2B5FC6FA4ULL, 0xBDAF5B020A4F34DCULL },
+          { 0xB911CBE786A479E2ULL, 0x55122E7885B7A477ULL, 0x8CF575E47B57AA08ULL, 0x3CEC0C6CBDFA836CULL } },
+        { { 0x2A00B91B6CE05E10ULL, 0x8AEF7C9F43E10620ULL, 0xAB84B7FE84CE70DBULL, 0x265DBAE95F39D15DULL },
+          { 0xFF7F018B171324F4ULL, 0x0663F3933D64C67FULL, 0xF3B3CE8B56CB5DCBULL, 0x58DF63D09A3037ADULL } },
+        { { 0xED15BC55B3FE5938ULL, 0x9EC8303DB636D7CDULL, 0x89F749D53A566866ULL, 0xC43E083F17E66396ULL },
+          { 0x7679756ED83732F3ULL, 0xAB62307162440747ULL, 0x35090303ABC4402EULL, 0x54C6029239FBCC58ULL } },
+        { { 0xC31C70F79DD52975ULL, 0x2BCF0FD306B44180ULL, 0x65AC50DA77B266BAULL, 0x7868F1700A3F8486ULL },
+          { 0x3016ED503C626FACULL, 0x68F6F9ECA6969044ULL, 0x113FA1C6DB11276CULL, 0xE89097CF31217EE1ULL } }
+    },
+    {   /* 55: (2j+1)*2^220*G */
+        { { 0xAC24E6436E12E1DFULL, 0xD8A7FD0B7D761D04ULL, 0x4134BF13B346027CULL, 0xD0E0919688E932B6ULL },
+          { 0x6A6544DB9FD28FBEULL, 0x544CC4BD9846B8DFULL, 0xB4EB60B691DBF867ULL, 0x069C9A59FE7D1452ULL } },
+        { { 0xBB0D8510084AA098ULL, 0x09C10140A96E3E02ULL, 0x398A7DACBFC1FA85ULL, 0xB517A454A13308EBULL },
+          { 0x6004B59F4540EFBFULL, 0xA4D48B54692447FDULL, 0x60EA3E2FB0F26FA3ULL, 0x0A3D877D0C1F879AULL } },
+        { { 0x6D95ACAA4744BFA1ULL, 0xCC26D27CE093643DULL, 0x7BC22712D8F3E387ULL, 0xF8EC14384B5166F6ULL },
+          { 0xC6924E6332B65F6DULL, 0x0A637AC5C3900060ULL, 0x32368FB269D60F61ULL, 0x761134B2113FB9A6ULL } },
+        { { 0xF62C3BE93227A4BBULL, 0x4BE6B1F00F8D99F2ULL, 0x94E74EAD21D4F2E6ULL, 0x320CFF78DB7BFAE7ULL },
+          { 0x581CC906B0F3D2D4ULL, 0x6047237409E2F970ULL, 0xAB7796A254FF6299ULL, 0xAF9FE8D4072A8692ULL } },
+        { { 0x3B5B5A5E5C2CA683ULL, 0x206CF35E0A95A737ULL, 0x17EDDDCCB543426AULL, 0x0C08DE7C6A7AED85ULL },
+          { 0x92406DB57DB5F259ULL, 0xC3C8D7B7E0EA68C6ULL, 0xB7C8299CDFCE0E79ULL, 0xDDB76D855EA16E19ULL } },
+        { { 0x1C67ACF8252AE5CDULL, 0x95B652FAF4FDD786ULL, 0x18E6F7A44CE43909ULL, 0xD1F8C76AD0C47C3DULL },
+          { 0x7EB97BC3FE6D2DDAULL, 0x39BAE8156989F4FCULL, 0xAC7997B01F612032ULL, 0x74D45DC66120E802ULL } },
+        { { 0xB790066AABDC603FULL, 0xC96D65CD67DFFE5AULL, 0x93E33EC6267620D8ULL, 0xA6CB83693F3890C0ULL },
+          { 0xCACE03E0C96BEFCCULL, 0xFB1EC16A4C661735ULL, 0x8F2D9BDA4C510B72ULL, 0xD823C8E461F3CAFCULL } },
+        { { 0x29E3A612E2C374B0ULL, 0xBF5B3598B570DB4AULL, 0x36BEC97152424EF0ULL, 0x8A6C9C91EA6C3321ULL },
+          { 0x3BF7CF8DB78C08BDULL, 0x461534F4340F4D58ULL, 0x79A7885DC90132A0ULL, 0xE4BC7F4F65CDFFAFULL } }
+    },
+    {   /* 56: (2j+1)*2^224*G */
+        { { 0x6A703F10E895DF07ULL, 0xFD75F3FA01876BD8ULL, 0xEB5B06E70CE08FFEULL, 0x68F6B8542783DFEEULL },
+          { 0x90C76F8A78712655ULL, 0xCF5293D2F310BF7FULL, 0xFBC8044DFDA45028ULL, 0xCBE1FEBA92E40CE6ULL } },
+        { { 0xE418FA233AA89692ULL, 0x713B08D6F94C2308ULL, 0xE996E6412418A776ULL, 0x3BDFCA7181668F4DULL },
+          { 0x93DBDB431A510308ULL, 0xC7DC0C6345E2EF13ULL, 0x49426151AEDA5333ULL, 0x0A721F68565167B8ULL } },
+        { { 0x079B2342C37EA1D7ULL, 0xB2393658F89AAE4DULL, 0x35328552518D9E4FULL, 0xACA8AC95B7521056ULL },
+          { 0xDDEFB1049BA973A2ULL, 0xE1EDBFDC413935E9ULL, 0x94304C4B92872189ULL, 0x7F12C567DD75CC20ULL } },
+        { { 0x5DB2781CD3245B7FULL, 0xA37D669690597FBFULL, 0x206C21AF98D85311ULL, 0xFA904704DB667C0EULL },
+          { 0xEF833DF14DDF6BEFULL, 0xCB9EECD2624F1D47ULL, 0x2D6FA3ED40F1C189ULL, 0x1A1C8C3674A836A4ULL } },
+        { { 0xB61F78FD77F0953AULL, 0x18491483FF15439AULL, 0xD672B8E1D2FA92A8ULL, 0x1D431AAB91F57D8CULL },
+          { 0x17C59D769D68F260ULL, 0xF48E29A908707E7CULL, 0xBC530C83CE15FAE0ULL, 0x08D667C3BF19121EULL } },
+        { { 0x5A31171365227C70ULL, 0xF32BEAB333A3EA70ULL, 0xDDA4B35B2E31C60FULL, 0x6DEEEA0D5A3E1137ULL },
+          { 0xAD6DA3810369B9B7ULL, 0x287AEC1E569083DBULL, 0x0014CBAFEF6ACC84ULL, 0xCBB93F0FC7443E40ULL } },
+        { { 0xFB5FD5E88421B54DULL, 0x579B2B83A5564A4FULL, 0xD4AC9D2BB1FA9DCAULL, 0x28135C10635578D8ULL },
+          { 0xADCCF09B8EE5D868ULL, 0xEF0494CC91E310D8ULL, 0x06FA9D74107F8C15ULL, 0x9ED84ABE3851BE15ULL } },
+        { { 0x917E5591E8E4AC10ULL, 0x7996A812ACE24A9AULL, 0xD6C3CC5A09FFB568ULL, 0x339A057620B1077BULL },
+          { 0xF76DA8644D1312A0ULL, 0x5039E788F41CC66EULL, 0x43854DF78ACF553EULL, 0xCA985FBEDD6A947FULL } }
+    },
+    {   /* 57: (2j+1)*2^228*G */
+        { { 0xD34DAB1767EA1F34ULL, 0x646BD35404739E0DULL, 0xC3B41D1793B353D6ULL, 0x7F9460A23D474B66ULL },
+          { 0x58BEC2CACD9063ECULL, 0xC6FF815124E34FFCULL, 0x69F1F2BF8F076661ULL, 0xD0D516778FB06187ULL } },
+        { { 0xDC5B74C9BDFC0A9DULL, 0xDE44235B14F77AA0ULL, 0x2A60E3646AE0A2A2ULL, 0xDB43E7F84C329E02ULL },
+          { 0xF0B1093A9E9AD713ULL, 0x8839047356D2F054ULL, 0xB8A56C814CEF9FA4ULL, 0xB0168DA2BE36B591ULL } },
+        { { 0x30BCB1774283808DULL, 0x0F8F07CE35643A89ULL, 0xB8515E9121FA7898ULL, 0xE9AF3081EE0D21AEULL },
+          { 0x966C2F8E39B39D33ULL, 0x976B925115136D19ULL, 0x85AF26550FEF4971ULL, 0xA976C8489C471260ULL } },
+        { { 0x2692F42CAD8426DFULL, 0x0F41395A4E6F8A0AULL, 0x703AC9383BF88359ULL, 0x6EB733632C806980ULL },
+          { 0x3FF759EE200B4267ULL, 0x9252E97C83FE1B83ULL, 0x030E4B2CECC08E8DULL, 0x96C56EC117307A9AULL } },
+        { { 0xF7D16D7C1A16453DULL, 0x8B7E87BE761033DBULL, 0xE1741B91F8B4D0E6ULL, 0xD3979D5E079D5F45ULL },
+          { 0xF3CBB83167B6D737ULL, 0x17DDF6628A6961A4ULL, 0xA4D0925753724569ULL, 0xC55F9335D799ADB9ULL } },
+        { { 0xCEA199A5ED326504ULL, 0xF65A9B4627B5202CULL, 0x2C383B88C1AEFC12ULL, 0x54C3929CE5B8C234ULL },
+          { 0x8BF011FA7EC9E107ULL, 0x47A53D9E608A6726ULL, 0xC489AA284914AB44ULL, 0x4696302560EA16D0ULL } },
+        { { 0x3044F576BB5ECCE7ULL, 0x7328158B0C0D2135ULL, 0xB84E8E83C19659C8ULL, 0x3744E9B28666D6C5ULL },
+          { 0x201321416A247721ULL, 0x28E8B5F052A6F839ULL, 0x0E0E6956EB29EC3CULL, 0x9546E0F8D99047AAULL } },
+        { { 0x50C928DE45FEF996ULL, 0x14068F6394425351ULL, 0x324CD0A41EF3F2DEULL, 0x11343E17E3656D53ULL },
+          { 0x40150AE75792ADEDULL, 0xD0CE4D65A086F18EULL, 0xB04DDF9306273765ULL, 0x4A9E8480DEBA8EEEULL } }
+    },
+    {   /* 58: (2j+1)*2^232*G */
+        { { 0xCEC9B4D78E6D8483ULL, 0x82F2D7A846967F0DULL, 0x2958F49F1B6EE945ULL, 0x9C39CB60A33D563DULL },
+          { 0x94B3356F6B2C50FBULL, 0xBBADE52F3DBE4368ULL, 0x03D196B7BCA16546ULL, 0xF097BF1EE493E510ULL } },
+        { { 0xF55C31F847A14DDAULL, 0x606D0429674B4DF3ULL, 0x443768F724013083ULL, 0x18F37ACC90EADAD7ULL },
+          { 0xE22FCDC325AC8364ULL, 0x77D8F7C78A8536CBULL, 0xD7BBFFECEE1BCD0BULL, 0x2F944BBAAA092C26ULL } },
+        { { 0x5674E8E8CC7D59BEULL, 0x98EA18588E0932FBULL, 0x4EC5FFEE4772736BULL, 0x5413358C281E79DAULL },
+          { 0x2D7EA1F6E4F80590ULL, 0x53E25B15C900B367ULL, 0xE7C48FD20164515AULL, 0x680FD4DE969CB024ULL } },
+        { { 0x8EB80C9F876051A8ULL, 0xBED773963A457EA5ULL, 0x5DCFC1A3C1B85280ULL, 0x4E2FD12691B194F0ULL },
+          { 0x6AFEC74FE9CC9005ULL, 0xEBB8BAA592C4FE2EULL, 0x371B35A1508A31BCULL, 0x122ABBDBF5F4FBB2ULL } },
+        { { 0x367CA8FA56A80E09ULL, 0xA275F0F76625F5FEULL, 0x2004F56813C08FA0ULL, 0x2DE758D4BEFF1B59ULL },
+          { 0x9D62EDF5436A1CD3ULL, 0x7A1ADC6695DAD6C9ULL, 0xD7C032B0265E64A0ULL, 0xDD9ACF3177D8EE67ULL } },
+        { { 0xC25035B2FA3628ACULL, 0x568BBA2CDF5B564EULL, 0x28C5A173C6EE12A4ULL, 0xF597A0ACDC1D4A57ULL },
+          { 0x7EA0310D6CD3550FULL, 0x772ECF91D412106EULL, 0x7BB1BB7289622CC0ULL, 0x0DB9168E332BD455ULL } },
+        { { 0x78D683D4AB75D6C3ULL, 0xC42A5457D53A2856ULL, 0x08A1071821BE40F3ULL, 0xAA222A86D6F44FB9ULL },
+          { 0x13265A4E644CB028ULL, 0x6071FC94B5A8C8F6ULL, 0xCE448A25AEE2DF42ULL, 0x56378793001A8E76ULL } },
+        { { 0x7FA85739235790C9ULL, 0x9E01B91773F3C503ULL, 0x56F0C64392F35E2EULL, 0x8568B26BCD9715B7ULL },
+          { 0xDD3F553826B1F5ACULL, 0x0145E5F8FB85479FULL, 0xE9078E0AE4363CE8ULL, 0xD3F2261A584DD2ADULL } }
+    },
+    {   /* 59: (2j+1)*2^236*G */
+        { { 0x7DDA97C55C38D4E4ULL, 0xE2FD65F1B1B17374ULL, 0x97566E7430181E25ULL, 0x3D92852611229938ULL },
+          { 0x6FAAEF00C0CCF0D3ULL, 0xCC0AB138197ABC7FULL, 0x3FF057035C2869EAULL, 0xD32CA0A5D468EAB5ULL } },
+        { { 0xD07232580DD7718AULL, 0x91C81B6519BE4E4EULL, 0xF7C159A25E76DFF8ULL, 0x3B180E372B902FC3ULL },
+          { 0x726626299AFD82DBULL, 0x58491156702D14D0ULL, 0xFAA4BC9D2905211EULL, 0xF2B6B117F36B58AAULL } },
+        { { 0xFA81A51193D3653DULL, 0x134EC4B274E467D5ULL, 0x45EF4F4098A83EB2ULL, 0xF352FF0391D69C9FULL },
+          { 0x79E6678C8A44F28EULL, 0x5C1995F972C582D0ULL, 0x020BD73DFDA6D505ULL, 0x4472626CCB6C5EBDULL } },
+        { { 0xD661DF1AED4478DAULL, 0xF15CF6C2240E0154ULL, 0x0AFB45CDBF793CA1ULL, 0x670EE471034D8C23ULL },
+          { 0x628FFE4FF4F563F0ULL, 0x1CC3B8160FF24770ULL, 0x2546605B138750E8ULL, 0x5CA0C7425BA022CAULL } },
+        { { 0xAC4E290443DBD581ULL, 0x3CFEB38828D6B35BULL, 0xEFBBFA30ACEC6FA9ULL, 0x96F2E354349D9BDBULL },
+          { 0x4D9A4FFEE8F59952ULL, 0x35A18F1D504F5D45ULL, 0x4FE5D8E3960DBAF4ULL, 0x09FCD80885D526CFULL } },
+        { { 0x1EB34324A4E9C2FCULL, 0xE72CF0CF2FBD706AULL, 0x8041820B14609A35ULL, 0xC4946E517E8399ACULL },
+          { 0x3434763766398CE8ULL, 0xE48BF38ED1462312ULL, 0xE99A0F68F47B8237ULL, 0x74890120B1858A4CULL } },
+        { { 0x5CB9173E84960B03ULL, 0xB6AC3AB0C8808E8FULL, 0xFA48C8C578094D8FULL, 0x1653B64DA9BE33DBULL },
+          { 0xF806A54EB0F73C69ULL, 0x8B38E0E4A1B564E7ULL, 0x9F4B2BD83E95A894ULL, 0xA583708169E5D560ULL } },
+        { { 0xC5577E31BB63640EULL, 0x979BB7F290C72DF2ULL, 0x500C679CA685CBF4ULL, 0x51076DD7ED2F153FULL },
+          { 0x1F69728782E4476CULL, 0xC8BEA4E9E720EF02ULL, 0xAEBE650172E0FDA6ULL, 0xB397274A2D6DDF76ULL } }
+    },
+    {   /* 60: (2j+1)*2^240*G */
+        { { 0x606304B1A44E8DE3ULL, 0x5C08966A2ECC1E07ULL, 0x3A5A7DCF08BD1791ULL, 0xF50B99B7468810B7ULL },
+          { 0x4A3F3BA6DB7F3588ULL, 0xE975F18D21721E85ULL, 0x8789973A2DEDCEBBULL, 0xE2B5061E55F18F0CULL } },
+        { { 0xDDDC6B6B82ACCF8BULL, 0x81D2999182816FA7ULL, 0x645F30E251394304ULL, 0x598D7F61A5505770ULL },
+          { 0x1B84673C0F6CB808ULL, 0xD2289A8F353540B9ULL, 0x546C5162B273EBCAULL, 0x9F3121F74F8F2609ULL } },
+        { { 0x9FB39A5464AA7B3EULL, 0x13C4EF1B056C9CEAULL, 0x64FD2091541C5810ULL, 0x715A2012F49F4C4DULL },
+          { 0xD9A33944BC7D081DULL, 0x421BC588A88B47D0ULL, 0x1F79288F8A913B62ULL, 0x5922B3B1AA606C0AULL } },
+        { { 0xD1BDB697620DB220ULL, 0xC71CCB101687ACE4ULL, 0xC409CE897FB87876ULL, 0x49EC8C5E6AA9B125ULL },
+          { 0x99B8ACA0677338C2ULL, 0x842C3073E53B9CCEULL, 0x3DA9CC34865F5429ULL, 0x99A97D4FE5EA629BULL } },
+        { { 0x51EBCA315E771268ULL, 0x2F4F14A7D90A6568ULL, 0x3E6F190E05E07B7AULL, 0x1F8FB70D4850B448ULL },
+          { 0x1AFD3010C909C8DDULL, 0x4E1D3C311C92B3ABULL, 0x12C2ED74726192A1ULL, 0xF53E7ADB461BA2BFULL } },
+        { { 0x55EC0F2B28D9819EULL, 0xD606792F742DAB1AULL, 0xDD5D142BA678732CULL, 0xB8D5C71A6497F61FULL },
+          { 0xDC78BE8EA9138AC4ULL, 0xE2F49F1361D45C3CULL, 0x3B6EE4359B63DC79ULL, 0x1CD14EF132137F82ULL } },
+        { { 0x6A93DBE660BCA3F3ULL, 0xECB3435145600490ULL, 0xDD63EB61C880D8C4ULL, 0x2265B5AC65BAAE3DULL },
+          { 0x25829C6C517409FFULL, 0x3C80A612D2393D5AULL, 0x61A313A3B1096498ULL, 0x97A198BF5CACFE0FULL } },
+        { { 0x372D23FF45BAC36EULL, 0x599899459975DCD0ULL, 0x21FD8A9F5FC9ABCBULL, 0xAF381CD103584925ULL },
+          { 0xFF3D887AB1B119A9ULL, 0x589B82F1EF4D4A90ULL, 0xC9457F22951A2648ULL, 0x681A087FB7DF0FBDULL } }
+    },
+    {   /* 61: (2j+1)*2^244*G */
+        { { 0x9E1994056037CFB4ULL, 0x7400F246C3CDAA85ULL, 0x0D77F4880DA0B0E0ULL, 0x042531823FF5ED0BULL },
+          { 0x00B7325ED8775D23ULL, 0xEEA3E4F534EC5DD4ULL, 0x628CA4D0C8661FACULL, 0xC90E8BCCFAE00F7EULL } },
+        { { 0x784F673546C34577ULL, 0xE6409EC8E6A52AF7ULL, 0xB1F5E308E8C0E4BDULL, 0x27557AA0E30BCA48ULL },
+          { 0xADFEB9B80416193CULL, 0x18A2CA7374C4380BULL, 0x77C8D75A49FD34F3ULL, 0x8399C75846105B3BULL } },
+        { { 0xEE58FDB6A401F4D3ULL, 0xCF6C2E50EA95B301ULL, 0x8E50783BF561D7DEULL, 0x8E687817D2587364ULL },
+          { 0x90281E944294D86BULL, 0x900B96F12EA19128ULL, 0x62F809A0506D3CAEULL, 0x989CAB886E2C9BFAULL } },
+        { { 0xC5963DE26D2AA8E6ULL, 0x205359FC40EFFE2DULL, 0xD1036803CA67DBEEULL, 0x98A41746253E5CF6ULL },
+          { 0x69740BED606CF75BULL, 0xE30217FAAB7ED219ULL, 0xB11542F5A2F5CEC9ULL, 0x579AC6947E3463D6ULL } },
+        { { 0x7CA2CC8F752C2D31ULL, 0x1800ABB08C61EECDULL, 0x92216E443E21A946ULL, 0xE1685442230540FDULL },
+          { 0x1CB8836824A50FECULL, 0x3E76192BF8998394ULL, 0x2FB2E642D02BC934ULL, 0x0700855C928E7214ULL } },
+        { { 0x4A33BAE373A7CDADULL, 0x3CAD83D2E50BCFAFULL, 0x1CA2A2E5338951A5ULL, 0xBFA6314B09D513EAULL },
+          { 0xC5F88930295CB953ULL, 0x261190F8C84047A1ULL, 0x2A5F85BBB1EED1A7ULL, 0xB452E8194C802C78ULL } },
+        { { 0xEDBCC8500ADE0FB7ULL, 0x0C6DC74DEA6518D8ULL, 0xECF0975E6DD98E20ULL, 0xE687082D0A961CD3ULL },
+          { 0x9179E0F31D4D6ECEULL, 0x17C1E85EF88C2259ULL, 0x5E5F0E5321D1A721ULL, 0x2135A448684C9555ULL } },
+        { { 0xC83CB5F0CE432DAFULL, 0xF3BEDA08AA827AC9ULL, 0x4BFC28D795074975ULL, 0x7AB16EF862A9A9E9ULL },
+          { 0x3117588AA71BDC48ULL, 0xC7E9CE3AE74FDB01ULL, 0xA359183E28DBA7C5ULL, 0x584E0E0A97C328B1ULL } }
+    },
+    {   /* 62: (2j+1)*2^248*G */
+        { { 0xC0747129885FBD44ULL, 0x89C2CAA39F26267AULL, 0xE05471CE16D5222CULL, 0x9BBF06DAD9AB5905ULL },
+          { 0xA3447DFA7A1D3E88ULL, 0xC0D4BDDC15036ED2ULL, 0x6755DAF30A6F47E8ULL, 0x1BCC7FA84DE120A3ULL } },
+        { { 0x8B7AE792B4A7B506ULL, 0x22758BBAE7860BE0ULL, 0x429CFB2AE7500EE9ULL, 0x646FF7F65B3B5BD3ULL },
+          { 0xC979C1252B36F946ULL, 0x492DFC4FC08E6995ULL, 0x5A61E331804A8FE8ULL, 0xBC112A9D064A18A5ULL } },
+        { { 0x154B71C9C103B553ULL, 0xBE60EA2783385A80ULL, 0x9D0C1000B27E507EULL, 0x7CC0547AA617D39AULL },
+          { 0x5799CBA3CD45A526ULL, 0x00185A0AAC228B7DULL, 0xBDD728CB39FC94C4ULL, 0x7B329EBD2328045AULL } },
+        { { 0xAC2EF45419E717A4ULL, 0x68DA2BDAACF01B81ULL, 0x0563ED536DAEE154ULL, 0x946851990BC1DB4EULL },
+          { 0xA75F0FD1B526DEA3ULL, 0x57999590F70ACD9CULL, 0xB3B8D0E6B2667DC0ULL, 0xCA5C78420DC591A8ULL } },
+        { { 0xDF82C36F08362735ULL, 0xDFF8B37EF12B327BULL, 0xB1258F8EA452D1F5ULL, 0xE1B98F1BE7E0E8FAULL },
+          { 0xF96138C9CECB11B7ULL, 0x7E19EE33DF74090AULL, 0x7E05B49A83BB2BA2ULL, 0xCA83E9AD9A976A0BULL } },
+        { { 0x3B40BBD839046346ULL, 0x56A58DE730144008ULL, 0x6D08A06BD967962DULL, 0x3536F25C8FD607EFULL },
+          { 0x9401062BCC14FEA6ULL, 0x9E6C3D1EA2D9B3E2ULL, 0x73BA16A1A529E1C3ULL, 0x1E271FE17DE3509EULL } },
+        { { 0x0FFF83ED6847F6F8ULL, 0x1029B51FBD40EF53ULL, 0x690151F34B7F8C3CULL, 0x0DF50246BE23D4DEULL },
+          { 0xB4CCA8A6BB1633A6ULL, 0x4C6E166689DF3449ULL, 0x2B232C4FBC2174ABULL, 0x2107047F29DAF1CAULL } },
+        { { 0x185CEAEDFD4F1B81ULL, 0xAD69A7A48CF4BB15ULL, 0xF69DE3B336529330ULL, 0xCA9DD5D44CF53398ULL },
+          { 0x8CC62CAE42B7C8BDULL, 0x66C9760BFAADA10FULL, 0x402471FB44467B3EULL, 0x6E4B988651BE2C56ULL } }
+    },
+    {   /* 63: (2j+1)*2^252*G */
+        { { 0x1EAD3233444C0448ULL, 0x96357686C10319E3ULL, 0x4943FCCB3B7893E7ULL, 0xB12FADF52943DFA5ULL },
+          { 0x96575E76B369DE57ULL, 0x1D05E70332FC4DF2ULL, 0xE96F8F6677B2A6A7ULL, 0x02E2459599B0F4ACULL } },
+        { { 0xF536C45464E9151FULL, 0x67EA3399C80D8418ULL, 0x43255DDA91D8FB3EULL, 0x48388E34F1C50568ULL },
+          { 0x1BEE49EDCD7A9434ULL, 0x99B1411153DE8310ULL, 0x6A25339315482BCCULL, 0xB0EC63ABF4E44E9EULL } },
+        { { 0xD7DFB4A58E5B833DULL, 0x593A0073CA0B2419ULL, 0x5E65DF81050109C9ULL, 0xDE8E6447AE1453DAULL },
+          { 0xF0FCC19AA14C5CC7ULL, 0x987E03132901C6C9ULL, 0xE332288CBD6DE265ULL, 0x05E1463C150913D8ULL } },
+        { { 0x3E2593EAC1F7DF48ULL, 0xB267473EB871317BULL, 0x8E555B4E4E58F385ULL, 0xB18B12D0A4EC7E9EULL },
+          { 0x91B3D590E846B546ULL, 0x3C83F7E483D1E559ULL, 0x5CEC426BC5ACC33BULL, 0xFF531922A359FB44ULL } },
+        { { 0xF253ADC699C9FD24ULL, 0x02CDD89845211E0DULL, 0xC7C1CAA4C7286944ULL, 0x5F51AD71C8DC9433ULL },
+          { 0x9C3BAE886D2FFD3AULL, 0x8721F6244624A996ULL, 0x0CD305FBCC2E4D03ULL, 0x2BBBEF11DF7E714AULL } },
+        { { 0xE3C4063FD7CEC42EULL, 0x6F3DC933EEE3BDB7ULL, 0xFA5822EE4346D855ULL, 0xFDF340D937301EBBULL },
+          { 0x38F634B7CDB6908BULL, 0x456E6ABF50DE30C8ULL, 0xD70C1FE738CAD2C4ULL, 0xA3E59A63968CC6E1ULL } },
+        { { 0xFC189454E1DC4FE8ULL, 0xF9E8A13A96072415ULL, 0xEC6452917B7DC983ULL, 0xE3CAEBC8B9EA5D79ULL },
+          { 0x16B60B721307B403ULL, 0x51300365A14F86A1ULL, 0xD22035CB8B01F976ULL, 0x97F093D27BF05928ULL } },
+        { { 0x6414D65D3C119EFFULL, 0x39902E0C0A9F9B84ULL, 0x9AF41A5CE58FA003ULL, 0x03312DB942A865B8ULL },
+          { 0xFE95A3A9F8B1B950ULL, 0x0AEC59DB5F515585ULL, 0x104EEA317809E86FULL, 0x6E3EDA646B3724DFULL } }
+    },
+    {   /* 64: (2j+1)*2^256*G */
+        { { 0x39912513C420924AULL, 0x00B60867487CAB57ULL, 0x5AFB62DE48ADDE64ULL, 0x0B197A2E1E67A44BULL },
+          { 0xB9E53B38D1045A5FULL, 0x0F5F54EFB8BFB340ULL, 0x566F385D67C641FCULL, 0xA4A03B30F39453E2ULL } },
+        { { 0xC6771B1E117F3422ULL, 0xE0CE938158FEF2B1ULL, 0x10237E11061A94C5ULL, 0x1F256F8C50AA0677ULL },
+          { 0xAA1697BA9F4262F0ULL, 0x22C6AE055D459464ULL, 0x756DF03E73032F9DULL, 0x20D65BF45BA69832ULL } },
+        { { 0x13D7D10640410675ULL, 0xCA1DC00FD49D411EULL, 0xF3E15132476F4CF0ULL, 0x43B373D51F0AA42EULL },
+          { 0x6663ACA459220B1EULL, 0x457BF8FB338B9786ULL, 0x014A2F9C0B40585BULL, 0xFFEC0D9AB81F710CULL } },
+        { { 0x1BC52BFB79EDD558ULL, 0x4E5DA8BD354CC703ULL, 0x3651639DEC5DCD85ULL, 0x0F4B0083ADFC3716ULL },
+          { 0x3E636C8A8A632321ULL, 0x37F4721823D4E656ULL, 0x6FAAADFF134CD659ULL, 0x8DC30254CD724765ULL } },
+        { { 0x8ADB4D459D3CAE94ULL, 0x07315855DBB73830ULL, 0xC1BF3598109A4C39ULL, 0x5E56D0EC009891C7ULL },
+          { 0xA98357109FCE76AAULL, 0x084102498A3D6ECCULL, 0x77F5FE4087266079ULL, 0x2121B9CEA0F08FC8ULL } },
+        { { 0xC8930E7530620039ULL, 0xAAA5EDEC02756D35ULL, 0xF4B1399C8D83801FULL, 0xF44741814DFEA5E1ULL },
+          { 0x5A62BE771267078BULL, 0x6BBEE3975797A4E6ULL, 0xC43844E9E8D03999ULL, 0xBC17A6806AB02863ULL } },
+        { { 0xD57B5FFA622659E4ULL, 0x021BDF037C7D6878ULL, 0x770140A5E774A040ULL, 0xD071B89512360EB6ULL },
+          { 0xB0C94616377758C2ULL, 0x056FC2D29D6C3FDFULL, 0x2F59F1BF34B0BDF0ULL, 0x14E12313321CEC25ULL } },
+        { { 0xE31D6DE724FBECB5ULL, 0x8906E2186EB5EC12ULL, 0x3A1384BE674CE689ULL, 0xE36DEFC3D7A7BA83ULL },
+          { 0xC40577AA1DD0F849ULL, 0x446781F94C51E2A1ULL, 0x674F1F4524779D1BULL, 0x87504F5288BAED64ULL } }
+    }
+};
+
+/* Constant-time table lookup to extract an affine point from one row of the fixed-base table
+ * Operation: P = sign * row[(|digit|-1)/2], where sign=1 if digit>0 and sign=-1 if digit<0
+ */
+static void lut_fixedbase(const ecpoint_t* row, ecpoint_t* P, int digit)
+{
+    unsigned int i, j;
+    digit_t sign, mask, pos;
+    digit256_t negy;
+
+    sign = ((digit_t)digit >> (RADIX_BITS - 1)) - 1;                            /* if digit<0 then sign = 0x00...0 else sign = 0xFF...F */
+    pos = ((sign & ((digit_t)digit ^ (digit_t)-digit)) ^ (digit_t)-digit) >> 1; /* position = (|digit|-1)/2  */
+    fpcopy_p256(row[0].x, P->x);                                                /* P = row[0]  */
+    fpcopy_p256(row[0].y, P->y);
+
+    for (i = 1; i < FIXEDBASE_COLS; i++) {
+        pos--;
+        /* If match then mask = 0xFF...F else mask = 0x00...0 */
+        mask = (digit_t)is_digit_nonzero_ct(pos) - 1;
+        for (j = 0; j < P256_DIGITS; j++) {
+            P->x[j] = (mask & (P->x[j] ^ row[i].x[j])) ^ P->x[j];
+            P->y[j] = (mask & (P->y[j] ^ row[i].y[j])) ^ P->y[j];
+        }
+    }
+
+    fpcopy_p256(P->y, negy);
+    fpneg_p256(negy);
+    for (j = 0; j < P256_DIGITS; j++) {                                         /* if sign = 0x00...0 then choose negative of the point  */
+        P->y[j] = (sign & (P->y[j] ^ negy[j])) ^ negy[j];
+    }
+
+    /* cleanup */
+    fpzero_p256(negy);
+}
+
+/* Mixed point addition P = P+Q
+ * Inputs: P = (X1,Y1,Z1) in Jacobian coordinates
+ *         Q = (x2,y2) in affine coordinates
+ * Output: P = (X1,Y1,Z1) in Jacobian coordinates
+ */
+static void ec_add_mixed(ecpoint_jacobian_t* P, const ecpoint_t* Q)
+{
+    digit256_t t1, t2, t3, t4, t5;
+    digit_t temps[P256_TEMPS];
+
+    /* SECURITY NOTE: this function does not produce exceptions when P!=inf, P!=Q and P!=-Q.
+     *                In particular, it is exception-free when called from ec_scalarmul_base() on rows below FIXEDBASE_FIRST_COMPLETE_ROW.
+     */
+
+    fpsqr_p256(P->Z, t1, temps);                /* t1 = z1^2  */
+    fpmul_p256(P->Z, t1, t2, temps);            /* t2 = z1^3  */
+    fpmul_p256(t1, Q->x, t3, temps);            /* t3 = z1^2*x2  */
+    fpmul_p256(t2, Q->y, t4, temps);            /* t4 = z1^3*y2  */
+    fpsub_p256(t3, P->X, t3);                   /* t3 = beta = z1^2*x2-x1  */
+    fpsub_p256(t4, P->Y, t4);                   /* t4 = alpha = z1^3*y2-y1  */
+    fpmul_p256(P->Z, t3, P->Z, temps);          /* Zfinal = z1*beta  */
+    fpsqr_p256(t3, t1, temps);                  /* t1 = beta^2  */
+    fpmul_p256(t1, t3, t2, temps);              /* t2 = beta^3  */
+    fpmul_p256(P->X, t1, t5, temps);            /* t5 = x1*beta^2  */
+    fpsqr_p256(t4, t1, temps);                  /* t1 = alpha^2  */
+    fpsub_p256(t1, t2, t1);                     /* t1 = alpha^2-beta^3  */
+    fpsub_p256(t1, t5, t1);                     /* t1 = alpha^2-beta^3-x1*beta^2  */
+    fpsub_p256(t1, t5, P->X);                   /* Xfinal = alpha^2-beta^3-2*x1*beta^2  */
+    fpsub_p256(t5, P->X, t5);                   /* t5 = x1*beta^2-Xfinal  */
+    fpmul_p256(t4, t5, t1, temps);              /* t1 = alpha.(x1*beta^2-Xfinal)  */
+    fpmul_p256(P->Y, t2, t3, temps);            /* t3 = y1*beta^3  */
+    fpsub_p256(t1, t3, P->Y);                   /* Yfinal = alpha.(x1*beta^2-Xfinal)-y1*beta^3  */
+
+    /* cleanup */
+    fpzero_p256(t1);
+    fpzero_p256(t2);
+    fpzero_p256(t3);
+    fpzero_p256(t4);
+    fpzero_p256(t5);
+    ClearMemory(temps, sizeof(temps));
+}
+
+/*
+ * Fixed-base scalar multiplication Q = k.G using the precomputed table
+ * Weierstrass a=-3 curve
+ */
+QStatus ec_scalarmul_base(digit256_t k, ecpoint_t* Q, ec_t* curve)
+{
+    int digits[FIXEDBASE_ROWS] = { 0 };
+    size_t i = 0;
+    size_t j = 0;
+    sdigit_t odd = 0;
+    ecpoint_jacobian_t T;
+    ecpoint_jacobian_t TT;
+    ecpoint_t R;
+    digit256_t temp;
+
+    /* SECURITY NOTE: the crypto sensitive part of this function is protected against timing attacks and runs in constant-time.
+     *                Conditional if-statements evaluate public data only and the number of iterations for all loops is public.
+     */
+
+    if (k == NULL || Q == NULL || curve == NULL) {
+        return ER_INVALID_ADDRESS;
+    }
+    if ((curve->curveid != NISTP256r1) || (curve->rbits != 256)) {
+        return ER_BAD_ARG_3;
+    }
+    /* Is scalar k in [1,r-1]?  */
+    if ((fpiszero_p256(k) == true) || (validate_256(k, curve->order) == false)) {
+        return ER_INVALID_DATA;
+    }
+
+    odd = -((sdigit_t)k[0] & 1);
+    fpsub_p256(curve->order, k, temp);                  /* Converting scalar to odd (r-k if even)  */
+    for (j = 0; j < P256_DIGITS; j++) {                 /* If (even) then k = k_temp else k = k   */
+        temp[j] = (odd & (k[j] ^ temp[j])) ^ temp[j];
+    }
+
+    fixed_window_recode(temp, (unsigned int)curve->rbits, W_FIXEDBASE, digits);
+
+    lut_fixedbase(P256_FIXEDBASE_TABLE[0], &R, digits[0]);
+    ec_affine_tojacobian(&R, &T);                       /* Initialize T = (X_T:Y_T:Z_T) with a point from the first row */
+
+    for (i = 1; i < FIXEDBASE_FIRST_COMPLETE_ROW; i++) {
+        lut_fixedbase(P256_FIXEDBASE_TABLE[i], &R, digits[i]);
+        ec_add_mixed(&T, &R);                           /* (X_T:Y_T:Z_T) = (X_T:Y_T:Z_T) + (x_R,y_R) */
+    }
+    for (; i < FIXEDBASE_ROWS; i++) {
+        lut_fixedbase(P256_FIXEDBASE_TABLE[i], &R, digits[i]);
+        ec_affine_tojacobian(&R, &TT);
+        ec_add_jacobian(&TT, &T, curve);                /* Complete addition (X_T:Y_T:Z_T) = (X_T:Y_T:Z_T) + (X_R:Y_R:1)  */
+    }
+
+    fpcopy_p256(T.Y, temp);
+    fpneg_p256(temp);                                   /* Correcting scalar (-Ty if even)  */
+    for (j = 0; j < P256_DIGITS; j++) {                 /* If (even) then Ty = -Ty   */
+        T.Y[j] = (odd & (T.Y[j] ^ temp[j])) ^ temp[j];
+    }
+
+    ec_toaffine(&T, Q, curve);                          /* Output Q = (x,y)  */
+
+    ClearMemory(digits, sizeof(digits));
+    ClearMemory(&T, sizeof(T));
+    ClearMemory(&TT, sizeof(TT));
+    ClearMemory(&R, sizeof(R));
+    fpzero_p256(temp);
+
+    return ER_OK;
+}
+
+#else
+
+/*
+ * Fixed-base scalar multiplication Q = k.G without the precomputed table,
+ * for builds that cannot spare the space (ECC_FIXEDBASE=off).
+ */
+QStatus ec_scalarmul_base(digit256_t k, ecpoint_t* Q, ec_t* curve)
+{
+    if (curve == NULL) {
+        return ER_INVALID_ADDRESS;
+    }
+    return ec_scalarmul(&(curve->generator), k, Q, curve);
+}
+
+#endif
+
+}
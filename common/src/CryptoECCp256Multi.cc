@@ -0,0 +1,329 @@
+/**
+ * @file
+ * Variable-time multi-scalar multiplication on NIST P-256, for operations on
+ * public data such as batch signature verification.
+ */
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#include <stdlib.h>
+#include <qcc/Util.h>
+#include <qcc/CryptoECC.h>
+#include <qcc/CryptoECCp256.h>
+
+namespace qcc {
+
+#define W_MULTI 5       /* Window size of the width-w NAF used by ec_multiscalarmul_vartime().  Uses 2^(W_MULTI-2) points per input point. */
+
+#define MULTI_NPOINTS (1 << (W_MULTI - 2))
+
+/* Maximum length of a width-w NAF of a 256-bit scalar. */
+#define MULTI_NAF_LEN ((sizeof(digit256_t) * 8) + 1)
+
+/* Set P to the point at infinity (0:1:0) */
+static void ecpoint_jacobian_infinity(ecpoint_jacobian_t* P)
+{
+    fpzero_p256(P->X);
+    fpzero_p256(P->Y);
+    fpzero_p256(P->Z);
+    P->Y[0] = 1;
+}
+
+/* Point addition P = P+Q handling every special case, in variable time
+ * Weierstrass a=-3 curve
+ * Inputs: P = (X1,Y1,Z1) in Jacobian coordinates
+ *         Q = (X2,Y2,Z2) in Jacobian coordinates
+ * Output: P = (X1,Y1,Z1) in Jacobian coordinates
+ */
+static void ec_add_jacobian_vartime(ecpoint_jacobian_t* P, const ecpoint_jacobian_t* Q)
+{
+    digit256_t t1, t2, t3, t4, t5, t6;
+    digit_t temps[P256_TEMPS];
+
+    /* SECURITY NOTE: the branches below depend on the inputs.  Only use this function on public data. */
+
+    if (fpiszero_p256((digit_t*)Q->Z)) {
+        return;
+    }
+    if (fpiszero_p256(P->Z)) {
+        fpcopy_p256(Q->X, P->X);
+        fpcopy_p256(Q->Y, P->Y);
+        fpcopy_p256(Q->Z, P->Z);
+        return;
+    }
+
+    fpsqr_p256(P->Z, t1, temps);            /* t1 = z1^2  */
+    fpmul_p256(P->Z, t1, t2, temps);        /* t2 = z1^3  */
+    fpmul_p256(t1, Q->X, t3, temps);        /* t3 = z1^2*x2  */
+    fpmul_p256(t2, Q->Y, t4, temps);        /* t4 = z1^3*y2  */
+    fpsqr_p256(Q->Z, t1, temps);            /* t1 = z2^2  */
+    fpmul_p256(Q->Z, t1, t2, temps);        /* t2 = z2^3  */
+    fpmul_p256(t1, P->X, t5, temps);        /* t5 = z2^2*x1  */
+    fpmul_p256(t2, P->Y, t6, temps);        /* t6 = z2^3*y1  */
+    fpsub_p256(t3, t5, t3);                 /* t3 = beta = z1^2*x2-z2^2*x1  */
+    fpsub_p256(t4, t6, t4);                 /* t4 = alpha = z1^3*y2-z2^3*y1  */
+
+    if (fpiszero_p256(t3)) {
+        if (fpiszero_p256(t4)) {
+            ec_double_jacobian(P);          /* P = Q  */
+        } else {
+            ecpoint_jacobian_infinity(P);   /* P = -Q  */
+        }
+        return;
+    }
+
+    fpmul_p256(P->Z, Q->Z, t1, temps);      /* t1 = z1*z2  */
+    fpmul_p256(t1, t3, P->Z, temps);        /* Zfinal = z1*z2*beta  */
+    fpsqr_p256(t3, t1, temps);              /* t1 = beta^2  */
+    fpmul_p256(t1, t3, t2, temps);          /* t2 = beta^3  */
+    fpmul_p256(t5, t1, t3, temps);          /* t3 = z2^2*x1*beta^2  */
+    fpsqr_p256(t4, t1, temps);              /* t1 = alpha^2  */
+    fpsub_p256(t1, t2, t1);                 /* t1 = alpha^2-beta^3  */
+    fpsub_p256(t1, t3, t1);                 /* t1 = alpha^2-beta^3-z2^2*x1*beta^2  */
+    fpsub_p256(t1, t3, P->X);               /* Xfinal = alpha^2-beta^3-2*z2^2*x1*beta^2  */
+    fpsub_p256(t3, P->X, t3);               /* t3 = z2^2*x1*beta^2-Xfinal  */
+    fpmul_p256(t4, t3, t1, temps);          /* t1 = alpha.(z2^2*x1*beta^2-Xfinal)  */
+    fpmul_p256(t6, t2, t3, temps);          /* t3 = z2^3*y1*beta^3  */
+    fpsub_p256(t1, t3, P->Y);               /* Yfinal = alpha.(z2^2*x1*beta^2-Xfinal)-z2^3*y1*beta^3  */
+}
+
+/* Computes the width-w NAF of scalar: at most one of any w consecutive digits is nonzero, and nonzero digits are odd and in (-2^(w-1), 2^(w-1)).
+ * Returns the number of digits.
+ */
+static size_t wnaf_recode(digit256_tc scalar, unsigned int w, int* naf)
+{
+    digit_t k[P256_DIGITS + 1];
+    size_t i, j, len = 0;
+    digit_t mask = (((digit_t)1) << w) - 1;
+    digit_t half = ((digit_t)1) << (w - 1);
+
+    for (i = 0; i < P256_DIGITS; i++) {
+        k[i] = scalar[i];
+    }
+    k[P256_DIGITS] = 0;
+
+    for (;;) {
+        digit_t c = 0;
+        for (i = 0; i <= P256_DIGITS; i++) {
+            c |= k[i];
+        }
+        if (c == 0) {
+            break;
+        }
+
+        int digit = 0;
+        if (k[0] & 1) {
+            digit_t d = k[0] & mask;
+            if (d >= half) {
+                /* k = k - (d - 2^w), i.e. add 2^w - d, with carry */
+                digit_t add = (mask + 1) - d;
+                digit = (int)d - (int)(mask + 1);
+                for (j = 0; j <= P256_DIGITS; j++) {
+                    digit_t old = k[j];
+                    k[j] = old + add;
+                    add = (k[j] < old) ? 1 : 0;
+                    if (add == 0) {
+                        break;
+                    }
+                }
+            } else {
+                digit = (int)d;
+                k[0] -= d;
+            }
+        }
+        naf[len++] = digit;
+
+        for (j = 0; j < P256_DIGITS; j++) {     /* k = k / 2  */
+            k[j] = (k[j] >> 1) | (k[j + 1] << (RADIX_BITS - 1));
+        }
+        k[P256_DIGITS] >>= 1;
+    }
+
+    return len;
+}
+
+QStatus ec_multiscalarmul_vartime(const ecpoint_t* P, const digit256_t* k, size_t npoints, ecpoint_jacobian_t* Q, ec_t* curve)
+{
+    ecpoint_jacobian_t table[EC_MULTISCALAR_MAX_POINTS][MULTI_NPOINTS];
+    int naf[EC_MULTISCALAR_MAX_POINTS][MULTI_NAF_LEN];
+    size_t len[EC_MULTISCALAR_MAX_POINTS];
+    size_t maxlen = 0;
+    size_t i, j;
+
+    if (P == NULL || k == NULL || Q == NULL || curve == NULL) {
+        return ER_INVALID_ADDRESS;
+    }
+    if (npoints > EC_MULTISCALAR_MAX_POINTS) {
+        return ER_BAD_ARG_3;
+    }
+
+    for (i = 0; i < npoints; i++) {
+        if (validate_256(k[i], curve->order) == false) {
+            return ER_INVALID_DATA;
+        }
+        if (ecpoint_validation(&P[i], curve) == false) {
+            return ER_INVALID_DATA;
+        }
+
+        /* Precomputation of table[i] = P, 3P, ... , (2*MULTI_NPOINTS-1)P */
+        ecpoint_jacobian_t P2;
+        ec_affine_tojacobian(&P[i], &table[i][0]);
+        ec_affine_tojacobian(&P[i], &P2);
+        ec_double_jacobian(&P2);
+        for (j = 1; j < MULTI_NPOINTS; j++) {
+            table[i][j] = table[i][j - 1];
+            ec_add_jacobian_vartime(&table[i][j], &P2);
+        }
+
+        len[i] = wnaf_recode(k[i], W_MULTI, naf[i]);
+        if (len[i] > maxlen) {
+            maxlen = len[i];
+        }
+    }
+
+    /* Interleaved (Straus) evaluation: one sequence of doublings is shared by all points */
+    ecpoint_jacobian_infinity(Q);
+    for (j = maxlen; j-- > 0;) {
+        ec_double_jacobian(Q);
+        for (i = 0; i < npoints; i++) {
+            if (j >= len[i] || naf[i][j] == 0) {
+                continue;
+            }
+            int digit = naf[i][j];
+            if (digit > 0) {
+                ec_add_jacobian_vartime(Q, &table[i][(digit - 1) / 2]);
+            } else {
+                ecpoint_jacobian_t T = table[i][(-digit - 1) / 2];
+                fpneg_p256(T.Y);
+                ec_add_jacobian_vartime(Q, &T);
+            }
+        }
+    }
+
+    return ER_OK;
+}
+
+/* Does the Jacobian point S equal the affine point a or its negative? */
+static boolean_t ec_equal_up_to_sign(const ecpoint_jacobian_t* S, const ecpoint_t* a)
+{
+    digit256_t t1, t2;
+    digit_t temps[P256_TEMPS];
+
+    fpsqr_p256(S->Z, t1, temps);            /* t1 = Z^2  */
+    fpmul_p256(a->x, t1, t2, temps);        /* t2 = x*Z^2  */
+    if (!fpequal_p256(t2, S->X)) {
+        return B_FALSE;
+    }
+    fpmul_p256(t1, S->Z, t2, temps);        /* t2 = Z^3  */
+    fpmul_p256(a->y, t2, t1, temps);        /* t1 = y*Z^3  */
+    if (fpequal_p256(t1, S->Y)) {
+        return B_TRUE;
+    }
+    fpneg_p256(t1);                         /* t1 = -y*Z^3  */
+    return fpequal_p256(t1, S->Y);
+}
+
+boolean_t ec_is_signed_sum_vartime(const ecpoint_jacobian_t* A, const ecpoint_jacobian_t* Z, size_t n, ec_t* curve)
+{
+    ecpoint_jacobian_t S, T;
+    ecpoint_jacobian_t D[EC_MULTISCALAR_MAX_POINTS];
+    bool negated[EC_MULTISCALAR_MAX_POINTS] = { false };
+    ecpoint_t a;
+    bool aIsInfinity;
+    size_t i, j;
+
+    if ((n == 0) || (n > EC_MULTISCALAR_MAX_POINTS)) {
+        return B_FALSE;
+    }
+
+    T = *A;
+    aIsInfinity = fpiszero_p256(T.Z);
+    if (!aIsInfinity) {
+        ec_toaffine(&T, &a, curve);
+    }
+
+    /* S = Z[0] + ... + Z[n-1], D[i] = 2*Z[i] */
+    S = Z[0];
+    for (i = 1; i < n; i++) {
+        ec_add_jacobian_vartime(&S, &Z[i]);
+        D[i] = Z[i];
+        ec_double_jacobian(&D[i]);
+    }
+
+    /* Visit the sums for all signs of Z[1], ..., Z[n-1] in Gray code order, so
+     * that each step flips one sign with one addition.  The sign of Z[0] need not
+     * be enumerated since S and -S are compared with A at the same time.
+     */
+    for (i = 0;; i++) {
+        if (aIsInfinity ? fpiszero_p256(S.Z) : (!fpiszero_p256(S.Z) && ec_equal_up_to_sign(&S, &a))) {
+            return B_TRUE;
+        }
+        if ((i + 1) == ((size_t)1 << (n - 1))) {
+            break;
+        }
+        for (j = 1; (((i + 1) >> (j - 1)) & 1) == 0; j++) {
+        }
+        T = D[j];
+        if (!negated[j]) {
+            fpneg_p256(T.Y);                /* S = S - 2*Z[j]  */
+        }
+        negated[j] = !negated[j];
+        ec_add_jacobian_vartime(&S, &T);
+    }
+
+    return B_FALSE;
+}
+
+boolean_t ec_decompress_x(digit256_tc x, ecpoint_t* P, ec_t* curve)
+{
+    digit256_t t1, t2;
+    digit_t temps[P256_TEMPS];
+
+    if (!fpvalidate_p256(x)) {
+        return B_FALSE;
+    }
+
+    fpsqr_p256(x, t1, temps);           /* t1 = x^2 */
+    fpmul_p256(x, t1, t1, temps);       /* t1 = x^3 */
+    fpadd_p256(t1, curve->b, t1);       /* t1 = x^3 + b */
+    fpadd_p256(x, x, t2);               /* t2 = 2x */
+    fpadd_p256(x, t2, t2);              /* t2 = 3x */
+    fpsub_p256(t1, t2, t1);             /* t1 = x^3 - 3x + b */
+
+    fpsqrt_p256(t1, P->y, temps);       /* y = sqrt(x^3 - 3x + b), if it exists */
+    fpsqr_p256(P->y, t2, temps);
+    if (!fpequal_p256(t1, t2)) {
+        return B_FALSE;
+    }
+    fpcopy_p256(x, P->x);
+
+    return B_TRUE;
+}
+
+}
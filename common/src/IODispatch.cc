@@ -35,6 +35,15 @@
 #include <qcc/IODispatch.h>
 #include <qcc/StringUtil.h>
 #include <qcc/LockLevel.h>
+
+#if defined(QCC_OS_LINUX) || defined(QCC_OS_ANDROID)
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#define IODISPATCH_EPOLL
+#endif
+
 #define QCC_MODULE "IODISPATCH"
 
 using namespace qcc;
@@ -42,14 +51,29 @@ using namespace std;
 
 volatile int32_t IODispatch::iodispatchCnt = 0;
 
+#ifdef IODISPATCH_EPOLL
+/* Maximum number of ready streams taken from the poll set at a time */
+static const int MAX_POLL_EVENTS = 64;
+#endif
+
 IODispatch::IODispatch(const char* name, uint32_t concurrency) :
-    timer((String(name) + U32ToString(IncrementAndFetch(&iodispatchCnt))), true, concurrency, false, 96),
+    timer((String(name) + U32ToString(IncrementAndFetch(&iodispatchCnt))), true, concurrency, false, 96, true),
     lock(LOCK_LEVEL_IODISPATCH_LOCK),
+    pollFd(-1),
+    pollEvent(NULL),
     reload(false),
     isRunning(false),
     numAlarmsInProgress(0),
     crit(false)
 {
+#ifdef IODISPATCH_EPOLL
+    pollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (pollFd < 0) {
+        QCC_LogError(ER_OS_ERROR, ("epoll_create1 failed with %d (%s)", errno, strerror(errno)));
+    } else {
+        pollEvent = new Event(pollFd, Event::IO_READ);
+    }
+#endif
 }
 
 IODispatch::~IODispatch()
@@ -63,6 +87,13 @@ IODispatch::~IODispatch()
      * Just a sanity check.
      */
     QCC_ASSERT(dispatchEntries.size() == 0);
+
+    delete pollEvent;
+#ifdef IODISPATCH_EPOLL
+    if (pollFd >= 0) {
+        close(pollFd);
+    }
+#endif
 }
 
 QStatus IODispatch::Start(void* arg, ThreadListener* listener)
@@ -140,6 +171,7 @@ QStatus IODispatch::StartStream(Stream* stream, IOReadListener* readListener, IO
     dispatchEntries[stream].writeTimeoutCtxt = new CallbackContext(stream, IO_WRITE_TIMEOUT);
     dispatchEntries[stream].readTimeoutCtxt = new CallbackContext(stream, IO_READ_TIMEOUT);
     dispatchEntries[stream].exitCtxt = new CallbackContext(stream, IO_EXIT);
+    RegisterStream(stream, dispatchEntries[stream]);
 
     /* Set reload to false and alert the IODispatch::Run thread */
     reload = false;
@@ -171,13 +203,17 @@ QStatus IODispatch::StopStream(Stream* stream)
 
     /* Disable further read and writes on this stream */
     it->second.stopping_state = IO_STOPPING;
+    bool pollRegistered = it->second.pollRegistered;
+    UnregisterStream(stream, it->second);
 
     /* Set reload to false and alert the IODispatch::Run thread */
     reload = false;
     Thread::Alert();
 
-    /* Wait until the IODispatch::Run thread reloads the set of check events */
-    while (!reload && crit) {
+    /* Wait until the IODispatch::Run thread reloads the set of check events.
+     * Streams in the poll set have already been removed from it.
+     */
+    while (!pollRegistered && !reload && crit) {
         lock.Unlock();
         Sleep(1);
         lock.Lock();
@@ -285,7 +321,8 @@ void IODispatch::AlarmTriggered(const Alarm& alarm, QStatus reason)
          * of descriptors.
          */
         it->second.readInProgress = true;
-        while (!reload && crit && isRunning) {
+        UpdateStream(stream, it->second);
+        while (!dispatchEntry.pollRegistered && !reload && crit && isRunning) {
             lock.Unlock();
             Sleep(1);
             lock.Lock();
@@ -310,7 +347,8 @@ void IODispatch::AlarmTriggered(const Alarm& alarm, QStatus reason)
          * of descriptors.
          */
         it->second.writeInProgress = true;
-        while (!reload && crit && isRunning) {
+        UpdateStream(stream, it->second);
+        while (!dispatchEntry.pollRegistered && !reload && crit && isRunning) {
             lock.Unlock();
             Sleep(1);
             lock.Lock();
@@ -396,6 +434,206 @@ void IODispatch::AlarmTriggered(const Alarm& alarm, QStatus reason)
     }
 }
 
+void IODispatch::RegisterStream(Stream* stream, IODispatchEntry& entry)
+{
+#ifdef IODISPATCH_EPOLL
+    Event& sourceEvent = stream->GetSourceEvent();
+    Event& sinkEvent = stream->GetSinkEvent();
+    if ((pollFd >= 0) &&
+        (sourceEvent.GetEventType() == Event::IO_READ) &&
+        (sinkEvent.GetEventType() == Event::IO_WRITE) &&
+        (sourceEvent.GetFD() != INVALID_SOCKET_FD) &&
+        (sourceEvent.GetFD() == sinkEvent.GetFD())) {
+        entry.pollRegistered = true;
+        entry.pollEvents = 0;
+        UpdateStream(stream, entry);
+        return;
+    }
+#endif
+    entry.pollRegistered = false;
+    waitStreams.insert(stream);
+}
+
+void IODispatch::UnregisterStream(Stream* stream, IODispatchEntry& entry)
+{
+    if (entry.pollRegistered) {
+        /* The stream is no longer IO_RUNNING so this removes it from the poll set */
+        UpdateStream(stream, entry);
+        entry.pollRegistered = false;
+    } else {
+        waitStreams.erase(stream);
+    }
+}
+
+void IODispatch::UpdateStream(Stream* stream, IODispatchEntry& entry)
+{
+#ifdef IODISPATCH_EPOLL
+    if (!entry.pollRegistered) {
+        return;
+    }
+    uint32_t events = 0;
+    if (entry.stopping_state == IO_RUNNING) {
+        if (entry.readEnable && !entry.readInProgress) {
+            events |= EPOLLIN;
+        }
+        if (entry.writeEnable && !entry.writeInProgress) {
+            events |= EPOLLOUT;
+        }
+    }
+    if (events == entry.pollEvents) {
+        return;
+    }
+    /*
+     * A stream that is not waiting for any event is taken out of the poll set
+     * altogether since hang-ups and errors are always reported by epoll.
+     */
+    int op = (entry.pollEvents == 0) ? EPOLL_CTL_ADD : ((events == 0) ? EPOLL_CTL_DEL : EPOLL_CTL_MOD);
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.ptr = stream;
+    SocketFd fd = stream->GetSourceEvent().GetFD();
+    if (epoll_ctl(pollFd, op, fd, &ev) == 0) {
+        entry.pollEvents = events;
+    } else if (op == EPOLL_CTL_DEL) {
+        /* A closed descriptor has already been dropped from the poll set */
+        entry.pollEvents = 0;
+    } else {
+        QCC_LogError(ER_OS_ERROR, ("epoll_ctl(%d) on fd %d failed with %d (%s)", op, fd, errno, strerror(errno)));
+    }
+#else
+    QCC_UNUSED(stream);
+    QCC_UNUSED(entry);
+#endif
+}
+
+bool IODispatch::SourceEventSignaled(Stream* stream)
+{
+    map<Stream*, IODispatchEntry>::iterator it = dispatchEntries.find(stream);
+    if ((it == dispatchEntries.end()) || (it->second.stopping_state != IO_RUNNING) ||
+        !it->second.readEnable || it->second.readInProgress) {
+        return false;
+    }
+
+    /* If the source event for a particular stream has been signalled,
+     * add a readAlarm to fire now, and set readInProgress to true.
+     */
+    int32_t when = 0;
+    AlarmListener* listener = this;
+    Alarm prevAlarm = it->second.readAlarm;
+    Alarm readAlarm = Alarm(when, listener, it->second.readCtxt);
+    it->second.readInProgress = true;
+    it->second.mainAddingRead = true;
+    UpdateStream(stream, it->second);
+    lock.Unlock();
+    /* Remove the read timeout alarm if any first */
+    timer.RemoveAlarm(prevAlarm, true);
+    lock.Lock();
+    it = dispatchEntries.find(stream);
+    if (it != dispatchEntries.end()) {
+        it->second.mainAddingRead = false;
+    }
+
+    QStatus status = ER_TIMER_FULL;
+    while (isRunning && status == ER_TIMER_FULL && it != dispatchEntries.end() && it->second.stopping_state == IO_RUNNING) {
+        /* Call the non-blocking version of AddAlarm, while holding the
+         * locks to ensure that the state of the dispatchEntry is valid.
+         */
+        status = timer.AddAlarmNonBlocking(readAlarm);
+
+        if (status == ER_TIMER_FULL) {
+            lock.Unlock();
+            qcc::Sleep(2);
+            lock.Lock();
+        }
+
+        it = dispatchEntries.find(stream);
+    }
+    if (status == ER_OK && it != dispatchEntries.end()) {
+        it->second.readAlarm = readAlarm;
+    }
+    return true;
+}
+
+bool IODispatch::SinkEventSignaled(Stream* stream)
+{
+    map<Stream*, IODispatchEntry>::iterator it = dispatchEntries.find(stream);
+    if ((it == dispatchEntries.end()) || (it->second.stopping_state != IO_RUNNING) ||
+        !it->second.writeEnable || it->second.writeInProgress) {
+        return false;
+    }
+
+    /* If the sink event for a particular stream has been signalled,
+     * add a writeAlarm to fire now, and set writeInProgress to true.
+     */
+    int32_t when = 0;
+    AlarmListener* listener = this;
+    Alarm prevAlarm = it->second.writeAlarm;
+    Alarm writeAlarm = Alarm(when, listener, it->second.writeCtxt);
+    it->second.writeInProgress = true;
+    it->second.mainAddingWrite = true;
+    UpdateStream(stream, it->second);
+    lock.Unlock();
+    /* Remove the write timeout alarm if any first */
+    timer.RemoveAlarm(prevAlarm, true);
+    lock.Lock();
+    it = dispatchEntries.find(stream);
+    if (it != dispatchEntries.end()) {
+        it->second.mainAddingWrite = false;
+    }
+
+    QStatus status = ER_TIMER_FULL;
+    while (isRunning && status == ER_TIMER_FULL && it != dispatchEntries.end() && it->second.stopping_state == IO_RUNNING) {
+        /* Call the non-blocking version of AddAlarm, while holding the
+         * locks to ensure that the state of the dispatchEntry is valid.
+         */
+        status = timer.AddAlarmNonBlocking(writeAlarm);
+
+        if (status == ER_TIMER_FULL) {
+            lock.Unlock();
+            qcc::Sleep(2);
+            lock.Lock();
+        }
+
+        it = dispatchEntries.find(stream);
+    }
+    if (status == ER_OK && it != dispatchEntries.end()) {
+        it->second.writeAlarm = writeAlarm;
+    }
+    return true;
+}
+
+void IODispatch::DispatchPollSet()
+{
+#ifdef IODISPATCH_EPOLL
+    struct epoll_event events[MAX_POLL_EVENTS];
+    int ret = epoll_wait(pollFd, events, MAX_POLL_EVENTS, 0);
+    if (ret < 0) {
+        if (errno != EINTR) {
+            QCC_LogError(ER_OS_ERROR, ("epoll_wait failed with %d (%s)", errno, strerror(errno)));
+        }
+        return;
+    }
+    lock.Lock();
+    for (int n = 0; (n < ret) && isRunning; ++n) {
+        /*
+         * The stream is looked up again so a stream that was stopped after
+         * epoll_wait returned is ignored.  Errors and hang-ups are reported
+         * to both callbacks so the endpoint finds out on its next read or
+         * write.
+         */
+        Stream* stream = static_cast<Stream*>(events[n].data.ptr);
+        if (events[n].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+            SourceEventSignaled(stream);
+        }
+        if (events[n].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) {
+            SinkEventSignaled(stream);
+        }
+    }
+    lock.Unlock();
+#endif
+}
+
 ThreadReturn STDCALL IODispatch::Run(void* arg) {
     QCC_UNUSED(arg);
 
@@ -408,15 +646,19 @@ ThreadReturn STDCALL IODispatch::Run(void* arg) {
         signaledEvents.clear();
         /* Add the Thread's stop event to list of events to check for */
         checkEvents.push_back(&stopEvent);
+        /* Streams in the poll set are all covered by the poll set's event */
+        if (pollEvent) {
+            checkEvents.push_back(pollEvent);
+        }
 
         /* Set reload to true to indicate that this thread is not in the Event::Wait and is
          * reloading the set of source and sink events
          */
         lock.Lock();
         reload = true;
-        map<Stream*, IODispatchEntry>::iterator it = dispatchEntries.begin();
-        while (it != dispatchEntries.end() && isRunning) {
-            if (it->second.stopping_state == IO_RUNNING) {
+        for (set<Stream*>::iterator sit = waitStreams.begin(); sit != waitStreams.end() && isRunning; ++sit) {
+            map<Stream*, IODispatchEntry>::iterator it = dispatchEntries.find(*sit);
+            if ((it != dispatchEntries.end()) && (it->second.stopping_state == IO_RUNNING)) {
                 /* Check this stream only if it has not been stopped */
                 if (it->second.readEnable && !it->second.readInProgress) {
                     /* If read is enabled and not in progress, add the source event for the stream to the
@@ -431,7 +673,6 @@ ThreadReturn STDCALL IODispatch::Run(void* arg) {
                     checkEvents.push_back(&it->first->GetSinkEvent());
                 }
             }
-            it++;
         }
         crit = true;
         lock.Unlock();
@@ -455,7 +696,7 @@ ThreadReturn STDCALL IODispatch::Run(void* arg) {
                 lock.Lock();
                 stopEvent.ResetEvent();
 
-                it = dispatchEntries.begin();
+                map<Stream*, IODispatchEntry>::iterator it = dispatchEntries.begin();
                 /* Add exit alarms for any streams that are being stopped.
                  * We dont need to keep track of the exit alarm, since we never remove
                  * the exit alarm. Hence it is not a part of IODispatchEntry.
@@ -489,97 +730,21 @@ ThreadReturn STDCALL IODispatch::Run(void* arg) {
                 }
                 lock.Unlock();
                 continue;
+            } else if (*i == pollEvent) {
+                DispatchPollSet();
             } else {
                 lock.Lock();
-                it = dispatchEntries.begin();
-                while (it != dispatchEntries.end()) {
-
-                    Stream* stream = it->first;
-
-                    if (it->second.stopping_state == IO_RUNNING) {
-                        if (&stream->GetSourceEvent() == *i) {
-
-                            if (it->second.readEnable && !it->second.readInProgress) {
-                                /* If the source event for a particular stream has been signalled,
-                                 * add a readAlarm to fire now, and set readInProgress to true.
-                                 */
-                                Alarm prevAlarm = it->second.readAlarm;
-                                Alarm readAlarm = Alarm(when, listener, it->second.readCtxt);
-                                it->second.readInProgress = true;
-                                it->second.mainAddingRead = true;
-                                lock.Unlock();
-                                /* Remove the read timeout alarm if any first */
-                                timer.RemoveAlarm(prevAlarm, true);
-                                lock.Lock();
-                                it = dispatchEntries.find(stream);
-                                if (it != dispatchEntries.end()) {
-                                    it->second.mainAddingRead = false;
-                                }
-
-                                QStatus status = ER_TIMER_FULL;
-                                while (isRunning && status == ER_TIMER_FULL && it != dispatchEntries.end() && it->second.stopping_state == IO_RUNNING) {
-                                    /* Call the non-blocking version of AddAlarm, while holding the
-                                     * locks to ensure that the state of the dispatchEntry is valid.
-                                     */
-                                    status = timer.AddAlarmNonBlocking(readAlarm);
-
-                                    if (status == ER_TIMER_FULL) {
-                                        lock.Unlock();
-                                        qcc::Sleep(2);
-                                        lock.Lock();
-                                    }
-
-                                    it = dispatchEntries.find(stream);
-                                }
-                                if (status == ER_OK && it != dispatchEntries.end()) {
-                                    it->second.readAlarm = readAlarm;
-                                }
-
-                                break;
-                            }
-
-                        } else if (&stream->GetSinkEvent() == *i) {
-                            if (it->second.writeEnable && !it->second.writeInProgress) {
-                                /* If the sink event for a particular stream has been signalled,
-                                 * add a writeAlarm to fire now, and set writeInProgress to true.
-                                 */
-                                Alarm prevAlarm = it->second.writeAlarm;
-                                Alarm writeAlarm = Alarm(when, listener, it->second.writeCtxt);
-                                it->second.writeInProgress = true;
-                                it->second.mainAddingWrite = true;
-                                lock.Unlock();
-                                /* Remove the write timeout alarm if any first */
-                                timer.RemoveAlarm(prevAlarm, true);
-                                lock.Lock();
-                                it = dispatchEntries.find(stream);
-                                if (it != dispatchEntries.end()) {
-                                    it->second.mainAddingWrite = false;
-                                }
-
-                                QStatus status = ER_TIMER_FULL;
-                                while (isRunning && status == ER_TIMER_FULL && it != dispatchEntries.end() && it->second.stopping_state == IO_RUNNING) {
-                                    /* Call the non-blocking version of AddAlarm, while holding the
-                                     * locks to ensure that the state of the dispatchEntry is valid.
-                                     */
-                                    status = timer.AddAlarmNonBlocking(writeAlarm);
-
-                                    if (status == ER_TIMER_FULL) {
-                                        lock.Unlock();
-                                        qcc::Sleep(2);
-                                        lock.Lock();
-                                    }
-
-                                    it = dispatchEntries.find(stream);
-                                }
-                                if (status == ER_OK && it != dispatchEntries.end()) {
-                                    it->second.writeAlarm = writeAlarm;
-                                }
-
-                                break;
-                            }
+                for (set<Stream*>::iterator sit = waitStreams.begin(); sit != waitStreams.end(); ++sit) {
+                    Stream* stream = *sit;
+                    if (&stream->GetSourceEvent() == *i) {
+                        if (SourceEventSignaled(stream)) {
+                            break;
+                        }
+                    } else if (&stream->GetSinkEvent() == *i) {
+                        if (SinkEventSignaled(stream)) {
+                            break;
                         }
                     }
-                    ++it;
                 }
                 lock.Unlock();
             }
@@ -646,10 +811,12 @@ QStatus IODispatch::EnableReadCallback(const Source* source, uint32_t timeout)
              * it was successful
              */
             it->second.readInProgress = false;
+            UpdateStream(lookup, it->second);
         }
     } else {
         /* Timeout = 0 indicates that no timeout alarm is required for this stream */
         it->second.readInProgress = false;
+        UpdateStream(lookup, it->second);
     }
     lock.Unlock();
 
@@ -740,12 +907,14 @@ QStatus IODispatch::DisableReadCallback(const Source* source)
         return ER_INVALID_STREAM;
     }
     it->second.readEnable = false;
+    UpdateStream(lookup, it->second);
+    bool pollRegistered = it->second.pollRegistered;
 
     Thread::Alert();
     /* Wait until the IODispatch::Run thread reloads the set of check events
      * since we are disabling read.
      */
-    while (!reload && crit && isRunning) {
+    while (!pollRegistered && !reload && crit && isRunning) {
         lock.Unlock();
         Sleep(10);
         lock.Lock();
@@ -790,6 +959,7 @@ QStatus IODispatch::EnableWriteCallbackNow(Sink* sink)
          * Do not block here, since it can create deadlocks.
          */
         it->second.writeInProgress = false;
+        UpdateStream(lookup, it->second);
         Thread::Alert();
     }
     lock.Unlock();
@@ -845,9 +1015,11 @@ QStatus IODispatch::EnableWriteCallback(Sink* sink, uint32_t timeout)
 
             dispatchEntriesIt->second.writeAlarm = writeAlarm;
             dispatchEntriesIt->second.writeInProgress = false;
+            UpdateStream(lookup, dispatchEntriesIt->second);
         }
     } else {
         it->second.writeInProgress = false;
+        UpdateStream(lookup, it->second);
     }
     lock.Unlock();
     Thread::Alert();
@@ -873,12 +1045,14 @@ QStatus IODispatch::DisableWriteCallback(const Sink* sink)
         return ER_INVALID_STREAM;
     }
     it->second.writeEnable = false;
+    UpdateStream(lookup, it->second);
+    bool pollRegistered = it->second.pollRegistered;
 
     Thread::Alert();
     /* Wait until the IODispatch::Run thread reloads the set of check events
      * since we are disabling write.
      */
-    while (!reload && crit && isRunning) {
+    while (!pollRegistered && !reload && crit && isRunning) {
         lock.Unlock();
         Sleep(10);
         lock.Lock();
@@ -36,6 +36,7 @@
 #ifdef CRYPTO_CNG
 #include <qcc/CngCache.h>
 #endif
+#include <qcc/CertificateCache.h>
 #include <qcc/Logger.h>
 #include <qcc/String.h>
 #include <qcc/Thread.h>
@@ -85,11 +86,13 @@ class StaticGlobals {
             Shutdown();
             return status;
         }
+        CertificateCache::Init();
         return ER_OK;
     }
 
     static QStatus Shutdown()
     {
+        CertificateCache::Shutdown();
         Crypto::Shutdown();
         Thread::StaticShutdown();
         LoggerSetting::Shutdown();
@@ -64,3 +64,9 @@ QStatus StringSource::PullBytes(void* buf, size_t reqBytes, size_t& actualBytes,
     return status;
 }
 
+QStatus StringSource::PeekBytes(const void*& buf, size_t& availBytes)
+{
+    buf = str.data() + outIdx;
+    availBytes = str.size() - outIdx;
+    return (0 < availBytes) ? ER_OK : ER_EOF;
+}
@@ -44,6 +44,8 @@
 #include <Status.h>
 #include <algorithm>
 
+#include "TimingWheel.h"
+
 #define QCC_MODULE  "TIMER"
 
 #define WORKER_IDLE_TIMEOUT_MS  20
@@ -110,8 +112,9 @@ class TimerImpl : public ThreadListener {
      * @param concurrency           Number of preallocated slots for threads which will process alarms.
      * @param prevenReentrancy      Prevent re-entrant call of AlarmTriggered.
      * @param maxAlarms             Maximum number of outstanding alarms allowed before blocking calls to AddAlarm or 0 for infinite.
+     * @param useTimingWheel        Keep pending alarms in a TimingWheel rather than an ordered set.
      */
-    TimerImpl(qcc::String name, bool expireOnExit, uint32_t concurrency, bool preventReentrancy, uint32_t maxAlarms);
+    TimerImpl(qcc::String name, bool expireOnExit, uint32_t concurrency, bool preventReentrancy, uint32_t maxAlarms, bool useTimingWheel);
 
     /**
      * Destructor.
@@ -273,8 +276,21 @@ class TimerImpl : public ThreadListener {
     /* Private assignment operator - does nothing */
     TimerImpl& operator=(const TimerImpl&);
 
+    /*
+     * Accessors for the pending alarms, which live either in the ordered set
+     * or in the timing wheel. Must be called with the timer lock held.
+     * InsertAlarm and EraseAlarm also maintain numLimitableAlarms.
+     */
+    bool AlarmsEmpty() const { return wheel ? wheel->Empty() : alarms.empty(); }
+    Alarm FrontAlarm() { return wheel ? wheel->Front() : *alarms.begin(); }
+    void InsertAlarm(const Alarm& alarm);
+    bool EraseAlarm(const Alarm& alarm);
+    bool ContainsAlarm(const Alarm& alarm) const;
+    bool FindListenerAlarm(const AlarmListener& listener, Alarm& alarm) const;
+
     mutable Mutex lock;
     std::set<Alarm, std::less<Alarm> >  alarms;
+    TimingWheel* wheel;                        /**< Used in place of alarms if non-NULL */
     Alarm* currentAlarm;
     bool expireOnExit;
     std::vector<TimerThread*> timerThreads;
@@ -292,8 +308,9 @@ class TimerImpl : public ThreadListener {
 
 }
 
-TimerImpl::TimerImpl(String name, bool expireOnExit, uint32_t concurrency, bool preventReentrancy, uint32_t maxAlarms) :
+TimerImpl::TimerImpl(String name, bool expireOnExit, uint32_t concurrency, bool preventReentrancy, uint32_t maxAlarms, bool useTimingWheel) :
     lock(LOCK_LEVEL_TIMERIMPL_LOCK),
+    wheel(useTimingWheel ? new TimingWheel() : NULL),
     currentAlarm(NULL),
     expireOnExit(expireOnExit),
     timerThreads(concurrency > 0 ? concurrency : 1),
@@ -319,6 +336,64 @@ TimerImpl::~TimerImpl()
             timerThreads[i] = NULL;
         }
     }
+    delete wheel;
+}
+
+void TimerImpl::InsertAlarm(const Alarm& alarm)
+{
+    if (wheel) {
+        wheel->Insert(alarm);
+    } else {
+        alarms.insert(alarm);
+    }
+    if (alarm->limitable) {
+        numLimitableAlarms++;
+    }
+}
+
+bool TimerImpl::EraseAlarm(const Alarm& alarm)
+{
+    bool found = false;
+    if (wheel) {
+        found = wheel->Erase(alarm);
+    } else {
+        set<Alarm>::iterator it = alarms.find(alarm);
+        if ((it == alarms.end()) && alarm->periodMs) {
+            /* Periodic alarms are matched by id alone */
+            for (it = alarms.begin(); it != alarms.end(); ++it) {
+                if ((*it)->id == alarm->id) {
+                    break;
+                }
+            }
+        }
+        if (it != alarms.end()) {
+            found = true;
+            alarms.erase(it);
+        }
+    }
+    if (found && alarm->limitable) {
+        numLimitableAlarms--;
+    }
+    return found;
+}
+
+bool TimerImpl::ContainsAlarm(const Alarm& alarm) const
+{
+    return wheel ? wheel->Contains(alarm) : (alarms.count(alarm) != 0);
+}
+
+bool TimerImpl::FindListenerAlarm(const AlarmListener& listener, Alarm& alarm) const
+{
+    if (wheel) {
+        return wheel->FindListener(&listener, alarm);
+    }
+    for (set<Alarm>::const_iterator it = alarms.begin(); it != alarms.end(); ++it) {
+        if ((*it)->listener == &listener) {
+            alarm = *it;
+            return true;
+        }
+    }
+    return false;
 }
 
 QStatus TimerImpl::Start()
@@ -423,11 +498,8 @@ QStatus TimerImpl::AddAlarm(const Alarm& alarm)
         /* Ensure timer is still running */
         if (isRunning) {
             /* Insert the alarm and alert the TimerImpl thread if necessary */
-            bool alertThread = alarms.empty() || (alarm < *alarms.begin());
-            alarms.insert(alarm);
-            if (alarm->limitable) {
-                numLimitableAlarms++;
-            }
+            bool alertThread = AlarmsEmpty() || (alarm < FrontAlarm());
+            InsertAlarm(alarm);
             if (alertThread && (controllerIdx >= 0)) {
                 TimerThread* tt = timerThreads[controllerIdx];
                 if (tt->state == TimerThread::IDLE) {
@@ -458,11 +530,8 @@ QStatus TimerImpl::AddAlarmNonBlocking(const Alarm& alarm)
         }
 
         /* Insert the alarm and alert the TimerImpl thread if necessary */
-        bool alertThread = alarms.empty() || (alarm < *alarms.begin());
-        alarms.insert(alarm);
-        if (alarm->limitable) {
-            numLimitableAlarms++;
-        }
+        bool alertThread = AlarmsEmpty() || (alarm < FrontAlarm());
+        InsertAlarm(alarm);
         if (alertThread && (controllerIdx >= 0)) {
             TimerThread* tt = timerThreads[controllerIdx];
             if (tt->state == TimerThread::IDLE) {
@@ -482,29 +551,7 @@ bool TimerImpl::RemoveAlarm(const Alarm& alarm, bool blockIfTriggered)
     bool foundAlarm = false;
     lock.Lock(MUTEX_CONTEXT);
     if (isRunning || expireOnExit) {
-        if (alarm->periodMs) {
-            set<Alarm>::iterator it = alarms.begin();
-            while (it != alarms.end()) {
-                if ((*it)->id == alarm->id) {
-                    foundAlarm = true;
-                    if ((*it)->limitable) {
-                        numLimitableAlarms--;
-                    }
-                    alarms.erase(it);
-                    break;
-                }
-                ++it;
-            }
-        } else {
-            set<Alarm>::iterator it = alarms.find(alarm);
-            if (it != alarms.end()) {
-                foundAlarm = true;
-                if ((*it)->limitable) {
-                    numLimitableAlarms--;
-                }
-                alarms.erase(it);
-            }
-        }
+        foundAlarm = EraseAlarm(alarm);
         if (blockIfTriggered && !foundAlarm) {
             /*
              * There might be a call in progress to the alarm that is being removed.
@@ -537,29 +584,7 @@ bool TimerImpl::ForceRemoveAlarm(const Alarm& alarm, bool blockIfTriggered)
     bool foundAlarm = false;
     lock.Lock(MUTEX_CONTEXT);
     if (isRunning || expireOnExit) {
-        if (alarm->periodMs) {
-            set<Alarm>::iterator it = alarms.begin();
-            while (it != alarms.end()) {
-                if ((*it)->id == alarm->id) {
-                    foundAlarm = true;
-                    if ((*it)->limitable) {
-                        numLimitableAlarms--;
-                    }
-                    alarms.erase(it);
-                    break;
-                }
-                ++it;
-            }
-        } else {
-            set<Alarm>::iterator it = alarms.find(alarm);
-            if (it != alarms.end()) {
-                foundAlarm = true;
-                if ((*it)->limitable) {
-                    numLimitableAlarms--;
-                }
-                alarms.erase(it);
-            }
-        }
+        foundAlarm = EraseAlarm(alarm);
         if (blockIfTriggered && !foundAlarm) {
             /*
              * There might be a call in progress to the alarm that is being removed.
@@ -593,12 +618,7 @@ QStatus TimerImpl::ReplaceAlarm(const Alarm& origAlarm, const Alarm& newAlarm, b
     QStatus status = ER_NO_SUCH_ALARM;
     lock.Lock(MUTEX_CONTEXT);
     if (isRunning) {
-        set<Alarm>::iterator it = alarms.find(origAlarm);
-        if (it != alarms.end()) {
-            if ((*it)->limitable) {
-                numLimitableAlarms--;
-            }
-            alarms.erase(it);
+        if (EraseAlarm(origAlarm)) {
             status = AddAlarm(newAlarm);
         } else if (blockIfTriggered) {
             /*
@@ -632,16 +652,9 @@ bool TimerImpl::RemoveAlarm(const AlarmListener& listener, Alarm& alarm)
     bool removedOne = false;
     lock.Lock(MUTEX_CONTEXT);
     if (isRunning || expireOnExit) {
-        for (set<Alarm>::iterator it = alarms.begin(); it != alarms.end(); ++it) {
-            if ((*it)->listener == &listener) {
-                alarm = *it;
-                if ((*it)->limitable) {
-                    numLimitableAlarms--;
-                }
-                alarms.erase(it);
-                removedOne = true;
-                break;
-            }
+        if (FindListenerAlarm(listener, alarm)) {
+            EraseAlarm(alarm);
+            removedOne = true;
         }
         /*
          * This function is most likely being called because the listener is about to be freed. If there
@@ -683,7 +696,7 @@ bool TimerImpl::HasAlarm(const Alarm& alarm) const
     bool ret = false;
     lock.Lock(MUTEX_CONTEXT);
     if (isRunning) {
-        ret = alarms.count(alarm) != 0;
+        ret = ContainsAlarm(alarm);
     }
     lock.Unlock(MUTEX_CONTEXT);
     return ret;
@@ -753,9 +766,9 @@ ThreadReturn STDCALL TimerThread::Run(void* arg)
          * Check for something to do, either now or at some (alarm) time in the
          * future.
          */
-        if (!timer->alarms.empty()) {
+        if (!timer->AlarmsEmpty()) {
             QCC_DbgPrintf(("TimerThread::Run(): Alarms pending"));
-            const Alarm topAlarm = *(timer->alarms.begin());
+            const Alarm topAlarm = timer->FrontAlarm();
             int64_t delay = topAlarm->alarmTime - now;
 
             /*
@@ -984,13 +997,8 @@ ThreadReturn STDCALL TimerThread::Run(void* arg)
                  * If it has already been serviced by another thread, just ignore
                  * and go back to the top of the loop.
                  */
-                set<Alarm>::iterator it = timer->alarms.find(topAlarm);
-                if (it != timer->alarms.end()) {
-                    Alarm top = *it;
-                    if (top->limitable) {
-                        timer->numLimitableAlarms--;
-                    }
-                    timer->alarms.erase(it);
+                if (timer->EraseAlarm(topAlarm)) {
+                    Alarm top = topAlarm;
                     currentAlarm = &top;
                     if (0 < timer->addWaitQueue.size()) {
                         Thread* wakeMe = timer->addWaitQueue.back();
@@ -1128,16 +1136,12 @@ void TimerImpl::ThreadExit(Thread* thread)
     lock.Lock(MUTEX_CONTEXT);
     if ((!isRunning) && expireOnExit) {
         /* Call all alarms */
-        while (!alarms.empty()) {
+        while (!AlarmsEmpty()) {
             /*
              * Note it is possible that the callback will call RemoveAlarm()
              */
-            set<Alarm>::iterator it = alarms.begin();
-            Alarm alarm = *it;
-            if (alarm->limitable) {
-                numLimitableAlarms--;
-            }
-            alarms.erase(it);
+            Alarm alarm = FrontAlarm();
+            EraseAlarm(alarm);
             tt->SetCurrentAlarm(&alarm);
             lock.Unlock(MUTEX_CONTEXT);
             tt->hasTimerLock = preventReentrancy;
@@ -1217,8 +1221,8 @@ bool TimerImpl::ThreadHoldsLock() const
     return false;
 }
 
-Timer::Timer(String name, bool expireOnExit, uint32_t concurrency, bool preventReentrancy, uint32_t maxAlarms) :
-    timerImpl(new TimerImpl(name, expireOnExit, concurrency, preventReentrancy, maxAlarms))
+Timer::Timer(String name, bool expireOnExit, uint32_t concurrency, bool preventReentrancy, uint32_t maxAlarms, bool useTimingWheel) :
+    timerImpl(new TimerImpl(name, expireOnExit, concurrency, preventReentrancy, maxAlarms, useTimingWheel))
 {
     /* Timer thread objects will be created when required */
 }
@@ -0,0 +1,247 @@
+/**
+ * @file
+ *
+ * Debug control
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#include <qcc/platform.h>
+
+#include <string.h>
+
+#include "TimingWheel.h"
+
+#define QCC_MODULE  "TIMER"
+
+using namespace std;
+using namespace qcc;
+
+/**
+ * Get an alarm time in milliseconds.  Returns false for times that do not fit
+ * in 64 bits of milliseconds; those always go to the overflow set.
+ */
+static inline bool GetAlarmMillis(const Timespec<MonotonicTime>& ts, uint64_t& millis)
+{
+    if (ts.seconds >= (static_cast<uint64_t>(-1) / 1000)) {
+        return false;
+    }
+    millis = ts.GetMillis();
+    return true;
+}
+
+TimingWheel::TimingWheel() : base(0)
+{
+    memset(occupied, 0, sizeof(occupied));
+}
+
+void TimingWheel::Insert(const Alarm& alarm)
+{
+    if (Contains(alarm)) {
+        return;
+    }
+    if (index.empty()) {
+        /* Start the wheel at the first alarm to keep the rest close to level 0 */
+        uint64_t millis;
+        if (GetAlarmMillis(alarm->alarmTime, millis)) {
+            base = millis;
+        }
+    }
+    Slot tmp;
+    tmp.push_back(alarm);
+    Place(tmp, tmp.begin(), index[alarm->id]);
+}
+
+bool TimingWheel::Erase(const Alarm& alarm)
+{
+    unordered_map<int32_t, Location>::iterator iit = index.find(alarm->id);
+    if (iit == index.end()) {
+        return false;
+    }
+    Location& loc = iit->second;
+    if (loc.level == OVERFLOW_LEVEL) {
+        overflow.erase(loc.ovIt);
+    } else {
+        Slot& slot = slots[loc.level][loc.slot];
+        slot.erase(loc.it);
+        if (slot.empty()) {
+            occupied[loc.level][loc.slot / 64] &= ~(static_cast<uint64_t>(1) << (loc.slot % 64));
+        }
+    }
+    index.erase(iit);
+    return true;
+}
+
+bool TimingWheel::Contains(const Alarm& alarm) const
+{
+    return index.find(alarm->id) != index.end();
+}
+
+const Alarm& TimingWheel::Front()
+{
+    QCC_ASSERT(!index.empty());
+    Advance();
+    const Slot& current = slots[0][base & SLOT_MASK];
+    if (!current.empty()) {
+        return current.front();
+    }
+    return *overflow.begin();
+}
+
+bool TimingWheel::FindListener(const AlarmListener* listener, Alarm& alarm) const
+{
+    for (unordered_map<int32_t, Location>::const_iterator iit = index.begin(); iit != index.end(); ++iit) {
+        const Location& loc = iit->second;
+        const Alarm& a = (loc.level == OVERFLOW_LEVEL) ? *loc.ovIt : *loc.it;
+        if (a->listener == listener) {
+            alarm = a;
+            return true;
+        }
+    }
+    return false;
+}
+
+void TimingWheel::Place(Slot& from, Slot::iterator it, Location& loc)
+{
+    uint64_t millis;
+    uint32_t level = OVERFLOW_LEVEL;
+    uint32_t slot = 0;
+    if (GetAlarmMillis((*it)->alarmTime, millis)) {
+        if (millis <= base) {
+            /* Already due: queue it in the current slot */
+            level = 0;
+            slot = base & SLOT_MASK;
+        } else {
+            uint64_t diff = millis ^ base;
+            level = 0;
+            while ((level < NUM_LEVELS) && ((diff >> (SLOT_BITS * (level + 1))) != 0)) {
+                ++level;
+            }
+            slot = (millis >> (SLOT_BITS * level)) & SLOT_MASK;
+        }
+    }
+
+    loc.level = level;
+    if (level == OVERFLOW_LEVEL) {
+        loc.ovIt = overflow.insert(*it).first;
+        from.erase(it);
+        return;
+    }
+
+    Slot& dest = slots[level][slot];
+    Slot::iterator pos = dest.end();
+    if (level == 0) {
+        /* Level 0 slots are kept sorted so that alarms with equal times fire in id order */
+        while (pos != dest.begin()) {
+            Slot::iterator prev = pos;
+            --prev;
+            if (!(*it < *prev)) {
+                break;
+            }
+            pos = prev;
+        }
+    }
+    dest.splice(pos, from, it);
+    loc.slot = slot;
+    loc.it = it;
+    occupied[level][slot / 64] |= static_cast<uint64_t>(1) << (slot % 64);
+}
+
+void TimingWheel::Advance()
+{
+    while (slots[0][base & SLOT_MASK].empty()) {
+        /*
+         * Find the earliest point at which something happens: either a level 0
+         * slot becoming due or a higher level slot needing to be cascaded.
+         */
+        bool found = false;
+        uint64_t next = 0;
+        for (uint32_t level = 0; level < NUM_LEVELS; ++level) {
+            uint32_t shift = SLOT_BITS * level;
+            uint32_t current = (base >> shift) & SLOT_MASK;
+            int slot = NextOccupied(level, (level == 0) ? current : current + 1);
+            if (slot >= 0) {
+                uint64_t when = ((base >> (shift + SLOT_BITS)) << (shift + SLOT_BITS)) | (static_cast<uint64_t>(slot) << shift);
+                if (!found || (when < next)) {
+                    next = when;
+                    found = true;
+                }
+            }
+        }
+
+        if (!found) {
+            /* The wheel is empty; pull the next batch of alarms in from the overflow set */
+            uint64_t millis;
+            if (overflow.empty() || !GetAlarmMillis((*overflow.begin())->alarmTime, millis)) {
+                return;
+            }
+            base = millis;
+            while (!overflow.empty() && GetAlarmMillis((*overflow.begin())->alarmTime, millis) &&
+                   (((millis ^ base) >> (SLOT_BITS * NUM_LEVELS)) == 0)) {
+                Slot tmp;
+                tmp.push_back(*overflow.begin());
+                overflow.erase(overflow.begin());
+                Place(tmp, tmp.begin(), index[tmp.front()->id]);
+            }
+            continue;
+        }
+
+        base = next;
+        for (uint32_t level = NUM_LEVELS - 1; level > 0; --level) {
+            uint32_t slot = (base >> (SLOT_BITS * level)) & SLOT_MASK;
+            if (occupied[level][slot / 64] & (static_cast<uint64_t>(1) << (slot % 64))) {
+                Slot cascade;
+                cascade.splice(cascade.end(), slots[level][slot]);
+                occupied[level][slot / 64] &= ~(static_cast<uint64_t>(1) << (slot % 64));
+                while (!cascade.empty()) {
+                    Place(cascade, cascade.begin(), index[cascade.front()->id]);
+                }
+            }
+        }
+    }
+}
+
+int TimingWheel::NextOccupied(uint32_t level, uint32_t start) const
+{
+    for (uint32_t word = start / 64; word < (NUM_SLOTS / 64); ++word) {
+        uint64_t bits = occupied[level][word];
+        if (word == (start / 64)) {
+            bits &= ~static_cast<uint64_t>(0) << (start % 64);
+        }
+        if (bits != 0) {
+            uint32_t bit = 0;
+            while ((bits & 1) == 0) {
+                bits >>= 1;
+                ++bit;
+            }
+            return static_cast<int>(word * 64 + bit);
+        }
+    }
+    return -1;
+}
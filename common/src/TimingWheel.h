@@ -0,0 +1,167 @@
+/**
+ * @file
+ *
+ * Debug control
+ */
+
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+#ifndef _QCC_TIMINGWHEEL_H
+#define _QCC_TIMINGWHEEL_H
+
+#include <qcc/platform.h>
+#include <qcc/Alarm.h>
+#include <qcc/STLContainer.h>
+
+#include <list>
+#include <set>
+
+namespace qcc {
+
+/**
+ * Hierarchical timing wheel holding the pending alarms of a TimerImpl.
+ *
+ * Alarms are bucketed by the bits in which their expiry time (in ms) differs
+ * from the time of the wheel's earliest bucket: level 0 has 1 ms slots, each
+ * higher level has slots 256 times wider.  Insertion and removal are O(1);
+ * buckets of a higher level are cascaded into the lower levels as the wheel
+ * advances.  Alarms that expire more than ~49 days past the earliest bucket
+ * (including alarms that never expire) are kept in an ordered overflow set.
+ *
+ * Front() returns the same alarm that the first element of a
+ * std::set<Alarm> holding the same alarms would, so alarms are dispatched in
+ * exactly the same (alarm time, alarm id) order.
+ *
+ * TimingWheel does not do any locking; callers must serialize access.
+ */
+class TimingWheel {
+  public:
+
+    TimingWheel();
+
+    /**
+     * Test if the wheel holds no alarms.
+     *
+     * @return  true iff there are no alarms in the wheel.
+     */
+    bool Empty() const { return index.empty(); }
+
+    /**
+     * Add an alarm to the wheel.
+     *
+     * @param alarm  Alarm to add.
+     */
+    void Insert(const Alarm& alarm);
+
+    /**
+     * Remove an alarm from the wheel.
+     *
+     * @param alarm  Alarm to remove.
+     *
+     * @return  true iff the alarm was found and removed.
+     */
+    bool Erase(const Alarm& alarm);
+
+    /**
+     * Test if an alarm is in the wheel.
+     *
+     * @param alarm  Alarm to look for.
+     *
+     * @return  true iff the alarm is in the wheel.
+     */
+    bool Contains(const Alarm& alarm) const;
+
+    /**
+     * Get the alarm that is due first.  Must not be called on an empty wheel.
+     *
+     * @return  The earliest alarm.
+     */
+    const Alarm& Front();
+
+    /**
+     * Find an alarm for a specific listener.
+     *
+     * @param listener  The listener to look for.
+     * @param[out] alarm  An alarm with that listener if one was found.
+     *
+     * @return  true iff an alarm for the listener was found.
+     */
+    bool FindListener(const AlarmListener* listener, Alarm& alarm) const;
+
+  private:
+
+    static const uint32_t SLOT_BITS = 8;
+    static const uint32_t NUM_SLOTS = 1 << SLOT_BITS;
+    static const uint32_t SLOT_MASK = NUM_SLOTS - 1;
+    static const uint32_t NUM_LEVELS = 4;
+    static const uint32_t OVERFLOW_LEVEL = NUM_LEVELS;
+
+    typedef std::list<Alarm> Slot;
+
+    /** Where an alarm currently lives in the wheel */
+    struct Location {
+        uint32_t level;                         /**< Wheel level or OVERFLOW_LEVEL */
+        uint32_t slot;                          /**< Slot within the level */
+        Slot::iterator it;                      /**< Position within the slot */
+        std::set<Alarm>::iterator ovIt;         /**< Position within the overflow set */
+    };
+
+    /* Private copy constructor and assignment operator - do nothing */
+    TimingWheel(const TimingWheel&);
+    TimingWheel& operator=(const TimingWheel&);
+
+    /**
+     * Move the alarm at 'it' out of 'from' into the wheel position matching
+     * its alarm time relative to the current base.
+     */
+    void Place(Slot& from, Slot::iterator it, Location& loc);
+
+    /**
+     * Advance the base to the earliest non-empty level 0 slot, cascading
+     * higher level slots and refilling from the overflow set as needed.
+     */
+    void Advance();
+
+    /**
+     * Find the first occupied slot at or after 'start' in a level.
+     *
+     * @return  The slot index or -1 if there is none.
+     */
+    int NextOccupied(uint32_t level, uint32_t start) const;
+
+    Slot slots[NUM_LEVELS][NUM_SLOTS];
+    uint64_t occupied[NUM_LEVELS][NUM_SLOTS / 64];    /**< Bitmap of non-empty slots per level */
+    std::set<Alarm> overflow;                         /**< Alarms too far out for the wheel */
+    std::unordered_map<int32_t, Location> index;      /**< Alarm id to wheel location */
+    uint64_t base;                                    /**< Time (ms) of the current level 0 slot */
+};
+
+}
+
+#endif
@@ -34,6 +34,7 @@
  ******************************************************************************/
 #include <qcc/platform.h>
 
+#include <cstring>
 #include <map>
 #include <stack>
 #include <vector>
@@ -129,6 +130,10 @@ qcc::String AJ_CALL XmlElement::EscapeXml(const qcc::String& str) {
 }
 
 qcc::String AJ_CALL XmlElement::UnescapeXml(const qcc::String& str) {
+    /* Most content and attribute values contain no escapes at all */
+    if (str.find_first_of('&') == qcc::String::npos) {
+        return str;
+    }
     bool inEsc = false;
     qcc::String outStr;
     qcc::String escName;
@@ -190,6 +195,54 @@ qcc::String AJ_CALL XmlElement::UnescapeXml(const qcc::String& str) {
     return outStr;
 }
 
+/* Size of the read-ahead buffer used for sources without direct access */
+#define XML_READ_BLOCK_SIZE 4096
+
+/* Append a run of characters without the copy returned by qcc::String::append() */
+static inline void AppendRun(qcc::String& str, const char* run, size_t len)
+{
+    static_cast<std::string&>(str).append(run, len);
+}
+
+QStatus XmlElement::FillBlock(XmlParseContext& ctx)
+{
+    if (0 < ctx.blockLen) {
+        return ER_OK;
+    }
+    const void* peeked = NULL;
+    size_t availBytes = 0;
+    QStatus status = ctx.source.PeekBytes(peeked, availBytes);
+    if (ER_NOT_IMPLEMENTED != status) {
+        ctx.inPlace = true;
+        ctx.block = static_cast<const char*>(peeked);
+        ctx.blockLen = (ER_OK == status) ? availBytes : 0;
+        return status;
+    }
+    if (!ctx.readBuf) {
+        ctx.readBuf = new char[XML_READ_BLOCK_SIZE];
+    }
+    size_t actual = 0;
+    status = ctx.source.PullBytes(ctx.readBuf, XML_READ_BLOCK_SIZE, actual);
+    ctx.inPlace = false;
+    ctx.block = ctx.readBuf;
+    ctx.blockLen = (ER_OK == status) ? actual : 0;
+    return status;
+}
+
+void XmlElement::ConsumeBlock(XmlParseContext& ctx, size_t numBytes)
+{
+    QCC_ASSERT(numBytes <= ctx.blockLen);
+    if (ctx.inPlace) {
+        /* Only consume what was parsed so the source is left positioned after the document */
+        ctx.source.ConsumeBytes(numBytes);
+        ctx.block = NULL;
+        ctx.blockLen = 0;
+    } else {
+        ctx.block += numBytes;
+        ctx.blockLen -= numBytes;
+    }
+}
+
 /* Finalize and return true if element ends the root Xml element */
 void XmlElement::FinalizeElement(XmlParseContext& ctx)
 {
@@ -236,179 +289,153 @@ QStatus AJ_CALL XmlElement::Parse(XmlParseContext& ctx)
     QStatus status = ER_OK;
 
     while (!done) {
-        char c;
-        size_t actual;
-
-        status = ctx.source.PullBytes((void*)&c, 1, actual);
-        if ((ER_OK != status) || (1 != actual)) {
+        status = FillBlock(ctx);
+        if ((ER_OK != status) || (0 == ctx.blockLen)) {
             break;
         }
 
-        switch (ctx.parseState) {
-        case XmlParseContext::IN_ELEMENT:
-            if ('<' == c) {
-                ctx.parseState = XmlParseContext::IN_ELEMENT_START;
-                ctx.elemName.clear();
-                ctx.isEndTag = false;
-            } else {
-                ctx.rawContent.push_back(c);
-            }
-            break;
+        const char* p = ctx.block;
+        const char* end = p + ctx.blockLen;
+        while (!done && (p < end)) {
+            const char c = *p++;
 
-        case XmlParseContext::IN_SKIP:
-            if ('-' == c) {
-                if (ctx.foundHyphen) {
-                    ctx.parseState = XmlParseContext::IN_SKIP_START;
-                    ctx.foundHyphen = false;
-                    ctx.isDoctype = false;
-                } else {
-                    ctx.foundHyphen = true;
-                }
-            } else if (IsWhite(c) || (c == '>')) {
-                if (ctx.doctypeStr == "DOCTYPE") {
-                    ctx.isDoctype = true;
-                    ctx.doctypeStr = "";
-                    ctx.parseState = XmlParseContext::IN_SKIP_START;
+            switch (ctx.parseState) {
+            case XmlParseContext::IN_ELEMENT:
+                if ('<' == c) {
+                    ctx.parseState = XmlParseContext::IN_ELEMENT_START;
+                    ctx.elemName.clear();
+                    ctx.isEndTag = false;
                 } else {
-                    return ER_XML_MALFORMED;
+                    /* Take the whole run of content up to the next tag */
+                    const char* lt = static_cast<const char*>(memchr(p, '<', end - p));
+                    const char* runEnd = lt ? lt : end;
+                    AppendRun(ctx.rawContent, p - 1, runEnd - p + 1);
+                    p = runEnd;
                 }
-            } else {
-                ctx.doctypeStr += c;
-            }
-            break;
+                break;
 
-        case XmlParseContext::IN_SKIP_START:
-            if (ctx.isTextDecleration) {
-                if (c == '?') {
-                    ctx.foundTxtDeclDelim = true;
-                } else if (c == '>') {
-                    if (ctx.foundTxtDeclDelim) {
-                        ctx.parseState = XmlParseContext::IN_ELEMENT;
-                        ctx.isTextDecleration = false;
+            case XmlParseContext::IN_SKIP:
+                if ('-' == c) {
+                    if (ctx.foundHyphen) {
+                        ctx.parseState = XmlParseContext::IN_SKIP_START;
+                        ctx.foundHyphen = false;
+                        ctx.isDoctype = false;
+                    } else {
+                        ctx.foundHyphen = true;
+                    }
+                } else if (IsWhite(c) || (c == '>')) {
+                    if (ctx.doctypeStr == "DOCTYPE") {
+                        ctx.isDoctype = true;
+                        ctx.doctypeStr = "";
+                        ctx.parseState = XmlParseContext::IN_SKIP_START;
                     } else {
                         return ER_XML_MALFORMED;
                     }
+                } else {
+                    ctx.doctypeStr += c;
                 }
-            } else if (ctx.isDoctype) {
-                if ('>' == c) {
-                    ctx.parseState = XmlParseContext::IN_ELEMENT;
-                    ctx.isDoctype = false;
-                }
-            } else {
-                if (c == '-') {
-                    if (ctx.foundHyphen) {
-                        ctx.isCommentDelim = true;
-                    } else {
-                        ctx.foundHyphen = true;
+                break;
+
+            case XmlParseContext::IN_SKIP_START:
+                if (ctx.isTextDecleration) {
+                    if (c == '?') {
+                        ctx.foundTxtDeclDelim = true;
+                    } else if (c == '>') {
+                        if (ctx.foundTxtDeclDelim) {
+                            ctx.parseState = XmlParseContext::IN_ELEMENT;
+                            ctx.isTextDecleration = false;
+                        } else {
+                            return ER_XML_MALFORMED;
+                        }
                     }
-                } else if (ctx.isCommentDelim) {
-                    if (c == '>') {
+                } else if (ctx.isDoctype) {
+                    if ('>' == c) {
                         ctx.parseState = XmlParseContext::IN_ELEMENT;
-                        ctx.isCommentDelim = false;
-                        ctx.foundHyphen = false;
+                        ctx.isDoctype = false;
+                    }
+                } else {
+                    if (c == '-') {
+                        if (ctx.foundHyphen) {
+                            ctx.isCommentDelim = true;
+                        } else {
+                            ctx.foundHyphen = true;
+                        }
+                    } else if (ctx.isCommentDelim) {
+                        if (c == '>') {
+                            ctx.parseState = XmlParseContext::IN_ELEMENT;
+                            ctx.isCommentDelim = false;
+                            ctx.foundHyphen = false;
+                        } else {
+                            ctx.isCommentDelim = false;
+                            ctx.foundHyphen = false;
+                        }
                     } else {
-                        ctx.isCommentDelim = false;
                         ctx.foundHyphen = false;
                     }
-                } else {
-                    ctx.foundHyphen = false;
-                }
-            }
-            break;
-
-        case XmlParseContext::IN_ELEMENT_START:
-            if (ctx.elemName.empty() && !ctx.isEndTag) {
-                if ('/' == c) {
-                    ctx.isEndTag = true;
-                } else if ('!' == c) {
-                    ctx.parseState = XmlParseContext::IN_SKIP;
-                } else if ('?' == c) {
-                    ctx.parseState = XmlParseContext::IN_SKIP_START;
-                    ctx.isTextDecleration = true;
-                } else if (!IsWhite(c)) {
-                    ctx.isEndTag = false;
-                    ctx.elemName.push_back(c);
                 }
-            } else {
-                if (IsWhite(c) || ('>' == c)) {
-                    if (!ctx.isEndTag) {
+                break;
+
+            case XmlParseContext::IN_ELEMENT_START:
+                if (ctx.elemName.empty() && !ctx.isEndTag) {
+                    if ('/' == c) {
+                        ctx.isEndTag = true;
+                    } else if ('!' == c) {
+                        ctx.parseState = XmlParseContext::IN_SKIP;
+                    } else if ('?' == c) {
+                        ctx.parseState = XmlParseContext::IN_SKIP_START;
+                        ctx.isTextDecleration = true;
+                    } else if (!IsWhite(c)) {
+                        ctx.isEndTag = false;
+                        ctx.elemName.push_back(c);
+                    }
+                } else {
+                    if (IsWhite(c) || ('>' == c)) {
+                        if (!ctx.isEndTag) {
+                            if (!ctx.curElem) {
+                                ctx.curElem = ctx.root;
+                                ctx.curElem->SetName(ctx.elemName);
+                            } else {
+                                ctx.curElem = ctx.curElem->CreateChild(ctx.elemName);
+                            }
+                        } else {
+                            FinalizeElement(ctx);
+                            done = (NULL == ctx.curElem);
+                        }
+                        ctx.parseState = ('>' == c) ? XmlParseContext::IN_ELEMENT : XmlParseContext::IN_ATTR_NAME;
+                        ctx.attrName.clear();
+                        ctx.attrValue.clear();
+                        ctx.rawContent.clear();
+                    } else if ('/' == c) {
                         if (!ctx.curElem) {
                             ctx.curElem = ctx.root;
                             ctx.curElem->SetName(ctx.elemName);
                         } else {
                             ctx.curElem = ctx.curElem->CreateChild(ctx.elemName);
                         }
+                        ctx.isEndTag = true;
                     } else {
-                        FinalizeElement(ctx);
-                        done = (NULL == ctx.curElem);
-                    }
-                    ctx.parseState = ('>' == c) ? XmlParseContext::IN_ELEMENT : XmlParseContext::IN_ATTR_NAME;
-                    ctx.attrName.clear();
-                    ctx.attrValue.clear();
-                    ctx.rawContent.clear();
-                } else if ('/' == c) {
-                    if (!ctx.curElem) {
-                        ctx.curElem = ctx.root;
-                        ctx.curElem->SetName(ctx.elemName);
-                    } else {
-                        ctx.curElem = ctx.curElem->CreateChild(ctx.elemName);
+                        const char* runEnd = p;
+                        while ((runEnd < end) && !IsWhite(*runEnd) && ('>' != *runEnd) && ('/' != *runEnd)) {
+                            ++runEnd;
+                        }
+                        AppendRun(ctx.elemName, p - 1, runEnd - p + 1);
+                        p = runEnd;
                     }
-                    ctx.isEndTag = true;
-                } else {
-                    ctx.elemName.push_back(c);
-                }
-            }
-            break;
-
-        case XmlParseContext::IN_ATTR_NAME:
-            if (IsWhite(c)) {
-                continue;
-            } else if ('/' == c) {
-                ctx.isEndTag = true;
-            } else if (!ctx.attrName.empty() && ('=' == c)) {
-                ctx.parseState = XmlParseContext::IN_ATTR_VALUE;
-                ctx.attrInQuote = false;
-            } else if ('>' == c) {
-                if (!ctx.attrName.empty()) {
-                    ctx.curElem->AddAttribute(ctx.attrName, ctx.attrValue);
                 }
-                if (ctx.isEndTag) {
-                    FinalizeElement(ctx);
-                    done = (NULL == ctx.curElem);
-                }
-                ctx.parseState = XmlParseContext::IN_ELEMENT;
-            } else {
-                ctx.isEndTag = false;
-                ctx.attrName.push_back(c);
-            }
-            break;
+                break;
 
-        case XmlParseContext::IN_ATTR_VALUE:
-            if (ctx.attrInQuote) {
-                if (ctx.quoteChar == c) {
-                    ctx.curElem->AddAttribute(ctx.attrName, UnescapeXml(ctx.attrValue));
-                    ctx.parseState = XmlParseContext::IN_ATTR_NAME;
-                    ctx.attrName.clear();
-                    ctx.attrValue.clear();
-                } else {
-                    ctx.attrValue.push_back(c);
-                }
-            } else {
+            case XmlParseContext::IN_ATTR_NAME:
                 if (IsWhite(c)) {
                     continue;
-                } else if ('"' == c) {
-                    ctx.attrInQuote = true;
-                    ctx.quoteChar = '"';
-                } else if ('\'' == c) {
-                    ctx.attrInQuote = true;
-                    ctx.quoteChar = '\'';
                 } else if ('/' == c) {
                     ctx.isEndTag = true;
+                } else if (!ctx.attrName.empty() && ('=' == c)) {
+                    ctx.parseState = XmlParseContext::IN_ATTR_VALUE;
+                    ctx.attrInQuote = false;
                 } else if ('>' == c) {
-                    // Ignore malformed attribute
-                    QCC_DbgPrintf(("Ignoring malformed XML attribute \"%s\"", ctx.attrName.c_str()));
-
-                    // End current element if necessary
+                    if (!ctx.attrName.empty()) {
+                        ctx.curElem->AddAttribute(ctx.attrName, ctx.attrValue);
+                    }
                     if (ctx.isEndTag) {
                         FinalizeElement(ctx);
                         done = (NULL == ctx.curElem);
@@ -416,13 +443,55 @@ QStatus AJ_CALL XmlElement::Parse(XmlParseContext& ctx)
                     ctx.parseState = XmlParseContext::IN_ELEMENT;
                 } else {
                     ctx.isEndTag = false;
+                    ctx.attrName.push_back(c);
                 }
-            }
-            break;
+                break;
+
+            case XmlParseContext::IN_ATTR_VALUE:
+                if (ctx.attrInQuote) {
+                    if (ctx.quoteChar == c) {
+                        ctx.curElem->AddAttribute(ctx.attrName, UnescapeXml(ctx.attrValue));
+                        ctx.parseState = XmlParseContext::IN_ATTR_NAME;
+                        ctx.attrName.clear();
+                        ctx.attrValue.clear();
+                    } else {
+                        const char* quote = static_cast<const char*>(memchr(p, ctx.quoteChar, end - p));
+                        const char* runEnd = quote ? quote : end;
+                        AppendRun(ctx.attrValue, p - 1, runEnd - p + 1);
+                        p = runEnd;
+                    }
+                } else {
+                    if (IsWhite(c)) {
+                        continue;
+                    } else if ('"' == c) {
+                        ctx.attrInQuote = true;
+                        ctx.quoteChar = '"';
+                    } else if ('\'' == c) {
+                        ctx.attrInQuote = true;
+                        ctx.quoteChar = '\'';
+                    } else if ('/' == c) {
+                        ctx.isEndTag = true;
+                    } else if ('>' == c) {
+                        // Ignore malformed attribute
+                        QCC_DbgPrintf(("Ignoring malformed XML attribute \"%s\"", ctx.attrName.c_str()));
+
+                        // End current element if necessary
+                        if (ctx.isEndTag) {
+                            FinalizeElement(ctx);
+                            done = (NULL == ctx.curElem);
+                        }
+                        ctx.parseState = XmlParseContext::IN_ELEMENT;
+                    } else {
+                        ctx.isEndTag = false;
+                    }
+                }
+                break;
 
-        case XmlParseContext::PARSE_COMPLETE:
-            break;
+            case XmlParseContext::PARSE_COMPLETE:
+                break;
+            }
         }
+        ConsumeBlock(ctx, p - ctx.block);
     }
 
     if (ER_OK == status) {
@@ -46,6 +46,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace qcc;
 using namespace std;
 
@@ -335,3 +337,108 @@ TEST(AES_CCMTest, AES_CCM_Test_Vecter) {
         //printf("Passed and verified test #%d\n", static_cast<int>(i + 1));
     }
 }
+
+/*
+ * Straightforward RFC 3610 CCM built from single block encryptions, used to check every payload
+ * length against the streamed implementation.
+ */
+static void ReferenceCCM(const KeyBlob& key, const uint8_t* nonce, size_t nLen, const uint8_t* aad, size_t aadLen,
+                         const uint8_t* msg, size_t mLen, uint8_t authLen, vector<uint8_t>& out)
+{
+    Crypto_AES ecb(key, Crypto_AES::ECB_ENCRYPT);
+    const size_t L = 15 - nLen;
+    vector<uint8_t> b(16, 0);
+    b[0] = (aadLen ? 0x40 : 0) | (((authLen - 2) / 2) << 3) | (L - 1);
+    memcpy(&b[1], nonce, nLen);
+    for (size_t i = 0; i < L; ++i) {
+        b[15 - i] = static_cast<uint8_t>(mLen >> (8 * i));
+    }
+    if (aadLen) {
+        b.push_back(static_cast<uint8_t>(aadLen >> 8));
+        b.push_back(static_cast<uint8_t>(aadLen));
+        b.insert(b.end(), aad, aad + aadLen);
+        b.resize((b.size() + 15) & ~15, 0);
+    }
+    b.insert(b.end(), msg, msg + mLen);
+    b.resize((b.size() + 15) & ~15, 0);
+
+    Crypto_AES::Block x(0);
+    for (size_t i = 0; i < b.size(); i += 16) {
+        for (size_t j = 0; j < 16; ++j) {
+            x.data[j] ^= b[i + j];
+        }
+        ASSERT_EQ(ER_OK, ecb.Encrypt(&x, &x, 1));
+    }
+
+    out.assign(msg, msg + mLen);
+    Crypto_AES::Block a(0);
+    a.data[0] = static_cast<uint8_t>(L - 1);
+    memcpy(&a.data[1], nonce, nLen);
+    Crypto_AES::Block s;
+    for (size_t i = 0; i <= (mLen + 15) / 16; ++i) {
+        a.data[15] = static_cast<uint8_t>(i);
+        a.data[14] = static_cast<uint8_t>(i >> 8);
+        ASSERT_EQ(ER_OK, ecb.Encrypt(&a, &s, 1));
+        if (i == 0) {
+            for (size_t j = 0; j < authLen; ++j) {
+                x.data[j] ^= s.data[j];
+            }
+        } else {
+            for (size_t j = 0; (j < 16) && ((i - 1) * 16 + j < mLen); ++j) {
+                out[(i - 1) * 16 + j] ^= s.data[j];
+            }
+        }
+    }
+    out.insert(out.end(), x.data, x.data + authLen);
+}
+
+TEST(AES_CCMTest, AES_CCM_All_Lengths) {
+    uint8_t key[16];
+    uint8_t nonce[13];
+    uint8_t aad[40];
+    uint8_t msg[300];
+    for (size_t i = 0; i < sizeof(key); ++i) {
+        key[i] = static_cast<uint8_t>(0xC0 + i);
+    }
+    for (size_t i = 0; i < sizeof(nonce); ++i) {
+        nonce[i] = static_cast<uint8_t>(0x30 + i);
+    }
+    for (size_t i = 0; i < sizeof(aad); ++i) {
+        aad[i] = static_cast<uint8_t>(i * 7);
+    }
+    for (size_t i = 0; i < sizeof(msg); ++i) {
+        msg[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+    KeyBlob kb(key, sizeof(key), KeyBlob::AES);
+    KeyBlob nb(nonce, sizeof(nonce), KeyBlob::GENERIC);
+    Crypto_AES aes(kb, Crypto_AES::CCM);
+    const size_t aadLens[] = { 0, 7, 14, 33 };
+    const uint8_t authLens[] = { 8, 16 };
+
+    for (size_t a = 0; a < ArraySize(aadLens); ++a) {
+        for (size_t m = 0; m < ArraySize(authLens); ++m) {
+            for (size_t mLen = 0; mLen <= sizeof(msg) - 16; ++mLen) {
+                vector<uint8_t> expected;
+                ReferenceCCM(kb, nonce, sizeof(nonce), aad, aadLens[a], msg, mLen, authLens[m], expected);
+
+                uint8_t buf[sizeof(msg)];
+                memcpy(buf, msg, mLen);
+                size_t len = mLen;
+                ASSERT_EQ(ER_OK, aes.Encrypt_CCM(buf, buf, len, nb, aad, aadLens[a], authLens[m]));
+                ASSERT_EQ(expected.size(), len);
+                ASSERT_EQ(0, memcmp(&expected[0], buf, len)) << "aadLen " << aadLens[a] << " mLen " << mLen;
+
+                ASSERT_EQ(ER_OK, aes.Decrypt_CCM(buf, buf, len, nb, aad, aadLens[a], authLens[m]));
+                ASSERT_EQ(mLen, len);
+                ASSERT_EQ(0, memcmp(msg, buf, mLen));
+
+                if (mLen) {
+                    memcpy(buf, &expected[0], expected.size());
+                    buf[mLen - 1] ^= 1;
+                    len = expected.size();
+                    EXPECT_EQ(ER_AUTH_FAIL, aes.Decrypt_CCM(buf, buf, len, nb, aad, aadLens[a], authLens[m]));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/******************************************************************************
+ *    Copyright (c) Open Connectivity Foundation (OCF), AllJoyn Open Source
+ *    Project (AJOSP) Contributors and others.
+ *
+ *    SPDX-License-Identifier: Apache-2.0
+ *
+ *    All rights reserved. This program and the accompanying materials are
+ *    made available under the terms of the Apache License, Version 2.0
+ *    which accompanies this distribution, and is available at
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Copyright (c) Open Connectivity Foundation and Contributors to AllSeen
+ *    Alliance. All rights reserved.
+ *
+ *    Permission to use, copy, modify, and/or distribute this software for
+ *    any purpose with or without fee is hereby granted, provided that the
+ *    above copyright notice and this permission notice appear in all
+ *    copies.
+ *
+ *    THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ *    WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ *    WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ *    AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ *    DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ *    PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER
+ *    TORTIOUS ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR
+ *    PERFORMANCE OF THIS SOFTWARE.
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <qcc/CertificateCache.h>
+#include <qcc/CertificateECC.h>
+#include <qcc/Crypto.h>
+#include <qcc/GUID.h>
+#include <qcc/StringUtil.h>
+#include <qcc/time.h>
+
+using namespace qcc;
+
+class CertificateCacheTest : public testing::Test {
+  public:
+    virtual void SetUp()
+    {
+        CertificateCache::SetCapacity(CertificateCache::DEFAULT_CAPACITY);
+        CertificateCache::Clear();
+        ASSERT_EQ(ER_OK, issuer.GenerateDSAKeyPair());
+        ASSERT_EQ(ER_OK, subject.GenerateDSAKeyPair());
+    }
+
+    virtual void TearDown()
+    {
+        CertificateCache::SetCapacity(CertificateCache::DEFAULT_CAPACITY);
+        CertificateCache::Clear();
+    }
+
+    void CreateCert(const qcc::String& serial, CertificateX509& cert)
+    {
+        qcc::GUID128 issuerGuid;
+        qcc::GUID128 subjectGuid;
+        CertificateX509::ValidPeriod validity;
+        validity.validFrom = qcc::GetEpochTimestamp() / 1000;
+        validity.validTo = validity.validFrom + 3600;
+        cert.SetSerial((const uint8_t*) serial.data(), serial.size());
+        cert.SetIssuerCN(issuerGuid.GetBytes(), qcc::GUID128::SIZE);
+        cert.SetSubjectCN(subjectGuid.GetBytes(), qcc::GUID128::SIZE);
+        cert.SetSubjectPublicKey(subject.GetDSAPublicKey());
+        cert.SetValidity(&validity);
+        ASSERT_EQ(ER_OK, cert.SignAndGenerateAuthorityKeyId(issuer.GetDSAPrivateKey(), issuer.GetDSAPublicKey()));
+    }
+
+    Crypto_ECC issuer;
+    Crypto_ECC subject;
+};
+
+TEST_F(CertificateCacheTest, DecodeReusesCachedCertificate)
+{
+    CertificateX509 cert;
+    CreateCert("1010101", cert);
+    qcc::String der;
+    ASSERT_EQ(ER_OK, cert.EncodeCertificateDER(der));
+
+    CertificateX509 first;
+    ASSERT_EQ(ER_OK, CertificateCache::DecodeCertificateDER(der, first));
+    EXPECT_EQ((size_t) 1, CertificateCache::GetSize());
+    CertificateX509 second;
+    ASSERT_EQ(ER_OK, CertificateCache::DecodeCertificateDER(der, second));
+    EXPECT_EQ((size_t) 1, CertificateCache::GetSize());
+
+    qcc::String der1, der2;
+    ASSERT_EQ(ER_OK, first.EncodeCertificateDER(der1));
+    ASSERT_EQ(ER_OK, second.EncodeCertificateDER(der2));
+    EXPECT_EQ(der, der1);
+    EXPECT_EQ(der, der2);
+    EXPECT_EQ(*subject.GetDSAPublicKey(), *second.GetSubjectPublicKey());
+    EXPECT_EQ(ER_OK, second.Verify(issuer.GetDSAPublicKey()));
+
+    /* The EKUs in the encoding decide the type, whatever the target was constructed with. */
+    MembershipCertificate membership;
+    ASSERT_EQ(ER_OK, CertificateCache::DecodeCertificateDER(der, membership));
+    EXPECT_EQ(first.GetType(), membership.GetType());
+
+    EXPECT_NE(ER_OK, CertificateCache::DecodeCertificateDER(der.substr(0, der.size() - 1), first));
+}
+
+TEST_F(CertificateCacheTest, VerifyRemembersResult)
+{
+    CertificateX509 cert;
+    CreateCert("1010101", cert);
+    uint8_t digest[Crypto_SHA256::DIGEST_SIZE];
+    ASSERT_EQ(ER_OK, CertificateCache::GetCertificateDigest(cert, digest));
+
+    QStatus status;
+    EXPECT_FALSE(CertificateCache::LookupVerification(digest, issuer.GetDSAPublicKey(), status));
+    EXPECT_EQ(ER_OK, CertificateCache::Verify(cert, issuer.GetDSAPublicKey()));
+    ASSERT_TRUE(CertificateCache::LookupVerification(digest, issuer.GetDSAPublicKey(), status));
+    EXPECT_EQ(ER_OK, status);
+
+    /* The wrong issuer key fails and is remembered separately. */
+    EXPECT_NE(ER_OK, CertificateCache::Verify(cert, subject.GetDSAPublicKey()));
+    ASSERT_TRUE(CertificateCache::LookupVerification(digest, subject.GetDSAPublicKey(), status));
+    EXPECT_NE(ER_OK, status);
+    EXPECT_EQ(ER_OK, CertificateCache::Verify(cert, issuer.GetDSAPublicKey()));
+
+    /* Re-signing changes the digest, so the old result does not apply. */
+    ASSERT_EQ(ER_OK, cert.Sign(subject.GetDSAPrivateKey()));
+    EXPECT_NE(ER_OK, CertificateCache::Verify(cert, issuer.GetDSAPublicKey()));
+    EXPECT_EQ(ER_OK, CertificateCache::Verify(cert, subject.GetDSAPublicKey()));
+
+    CertificateCache::Clear();
+    EXPECT_EQ((size_t) 0, CertificateCache::GetSize());
+    EXPECT_FALSE(CertificateCache::LookupVerification(digest, issuer.GetDSAPublicKey(), status));
+}
+
+TEST_F(CertificateCacheTest, EvictsLeastRecentlyUsed)
+{
+    const size_t count = 4;
+    CertificateX509 certs[count];
+    uint8_t digests[count][Crypto_SHA256::DIGEST_SIZE];
+    CertificateCache::SetCapacity(count - 1);
+    for (size_t i = 0; i < count; i++) {
+        CreateCert(qcc::U32ToString((uint32_t) i + 1), certs[i]);
+        ASSERT_EQ(ER_OK, CertificateCache::GetCertificateDigest(certs[i], digests[i]));
+    }
+    for (size_t i = 0; i < (count - 1); i++) {
+        EXPECT_EQ(ER_OK, CertificateCache::Verify(certs[i], issuer.GetDSAPublicKey()));
+    }
+    /* Touch the oldest entry so the second one is evicted next. */
+    QStatus status;
+    EXPECT_TRUE(CertificateCache::LookupVerification(digests[0], issuer.GetDSAPublicKey(), status));
+    EXPECT_EQ(ER_OK, CertificateCache::Verify(certs[count - 1], issuer.GetDSAPublicKey()));
+    EXPECT_EQ(count - 1, CertificateCache::GetSize());
+    EXPECT_TRUE(CertificateCache::LookupVerification(digests[0], issuer.GetDSAPublicKey(), status));
+    EXPECT_FALSE(CertificateCache::LookupVerification(digests[1], issuer.GetDSAPublicKey(), status));
+    EXPECT_TRUE(CertificateCache::LookupVerification(digests[2], issuer.GetDSAPublicKey(), status));
+    EXPECT_TRUE(CertificateCache::LookupVerification(digests[3], issuer.GetDSAPublicKey(), status));
+
+    CertificateCache::SetCapacity(0);
+    EXPECT_EQ((size_t) 0, CertificateCache::GetSize());
+    EXPECT_EQ(ER_OK, CertificateCache::Verify(certs[0], issuer.GetDSAPublicKey()));
+    EXPECT_EQ((size_t) 0, CertificateCache::GetSize());
+}
@@ -714,6 +714,39 @@ TEST_F(CertificateECCTest, TestCertChainWithNoCAFieldInBasicContraints)
     ASSERT_EQ(ER_OK, status) << " verify leaf cert failed with actual status: " << QCC_StatusText(status);
 }
 
+/**
+ * Verify the signatures of a generated cert chain in one batch and make sure
+ * a link signed by the wrong key is rejected.
+ */
+TEST_F(CertificateECCTest, VerifyCertChainSignatures)
+{
+    const size_t chainLen = 4;
+    Crypto_ECC ecc[chainLen];
+    qcc::GUID128 guids[chainLen];
+    CertificateX509 certs[chainLen];
+    CertificateX509::ValidPeriod validity;
+    validity.validFrom = qcc::GetEpochTimestamp() / 1000;
+    validity.validTo = validity.validFrom + 3600;
+
+    for (size_t i = 0; i < chainLen; i++) {
+        ASSERT_EQ(ER_OK, ecc[i].GenerateDSAKeyPair());
+    }
+    /* certs[chainLen - 1] is the self-signed root */
+    for (size_t i = 0; i < chainLen; i++) {
+        size_t issuer = ((i + 1) < chainLen) ? (i + 1) : i;
+        ASSERT_EQ(ER_OK, CreateCert("1010101", guids[issuer], "organization", ecc[issuer].GetDSAPrivateKey(), ecc[issuer].GetDSAPublicKey(), guids[i], ecc[i].GetDSAPublicKey(), validity, certs[i]));
+    }
+    EXPECT_EQ(ER_OK, CertificateHelper::VerifyCertChainSignatures(certs, chainLen));
+    EXPECT_EQ(ER_OK, CertificateHelper::VerifyCertChainSignatures(certs, 2));
+    EXPECT_EQ(ER_OK, CertificateHelper::VerifyCertChainSignatures(certs, 1));
+
+    /* re-sign the middle cert with the leaf key instead of its issuer's key */
+    ASSERT_EQ(ER_OK, CreateCert("1010101", guids[2], "organization", ecc[0].GetDSAPrivateKey(), ecc[0].GetDSAPublicKey(), guids[1], ecc[1].GetDSAPublicKey(), validity, certs[1]));
+    EXPECT_NE(ER_OK, CertificateHelper::VerifyCertChainSignatures(certs, chainLen));
+    EXPECT_NE(ER_OK, CertificateHelper::VerifyCertChainSignatures(certs, 3));
+    EXPECT_EQ(ER_OK, CertificateHelper::VerifyCertChainSignatures(&certs[2], 2));
+}
+
 /**
  * Helper to test validity period.
  */
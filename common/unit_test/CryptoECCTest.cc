@@ -33,6 +33,7 @@
 #include <qcc/Crypto.h>
 #include <qcc/CryptoECC.h>
 #include <qcc/CryptoECCMath.h>
+#include <qcc/CryptoECCp256.h>
 
 /* For ECCPublicKeyImportInitializeHandles test, which only applies to Windows CNG. */
 #ifdef CRYPTO_CNG
@@ -424,6 +425,111 @@ TEST_F(CryptoECCTest, EC_SPEKETest)
 }
 
 
+/**
+ * Check that the fixed-base multiplication k*G agrees with the generic
+ * variable-base multiplication, for scalars that exercise every row of the
+ * precomputed table, the ends of the scalar range and random values.
+ */
+TEST_F(CryptoECCTest, FixedBaseScalarMul)
+{
+    ec_t curve;
+    ASSERT_EQ(ER_OK, ec_getcurve(&curve, NISTP256r1));
+    ecpoint_t G;
+    ec_get_generator(&G, &curve);
+
+    vector<vector<digit_t> > scalars;
+    for (unsigned int bit = 0; bit < 256; bit++) {
+        for (digit_t low = 1; low < 16; low += 2) {
+            /* low * 2^bit, wrapping at 256 bits */
+            vector<digit_t> k(P256_DIGITS, 0);
+            k[bit / RADIX_BITS] = low << (bit % RADIX_BITS);
+            if ((bit % RADIX_BITS) != 0 && (bit / RADIX_BITS) + 1 < P256_DIGITS) {
+                k[bit / RADIX_BITS + 1] = low >> (RADIX_BITS - (bit % RADIX_BITS));
+            }
+            scalars.push_back(k);
+        }
+    }
+    vector<digit_t> k(P256_DIGITS, 0);
+    k[0] = 1;
+    scalars.push_back(k);
+    k[0] = 2;
+    scalars.push_back(k);
+    for (digit_t d = 1; d <= 4; d++) {
+        /* r - d */
+        fpcopy_p256(curve.order, &k[0]);
+        k[0] -= d;
+        scalars.push_back(k);
+    }
+    for (int i = 0; i < 200; i++) {
+        ASSERT_EQ(ER_OK, Crypto_GetRandomBytes((uint8_t*)&k[0], sizeof(digit256_t)));
+        scalars.push_back(k);
+    }
+
+    for (size_t i = 0; i < scalars.size(); i++) {
+        digit256_t k1, k2;
+        memcpy(k1, &scalars[i][0], sizeof(digit256_t));
+        memcpy(k2, k1, sizeof(digit256_t));
+        ecpoint_t Q1, Q2;
+        QStatus expected = ec_scalarmul(&G, k1, &Q1, &curve);
+        QStatus status = ec_scalarmul_base(k2, &Q2, &curve);
+        ASSERT_EQ(expected, status) << "scalar " << i;
+        if (status == ER_OK) {
+            EXPECT_TRUE(fpequal_p256(Q1.x, Q2.x)) << "scalar " << i;
+            EXPECT_TRUE(fpequal_p256(Q1.y, Q2.y)) << "scalar " << i;
+        }
+    }
+
+    ec_freecurve(&curve);
+}
+
+/**
+ * Batch verification must agree with verifying each signature on its own, for
+ * any mix of signers and with invalid signatures anywhere in the batch.
+ */
+TEST_F(CryptoECCTest, DSAVerifyDigestBatch)
+{
+    const size_t NUM_KEYS = 3;
+    const size_t NUM_SIGS = 19;
+    Crypto_ECC signers[NUM_KEYS];
+    for (size_t i = 0; i < NUM_KEYS; i++) {
+        ASSERT_EQ(ER_OK, signers[i].GenerateDSAKeyPair());
+    }
+
+    uint8_t digests[NUM_SIGS][Crypto_SHA256::DIGEST_SIZE];
+    ECCSignature sigs[NUM_SIGS];
+    Crypto_ECC::DSAVerifyEntry entries[NUM_SIGS];
+    for (size_t i = 0; i < NUM_SIGS; i++) {
+        /* Mostly the first key, as with a certificate chain or manifests from one issuer */
+        Crypto_ECC& signer = signers[(i % 4 == 3) ? (i % NUM_KEYS) : 0];
+        ASSERT_EQ(ER_OK, Crypto_GetRandomBytes(digests[i], sizeof(digests[i])));
+        ASSERT_EQ(ER_OK, signer.DSASignDigest(digests[i], sizeof(digests[i]), &sigs[i]));
+        entries[i].publicKey = signer.GetDSAPublicKey();
+        entries[i].digest = digests[i];
+        entries[i].len = sizeof(digests[i]);
+        entries[i].sig = &sigs[i];
+        entries[i].status = ER_FAIL;
+    }
+
+    for (size_t count = 0; count <= NUM_SIGS; count++) {
+        EXPECT_EQ(ER_OK, Crypto_ECC::DSAVerifyDigestBatch(entries, count)) << "count " << count;
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(ER_OK, entries[i].status) << "count " << count << " entry " << i;
+        }
+    }
+
+    /* Corrupt one digest and swap the signer of another */
+    digests[5][0] ^= 1;
+    entries[11].publicKey = signers[1].GetDSAPublicKey();
+    EXPECT_EQ(ER_FAIL, Crypto_ECC::DSAVerifyDigestBatch(entries, NUM_SIGS));
+    for (size_t i = 0; i < NUM_SIGS; i++) {
+        Crypto_ECC ecc;
+        ecc.SetDSAPublicKey(entries[i].publicKey);
+        QStatus expected = ecc.DSAVerifyDigest(entries[i].digest, entries[i].len, entries[i].sig);
+        EXPECT_EQ(((i == 5) || (i == 11)) ? ER_FAIL : ER_OK, expected) << "entry " << i;
+        EXPECT_EQ(expected, entries[i].status) << "entry " << i;
+    }
+}
+
 /**
  * Test detection of invalid public keys on import.
  */
@@ -31,6 +31,7 @@
 
 #include <qcc/Condition.h>
 #include <qcc/IODispatch.h>
+#include <qcc/SocketStream.h>
 
 using namespace qcc;
 
@@ -127,3 +128,100 @@ TEST_F(IODispatchStopStreamTest, WhenStreamIsStarted_Stop)
     l.WaitForExitCallback();
     l.ReturnFromExitCallback();
 }
+
+class IODispatchReadCallbackTest : public testing::Test {
+  public:
+    class Listener : public IOReadListener, public IOWriteListener, public IOExitListener {
+      public:
+        Mutex mutex;
+        Condition condition;
+        size_t numReads;
+
+        Listener() : numReads(0) { }
+        virtual ~Listener() { }
+        virtual QStatus ReadCallback(Source& source, bool isTimedOut) {
+            if (!isTimedOut) {
+                uint8_t buf[16];
+                size_t actual;
+                source.PullBytes(buf, sizeof(buf), actual, 0);
+            }
+            mutex.Lock();
+            ++numReads;
+            condition.Signal();
+            mutex.Unlock();
+            return ER_OK;
+        }
+        virtual QStatus WriteCallback(Sink&, bool) { return ER_OK; }
+        virtual void ExitCallback() { }
+        bool WaitForReads(size_t expected) {
+            mutex.Lock();
+            while (numReads < expected) {
+                if (condition.TimedWait(mutex, 5000) != ER_OK) {
+                    break;
+                }
+            }
+            bool reached = (numReads >= expected);
+            mutex.Unlock();
+            return reached;
+        }
+        size_t GetNumReads() {
+            mutex.Lock();
+            size_t num = numReads;
+            mutex.Unlock();
+            return num;
+        }
+    };
+
+    static const size_t NUM_STREAMS = 32;
+    SocketStream* streams[NUM_STREAMS];
+    SocketStream* peers[NUM_STREAMS];
+    Listener l;
+    IODispatch io;
+
+    IODispatchReadCallbackTest() : io("IODispatchReadCallbackTest", 4) { }
+
+    virtual void SetUp() {
+        ASSERT_EQ(ER_OK, io.Start());
+        for (size_t i = 0; i < NUM_STREAMS; ++i) {
+            SocketFd fds[2];
+            ASSERT_EQ(ER_OK, SocketPair(fds));
+            streams[i] = new SocketStream(fds[0]);
+            peers[i] = new SocketStream(fds[1]);
+            ASSERT_EQ(ER_OK, io.StartStream(streams[i], &l, &l, &l, true, false));
+        }
+    }
+
+    virtual void TearDown() {
+        for (size_t i = 0; i < NUM_STREAMS; ++i) {
+            io.StopStream(streams[i]);
+            io.JoinStream(streams[i]);
+            delete streams[i];
+            delete peers[i];
+        }
+        io.Stop();
+        io.Join();
+    }
+
+    void SendToAll() {
+        for (size_t i = 0; i < NUM_STREAMS; ++i) {
+            size_t sent;
+            ASSERT_EQ(ER_OK, peers[i]->PushBytes("x", 1, sent));
+        }
+    }
+};
+
+TEST_F(IODispatchReadCallbackTest, OneReadCallbackPerStream)
+{
+    SendToAll();
+    EXPECT_TRUE(l.WaitForReads(NUM_STREAMS));
+
+    /* Reads stay disabled until they are enabled again */
+    SendToAll();
+    qcc::Sleep(100);
+    EXPECT_EQ(static_cast<size_t>(NUM_STREAMS), l.GetNumReads());
+
+    for (size_t i = 0; i < NUM_STREAMS; ++i) {
+        EXPECT_EQ(ER_OK, io.EnableReadCallback(streams[i]));
+    }
+    EXPECT_TRUE(l.WaitForReads(2 * NUM_STREAMS));
+}
@@ -132,6 +132,76 @@ INSTANTIATE_TEST_CASE_P(SocketTest, SendToAndRecvFrom,
                                           pair<AddressFamily, SocketType>(QCC_AF_INET, QCC_SOCK_DGRAM),
                                           pair<AddressFamily, SocketType>(QCC_AF_INET, QCC_SOCK_STREAM)));
 
+TEST(SocketTest, SendToBatchAndRecvFromBatch) {
+    IPAddress hostAddr("127.0.0.1");
+
+    SocketFd clientFd = INVALID_SOCKET_FD;
+    uint16_t clientPort = 0;
+    ASSERT_EQ(ER_OK, Socket(QCC_AF_INET, QCC_SOCK_DGRAM, clientFd));
+    ASSERT_EQ(ER_OK, Bind(clientFd, hostAddr, clientPort));
+    ASSERT_EQ(ER_OK, GetLocalAddress(clientFd, hostAddr, clientPort));
+
+    SocketFd serverFd = INVALID_SOCKET_FD;
+    uint16_t serverPort = 0;
+    ASSERT_EQ(ER_OK, Socket(QCC_AF_INET, QCC_SOCK_DGRAM, serverFd));
+    ASSERT_EQ(ER_OK, Bind(serverFd, hostAddr, serverPort));
+    ASSERT_EQ(ER_OK, GetLocalAddress(serverFd, hostAddr, serverPort));
+    ASSERT_EQ(ER_OK, SetBlocking(serverFd, false));
+
+    /* Each datagram is a header and a payload gathered from separate buffers */
+    const char* headers[] = { "1:", "2:", "3:" };
+    const char* payloads[] = { "first", "second", "third" };
+    IOVec sendIov[ArraySize(headers)][2];
+    Datagram sendDgrams[ArraySize(headers)];
+    for (size_t i = 0; i < ArraySize(headers); ++i) {
+        sendIov[i][0].buf = const_cast<char*>(headers[i]);
+        sendIov[i][0].len = strlen(headers[i]);
+        sendIov[i][1].buf = const_cast<char*>(payloads[i]);
+        sendIov[i][1].len = strlen(payloads[i]);
+        sendDgrams[i].iov = sendIov[i];
+        sendDgrams[i].iovLen = 2;
+    }
+    size_t sentCount = 0;
+    EXPECT_EQ(ER_OK, SendToBatch(clientFd, hostAddr, serverPort, sendDgrams, ArraySize(sendDgrams), sentCount));
+    EXPECT_EQ(ArraySize(sendDgrams), sentCount);
+
+    char recvBufs[4][32];
+    IOVec recvIov[4];
+    Datagram recvDgrams[4];
+    for (size_t i = 0; i < ArraySize(recvDgrams); ++i) {
+        recvIov[i].buf = recvBufs[i];
+        recvIov[i].len = sizeof(recvBufs[i]);
+        recvDgrams[i].iov = &recvIov[i];
+        recvDgrams[i].iovLen = 1;
+    }
+    size_t recvCount = 0;
+    size_t received = 0;
+    for (uint32_t tries = 0; (received < sentCount) && (tries < 100); ++tries) {
+        QStatus status = RecvFromBatch(serverFd, &recvDgrams[received], ArraySize(recvDgrams) - received, recvCount);
+        if (status == ER_WOULDBLOCK) {
+            qcc::Sleep(10);
+            continue;
+        }
+        ASSERT_EQ(ER_OK, status);
+        received += recvCount;
+    }
+    ASSERT_EQ(sentCount, received);
+
+    for (size_t i = 0; i < received; ++i) {
+        String expected = String(headers[i]) + payloads[i];
+        EXPECT_EQ(expected.size(), recvDgrams[i].len);
+        EXPECT_EQ(expected, String(recvBufs[i], recvDgrams[i].len));
+        EXPECT_EQ(clientPort, recvDgrams[i].port);
+        EXPECT_EQ(hostAddr, recvDgrams[i].addr);
+    }
+
+    /* Nothing left to read */
+    EXPECT_EQ(ER_WOULDBLOCK, RecvFromBatch(serverFd, recvDgrams, ArraySize(recvDgrams), recvCount));
+
+    Close(clientFd);
+    Close(serverFd);
+}
+
 /*
  * File descriptors are local to a machine and are not meaningful beyond
  * the machine boundaries. Hence, SendWithFds and RecvWithFds functions
@@ -332,6 +402,28 @@ TEST_F(SocketTestErrors, SendWhenConnected)
     EXPECT_EQ(ER_OK, Send(acceptedFd, buf, 1, numSent));
 }
 
+TEST_F(SocketTestErrors, SendVGathersBuffers)
+{
+    const char* parts[] = { "Hello", ", ", "gathered", " world" };
+    IOVec iov[ArraySize(parts)];
+    size_t total = 0;
+    for (size_t i = 0; i < ArraySize(parts); ++i) {
+        iov[i].buf = const_cast<char*>(parts[i]);
+        iov[i].len = strlen(parts[i]);
+        total += iov[i].len;
+    }
+    EXPECT_EQ(ER_OK, SendV(clientFd, iov, ArraySize(iov), numSent));
+    EXPECT_EQ(total, numSent);
+
+    size_t received = 0;
+    while (received < total) {
+        ASSERT_EQ(ER_OK, Recv(acceptedFd, buf + received, sizeof(buf) - received, numRecvd));
+        ASSERT_NE(0U, numRecvd);
+        received += numRecvd;
+    }
+    EXPECT_EQ(0, memcmp("Hello, gathered world", buf, total));
+}
+
 TEST_F(SocketTestErrors, SendWhenNotConnected)
 {
     SocketFd sockFd = INVALID_SOCKET_FD;
@@ -28,7 +28,9 @@
  ******************************************************************************/
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <deque>
+#include <vector>
 
 #include <qcc/Thread.h>
 #include <qcc/Timer.h>
@@ -501,3 +503,89 @@ TEST(TimerTest, TestMaxAlarms) {
     ASSERT_EQ(triggeredAlarms.size(), (size_t)3);
     triggeredAlarmsLock.Unlock();
 }
+
+/*
+ * This test verifies that a Timer using the timing wheel fires alarms in the same
+ * (alarm time, alarm id) order as the default ordered set would:
+ *
+ * 1. Schedule alarms spread over ~600ms so that some of them are cascaded from the
+ *    second level of the wheel, several alarms sharing each expiry time.
+ * 2. Remove some of them, replace one and add an alarm that is already due and
+ *    alarms far enough out to be held in the upper levels and the overflow set.
+ * 3. Expect the remaining alarms to fire in sorted order.
+ */
+TEST(TimerTest, TestTimingWheelOrdering) {
+    const size_t numAlarms = 200;
+    const uint32_t spread = 600;
+    triggeredAlarmsLock.Lock();
+    triggeredAlarms.clear();
+    triggeredAlarmsLock.Unlock();
+
+    MyAlarmListener listener(0);
+    AlarmListener* al = &listener;
+
+    Timer timer("testTimer", false, 1, false, 0, true);
+    ASSERT_EQ(ER_OK, timer.Start());
+
+    std::vector<Alarm> expected;
+    for (size_t i = 0; i < numAlarms; ++i) {
+        uint32_t delay = 100 + static_cast<uint32_t>((i * 37) % spread);
+        void* context = reinterpret_cast<void*>(i);
+        Alarm a(delay, al, context);
+        ASSERT_EQ(ER_OK, timer.AddAlarm(a));
+        if ((i % 7) == 0) {
+            EXPECT_TRUE(timer.RemoveAlarm(a));
+            EXPECT_FALSE(timer.HasAlarm(a));
+        } else {
+            EXPECT_TRUE(timer.HasAlarm(a));
+            expected.push_back(a);
+        }
+    }
+
+    Alarm replaced = expected.back();
+    expected.pop_back();
+    uint32_t delay = 50;
+    void* context = reinterpret_cast<void*>(numAlarms);
+    Alarm replacement(delay, al, context);
+    ASSERT_EQ(ER_OK, timer.ReplaceAlarm(replaced, replacement));
+    expected.push_back(replacement);
+
+    delay = 0;
+    context = reinterpret_cast<void*>(numAlarms + 1);
+    Alarm due(delay, al, context);
+    ASSERT_EQ(ER_OK, timer.AddAlarm(due));
+    expected.push_back(due);
+
+    delay = 100000;
+    Alarm distant(delay, al);
+    Timespec<MonotonicTime> farTime;
+    GetTimeNow(&farTime);
+    farTime.seconds += 10000000;
+    Alarm farOff(farTime, al);
+    ASSERT_EQ(ER_OK, timer.AddAlarm(distant));
+    ASSERT_EQ(ER_OK, timer.AddAlarm(farOff));
+
+    std::sort(expected.begin(), expected.end());
+
+    uint64_t startTime = GetTimestamp64();
+    triggeredAlarmsLock.Lock();
+    while ((triggeredAlarms.size() < expected.size()) && (GetTimestamp64() < (startTime + 5000))) {
+        triggeredAlarmsLock.Unlock();
+        qcc::Sleep(10);
+        triggeredAlarmsLock.Lock();
+    }
+    ASSERT_EQ(expected.size(), triggeredAlarms.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i]->GetContext(), triggeredAlarms[i].second->GetContext()) << "Alarm " << i << " fired out of order";
+    }
+    triggeredAlarms.clear();
+    triggeredAlarmsLock.Unlock();
+
+    EXPECT_TRUE(timer.HasAlarm(distant));
+    EXPECT_TRUE(timer.RemoveAlarm(distant));
+    EXPECT_TRUE(timer.HasAlarm(farOff));
+    EXPECT_TRUE(timer.RemoveAlarm(farOff));
+
+    ASSERT_EQ(ER_OK, timer.Stop());
+    ASSERT_EQ(ER_OK, timer.Join());
+}
@@ -29,6 +29,9 @@
 #include <vector>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include <alljoyn/Status.h>
 #include <qcc/XmlElement.h>
 #include <qcc/String.h>
@@ -280,6 +283,74 @@ TEST(XmlElement, Parse_mixed_quote)
     EXPECT_STREQ("<bar value='world'/>", root->GetChild("foo")->GetChildren()[1]->GetAttribute("second").c_str());
 }
 
+/* Source that hands out its contents a few bytes at a time */
+class TrickleSource : public Source {
+  public:
+    TrickleSource(const String& str, size_t chunk) : str(str), outIdx(0), chunk(chunk) { }
+
+    QStatus PullBytes(void* buf, size_t reqBytes, size_t& actualBytes, uint32_t timeout = Event::WAIT_FOREVER)
+    {
+        QCC_UNUSED(timeout);
+        actualBytes = std::min(std::min(reqBytes, chunk), str.size() - outIdx);
+        if (0 == actualBytes) {
+            return ER_EOF;
+        }
+        memcpy(buf, str.data() + outIdx, actualBytes);
+        outIdx += actualBytes;
+        return ER_OK;
+    }
+
+  private:
+    String str;
+    size_t outIdx;
+    size_t chunk;
+};
+
+TEST(XmlElement, Parse_across_source_blocks)
+{
+    String xml = "<?xml version=\"1.0\"?><!-- comment --><node name='/a'>";
+    for (int i = 0; i < 200; ++i) {
+        xml += "<interface name=\"org.example.Iface\"><method name=\"Call\"><arg type=\"s\" direction='in'/></method>";
+        xml += "<description>Some &amp; text</description></interface>";
+    }
+    xml += "</node>";
+
+    StringSource stringSource(xml);
+    XmlParseContext stringPc(stringSource);
+    ASSERT_EQ(ER_OK, XmlElement::Parse(stringPc));
+
+    TrickleSource trickleSource(xml, 7);
+    XmlParseContext tricklePc(trickleSource);
+    ASSERT_EQ(ER_OK, XmlElement::Parse(tricklePc));
+
+    const XmlElement* root = tricklePc.GetRoot();
+    EXPECT_STREQ("node", root->GetName().c_str());
+    EXPECT_STREQ("/a", root->GetAttribute("name").c_str());
+    ASSERT_EQ(200U, root->GetChildren("interface").size());
+    EXPECT_STREQ("in", root->GetPath("interface/method/arg")[0]->GetAttribute("direction").c_str());
+    EXPECT_STREQ("Some & text", root->GetChildren("interface")[199]->GetChild("description")->GetContent().c_str());
+    EXPECT_EQ(stringPc.GetRoot()->Generate(), root->Generate());
+}
+
+TEST(XmlElement, Parse_consecutive_documents)
+{
+    String xml = "<first a='1'/> <second>two</second>";
+    StringSource source(xml);
+    XmlParseContext pc(source);
+    ASSERT_EQ(ER_OK, XmlElement::Parse(pc));
+    EXPECT_STREQ("first", pc.GetRoot()->GetName().c_str());
+    /* Only the first document is consumed from the source */
+    EXPECT_EQ(String(" <second>two</second>").size(), source.Remaining());
+
+    /* A new context picks up where the previous one stopped */
+    Source& src = source;
+    XmlParseContext pc2(src);
+    ASSERT_EQ(ER_OK, XmlElement::Parse(pc2));
+    EXPECT_STREQ("second", pc2.GetRoot()->GetName().c_str());
+    EXPECT_STREQ("two", pc2.GetRoot()->GetContent().c_str());
+    EXPECT_EQ(0U, source.Remaining());
+}
+
 TEST(XmlElement, GetPath)
 {
     String xml = "<config>\